@@ -5,7 +5,7 @@
  * Hardware:
  * - P0.2: TXD0 (transmisión a módulo Bluetooth)
  * - P0.3: RXD0 (recepción desde módulo Bluetooth)
- * - Velocidad: 9600 bps
+ * - Velocidad: BT_VELOCIDAD_UART0 (DLL/DLM/FDR de divisor_uart_calcular())
  *
  * Comandos soportados:
  * - 'W' o 'w': Arriba
@@ -14,6 +14,7 @@
  * - 'D' o 'd': Derecha
  * - 'B' o 'b': Botón
  * - 'P' o 'p': Pausa / Reintentar
+ * - 'I' o 'i': Pide la tabla de carga de las interrupciones (perfil_isr.h)
  *
  * @date Noviembre 2025
  */
@@ -22,9 +23,42 @@
 #define BLUETOOTH_UART_H
 
 #include <stdint.h>
+#include "divisor_uart.h"
 
 /* === CONFIGURACIÓN === */
-#define BT_VELOCIDAD_UART0    9600
+#define BT_VELOCIDAD_UART0    9600    // Cualquier valor hasta PCLK/16: DLL/DLM/FDR se calculan
+
+/**
+ * @brief Contadores de la recepción por interrupción
+ */
+typedef struct {
+    uint32_t recibidos;         // Bytes que la ISR sacó del FIFO
+    uint32_t descartados;       // La cola estaba llena: el bucle principal no leyó a tiempo
+    uint32_t overrun_fifo;      // OE: el FIFO de 16 bytes se llenó antes de la ISR
+    uint32_t errores_linea;     // Paridad, trama o break
+    uint32_t maximo_en_cola;    // Mayor ocupación de la cola (de 256)
+} BtEstadisticasRx;
+
+/**
+ * @brief Contadores de la transmisión por DMA
+ */
+typedef struct {
+    uint32_t encolados;         // Bytes aceptados desde bt_inicializar()
+    uint32_t descartados;       // No entraron en la cola (la cadena se descarta entera)
+    uint32_t en_cola;           // Todavía sin salir, incluido el tramo que mueve el DMA
+    uint32_t maximo_en_cola;    // Mayor ocupación de la cola (de 1024)
+} BtEstadisticasTx;
+
+/**
+ * @brief Contadores de las tramas binarias (ver protocolo_bt.h)
+ */
+typedef struct {
+    uint32_t tramas_aceptadas;
+    uint32_t errores_crc;       // CRC, largo inválido o trama cortada
+    uint32_t tramas_perdidas;   // Saltos en el número de secuencia
+    uint32_t bytes_sueltos;     // Fuera de una trama (letras de una terminal)
+    uint32_t latencia_peor_ms;  // Mayor atraso al aplicar un evento agendado
+} BtEstadisticasProtocolo;
 
 /* === FUNCIONES PÚBLICAS === */
 
@@ -37,6 +71,12 @@
  * - Velocidad: 9600 bps
  * - Formato: 8 bits, sin paridad, 1 stop bit (8N1)
  * - FIFO habilitado
+ * - Recepción por interrupción (UART0_IRQHandler, prioridad 3) a una
+ *   cola de 256 bytes
+ * - Transmisión por el canal 2 del GPDMA desde una cola de 1024 bytes
+ * @note El canal TX arranca recién cuando el GPDMA está encendido
+ *       (GPDMA_Init() en melodias_inicializar()); lo escrito antes espera
+ *       en la cola hasta la próxima escritura.
  */
 void bt_inicializar(void);
 
@@ -48,27 +88,87 @@ void bt_inicializar(void);
 int bt_leer_caracter_no_bloqueante(void);
 
 /**
- * @brief Actualiza el buffer UART leyendo caracteres disponibles
+ * @brief Procesa los caracteres que dejó la ISR en la cola de recepción
  * 
  * Debe llamarse periódicamente desde el loop principal para recibir
  * comandos Bluetooth. Procesa automáticamente los comandos recibidos.
+ * Si se atrasa, los bytes esperan en la cola (no en el FIFO de 16 bytes).
+ * También manda la telemetría del protocolo binario (ver protocolo_bt.h).
  */
 void bt_actualizar_buffer(void);
 
 /**
- * @brief Envía un carácter por Bluetooth
+ * @brief Copia los contadores de recepción (bytes, descartes y overruns)
+ */
+void bt_obtener_estadisticas_rx(BtEstadisticasRx *estadisticas);
+
+/**
+ * @brief Envía un carácter por Bluetooth (lo encola y vuelve)
  * 
  * @param caracter Carácter a enviar
  */
 void bt_escribir_caracter(char caracter);
 
 /**
- * @brief Envía una cadena por Bluetooth
+ * @brief Envía una cadena por Bluetooth (la encola y vuelve)
  * 
+ * La copia a la cola y el DMA la transmite en segundo plano: a 9600 bps
+ * cada byte tarda ~1 ms, que ya no se esperan acá. Si no entra entera en
+ * lo que queda de la cola se descarta completa (ver bt_obtener_estadisticas_tx).
+ * @note Solo desde el bucle principal (un único productor)
  * @param cadena Cadena terminada en '\0' a enviar
  */
 void bt_escribir_cadena(const char *cadena);
 
+/**
+ * @brief Copia los contadores de transmisión (encolados, descartes, ocupación)
+ */
+void bt_obtener_estadisticas_tx(BtEstadisticasTx *estadisticas);
+
+/**
+ * @brief Copia los contadores del protocolo binario (tramas, CRC, secuencia)
+ */
+void bt_obtener_estadisticas_protocolo(BtEstadisticasProtocolo *estadisticas);
+
+/**
+ * @brief Copia los divisores que cargó bt_inicializar() y el error logrado
+ *
+ * baudios_reales queda en 0 si BT_VELOCIDAD_UART0 no se alcanza con el
+ * PCLK de UART0 (y entonces el transmisor quedó apagado).
+ */
+void bt_obtener_divisor(DivisorUart *divisor);
+
+/**
+ * @brief Indica si hay un espectador conectado (PROTOCOLO_TIPO_ESPECTADOR)
+ *
+ * Los juegos lo consultan antes de armar sus registros de espectador.h.
+ */
+uint8_t bt_espectador_activo(void);
+
+/**
+ * @brief Consume un pedido de foto del espectador
+ *
+ * Se pide al conectarse, cuando el espectador perdió una trama y cuando
+ * bt_enviar_juego() no pudo encolar una.
+ * @return 1 si el juego tiene que mandar su estado completo
+ */
+uint8_t bt_obtener_pedido_foto(void);
+
+/**
+ * @brief Manda los registros de espectador.h de un tick (trama PROTOCOLO_TIPO_JUEGO)
+ *
+ * @param registros Carga armada con espectador_poner_*()
+ * @return 0 si no hay espectador o la trama no entró en la cola TX
+ */
+uint8_t bt_enviar_juego(const uint8_t *registros, uint8_t largo);
+
+/**
+ * @brief Bytes libres en la cola de transmisión
+ *
+ * Para no empezar una foto de varias tramas que no entra completa.
+ */
+uint32_t bt_tx_libres(void);
+
 /**
  * @brief Procesa comandos Bluetooth recibidos
  * 
@@ -115,4 +215,11 @@ uint8_t bt_obtener_comando_boton(void);
  */
 void bt_limpiar_comando_boton(void);
 
+/**
+ * @brief Consume un pedido de volcado del perfil de interrupciones ('I')
+ *
+ * @return 1 si llegó el comando desde la última llamada
+ */
+uint8_t bt_obtener_pedido_perfil(void);
+
 #endif /* BLUETOOTH_UART_H */
@@ -0,0 +1,23 @@
+/**
+ * @file clips_pcm.h
+ * @brief Índice de los clips PCM para melodias_clip_reproducir()
+ *
+ * Generado por tools/convertidor_wav.c. No editar a mano:
+ *   ./convertidor_wav tools/clips/golpe.wav tools/clips/moneda.wav:10
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef CLIPS_PCM_H
+#define CLIPS_PCM_H
+
+#include "melodias_dac.h"
+
+/* === ÍNDICES EN clips_pcm[] === */
+#define CLIP_GOLPE                0
+#define CLIP_MONEDA               1
+#define CLIPS_PCM_CANTIDAD        2
+
+extern const ClipPCM clips_pcm[CLIPS_PCM_CANTIDAD];
+
+#endif // CLIPS_PCM_H
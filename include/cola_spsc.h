@@ -0,0 +1,100 @@
+/**
+ * @file cola_spsc.h
+ * @brief Cola de bytes de un productor y un consumidor, sin bloqueos.
+ *
+ * Pensada para una ISR que produce (UART0_IRQHandler) y el bucle principal
+ * que consume, o al revés: en la transmisión Bluetooth produce el bucle y
+ * consume la ISR del DMA, que lee tramos contiguos directo del arreglo
+ * (cola_spsc_tramo / cola_spsc_liberar). Ninguno deshabilita interrupciones: cada índice lo escribe
+ * un solo lado, y el orden entre el dato y el índice lo garantizan una
+ * escritura con semántica release y la lectura acquire del otro lado
+ * (__atomic de GCC: en Cortex-M3 es un DMB, en la PC lo que corresponda).
+ *
+ * Los índices corren libres (sin módulo) y el tamaño es potencia de 2: la
+ * cola llena es escritura - lectura == tamaño, sin perder una posición.
+ *
+ * C puro, sin periféricos: tools/prueba_cola_spsc.c la prueba en la PC con
+ * intercalados aleatorios.
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef COLA_SPSC_H
+#define COLA_SPSC_H
+
+#include <stdint.h>
+
+typedef struct {
+    uint8_t *datos;
+    uint32_t mascara;               // Tamaño - 1
+    uint32_t escritura;             // Solo la escribe el productor
+    uint32_t lectura;               // Solo la escribe el consumidor
+    uint32_t descartados;           // Bytes que no entraron (solo el productor)
+    uint32_t maximo_ocupado;        // Marca de agua (solo el productor)
+} ColaSpsc;
+
+/**
+ * @brief Prepara una cola vacía sobre un arreglo.
+ * @param tamano Potencia de 2
+ * @return 0 si el tamaño no es potencia de 2
+ */
+uint8_t cola_spsc_inicializar(ColaSpsc *cola, uint8_t *datos, uint32_t tamano);
+
+/**
+ * @brief Productor: agrega un byte.
+ * @return 0 si la cola estaba llena (el byte se descarta y se cuenta)
+ */
+uint8_t cola_spsc_poner(ColaSpsc *cola, uint8_t byte);
+
+/**
+ * @brief Productor: agrega un bloque entero o nada.
+ *
+ * Publica el índice una sola vez al final. Si no entra completo no se
+ * escribe ningún byte y los n cuentan como descartados (una línea de
+ * texto llega entera o no llega).
+ * @return 0 si no había lugar para los n bytes
+ */
+uint8_t cola_spsc_poner_bloque(ColaSpsc *cola, const uint8_t *bytes, uint32_t n);
+
+/**
+ * @brief Productor: lugar libre (una foto: el consumidor puede estar sacando).
+ */
+uint32_t cola_spsc_libres(const ColaSpsc *cola);
+
+/**
+ * @brief Consumidor: saca el byte más viejo.
+ * @return El byte (0-255) o -1 si la cola está vacía
+ */
+int cola_spsc_sacar(ColaSpsc *cola);
+
+/**
+ * @brief Consumidor: bytes contiguos desde el más viejo, sin sacarlos.
+ *
+ * Se corta en el final del arreglo; lo que sigue aparece en la próxima
+ * llamada. Sirve para apuntarle el DMA directo a la cola.
+ * @param inicio Recibe la dirección del byte más viejo
+ * @return Cantidad de bytes contiguos (0 si la cola está vacía)
+ */
+uint32_t cola_spsc_tramo(const ColaSpsc *cola, const uint8_t **inicio);
+
+/**
+ * @brief Consumidor: da por leídos n bytes (n <= lo que devolvió cola_spsc_tramo).
+ */
+void cola_spsc_liberar(ColaSpsc *cola, uint32_t n);
+
+/**
+ * @brief Bytes en la cola (una foto: el productor puede estar agregando).
+ */
+uint32_t cola_spsc_ocupados(const ColaSpsc *cola);
+
+/**
+ * @brief Bytes descartados por cola llena desde la inicialización.
+ */
+uint32_t cola_spsc_descartados(const ColaSpsc *cola);
+
+/**
+ * @brief Mayor ocupación vista por el productor.
+ */
+uint32_t cola_spsc_maximo_ocupado(const ColaSpsc *cola);
+
+#endif // COLA_SPSC_H
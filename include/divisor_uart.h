@@ -0,0 +1,59 @@
+/**
+ * @file divisor_uart.h
+ * @brief Divisores de velocidad de las UART del LPC17xx (C puro).
+ *
+ * La velocidad que sale de una UART es
+ *
+ *   baudios = PCLK / (16 * (256 * DLM + DLL) * (1 + DIVADDVAL / MULVAL))
+ *
+ * Con solo DLM:DLL (FDR en 1/1) las velocidades altas quedan lejos: a
+ * 25 MHz, 115200 bps da 13.56, que truncado es 120192 bps (+4.3 %). El
+ * divisor fraccional (FDR) agrega el factor 1 + DIVADDVAL / MULVAL y
+ * divisor_uart_calcular() prueba las 120 combinaciones válidas para
+ * quedarse con la de menor error.
+ *
+ * Sin periféricos: tools/prueba_divisor_uart.c la prueba en la PC con
+ * todos los PCLK posibles de system_LPC17xx.c.
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef DIVISOR_UART_H
+#define DIVISOR_UART_H
+
+#include <stdint.h>
+
+/* Más allá de esto el bit de stop se corre de muestra: un receptor del otro
+   lado a la velocidad exacta ya no garantiza leer bien */
+#define DIVISOR_UART_ERROR_MAXIMO_PPM   20000   // 2 %
+
+/**
+ * @brief Valores para DLL/DLM/FDR y lo que se consigue con ellos
+ */
+typedef struct {
+    uint16_t divisor;           // DLM:DLL
+    uint8_t divaddval;          // FDR[3:0], menor que mulval
+    uint8_t mulval;             // FDR[7:4], 1 a 15
+    uint32_t baudios_reales;    // Redondeado al bps más cercano
+    int32_t error_ppm;          // (real - pedido) / pedido, en partes por millón
+} DivisorUart;
+
+/**
+ * @brief Busca DLL/DLM/DIVADDVAL/MULVAL con el menor error para una velocidad.
+ *
+ * Respeta las condiciones del manual: 1 <= MULVAL <= 15,
+ * DIVADDVAL < MULVAL y, con el divisor fraccional activo, DLM:DLL >= 3.
+ * Si hay empate gana la combinación sin divisor fraccional.
+ * @param pclk Reloj de la UART en Hz (CLKPWR_GetPCLK)
+ * @param baudios Velocidad pedida
+ * @return 0 si baudios es 0 o el mejor error supera
+ *         DIVISOR_UART_ERROR_MAXIMO_PPM (resultado no se toca)
+ */
+uint8_t divisor_uart_calcular(uint32_t pclk, uint32_t baudios, DivisorUart *resultado);
+
+/**
+ * @brief Valor para el registro FDR (MULVAL << 4 | DIVADDVAL).
+ */
+uint8_t divisor_uart_fdr(const DivisorUart *divisor);
+
+#endif // DIVISOR_UART_H
@@ -0,0 +1,170 @@
+/**
+ * @file espectador.h
+ * @brief Estado de los juegos por Bluetooth para un espectador remoto (C puro).
+ *
+ * En lugar de mandar la pantalla, la placa manda lo que cambió en cada tick
+ * y el espectador (tools/espectador_bt.c) lleva su propia copia del juego
+ * y dibuja la pantalla de 20x4 igual que la placa. Los registros de un
+ * tick viajan juntos en la carga de una trama PROTOCOLO_TIPO_JUEGO:
+ *
+ *   0x40 | dir | COMIO | CRECIO | COMIDA | VISTA   paso de la serpiente (1 byte,
+ *                                                  + x,y de comida y/o vista)
+ *   0x80 | altura | cuadro | DESPLAZO | obstáculo | PUNTO
+ *                                                  tick del Dino (1 byte)
+ *   FOTO_SERPIENTE, CUERPO, FOTO_DINO              estado completo
+ *   PAUSA, FIN                                     pantallas de texto
+ *
+ * Un paso de la serpiente es la dirección de la cabeza nueva; si no creció,
+ * el espectador suelta la cola que ya conoce. Por eso una trama perdida
+ * (salto de secuencia) deja la copia inservible hasta la próxima foto, que
+ * se pide con PROTOCOLO_TIPO_ESPECTADOR. La foto de la serpiente lleva el
+ * cuerpo como una dirección de 2 bits por segmento.
+ *
+ * Peor caso por tick: 10 bytes con trama y todo (paso con comida y vista
+ * nuevas), 6 en el Dino. A 20 Hz son 200 B/s, un 21 % de lo que deja
+ * pasar 9600 bps.
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef ESPECTADOR_H
+#define ESPECTADOR_H
+
+#include <stdint.h>
+#include "protocolo_bt.h"
+
+/* === REGISTROS === */
+#define ESPECTADOR_FOTO_SERPIENTE   0x01
+#define ESPECTADOR_CUERPO           0x02    // Direcciones de la foto de la serpiente
+#define ESPECTADOR_FOTO_DINO        0x03
+#define ESPECTADOR_PAUSA            0x04    // La serpiente escribió "PAUSA"
+#define ESPECTADOR_FIN              0x05    // Pantalla de Game Over
+#define ESPECTADOR_PASO_SERPIENTE   0x40    // 0x40 a 0x7F
+#define ESPECTADOR_TICK_DINO        0x80    // 0x80 a 0xFF
+
+/* === DIRECCIONES (mismo orden que Direccion en snake_game.c) === */
+#define ESPECTADOR_ARRIBA           0
+#define ESPECTADOR_ABAJO            1
+#define ESPECTADOR_IZQUIERDA        2
+#define ESPECTADOR_DERECHA          3
+
+/* === ESTADO DE LA PANTALLA EN UNA FOTO === */
+#define ESPECTADOR_JUGANDO          0
+#define ESPECTADOR_EN_PAUSA         1       // "PAUSA" visible hasta el próximo paso
+#define ESPECTADOR_TERMINADO        2       // Game Over en pantalla
+
+#define ESPECTADOR_SIN_COMIDA       0xFF    // Mundo lleno (POSICION_INVALIDA)
+#define ESPECTADOR_COLUMNAS_DINO    20
+#define ESPECTADOR_CUERPO_MAXIMO    176     // Direcciones por registro CUERPO (44 bytes)
+
+/**
+ * @brief Un movimiento de la serpiente
+ */
+typedef struct {
+    uint8_t direccion;          // ESPECTADOR_ARRIBA..DERECHA
+    uint8_t comio;
+    uint8_t crecio;             // Comió y no estaba en el largo máximo: la cola queda
+    uint8_t comida_movida;      // comida_x/y traen la comida nueva
+    uint8_t comida_x, comida_y;
+    uint8_t vista_movida;       // vista_x/y traen la esquina nueva de la vista
+    uint8_t vista_x, vista_y;
+} EspectadorPaso;
+
+/**
+ * @brief Un tick del Dino, con lo que muestra el cuadro que se dibuja después
+ */
+typedef struct {
+    uint8_t altura;             // 0 = suelo, 1 o 2 filas arriba
+    uint8_t cuadro;             // Cuadro de la animación (0 o 1)
+    uint8_t desplazo;           // Los obstáculos corrieron una columna
+    uint8_t obstaculo;          // Lo que entró por la columna 19 (0 a 3)
+    uint8_t punto;              // La puntuación subió uno
+} EspectadorTick;
+
+/**
+ * @brief Estado completo de la serpiente (seguido de registros CUERPO)
+ */
+typedef struct {
+    uint8_t ancho, alto;        // Mundo
+    uint8_t cabeza_x, cabeza_y;
+    uint8_t comida_x, comida_y;
+    uint8_t vista_x, vista_y;
+    uint16_t puntuacion;
+    uint16_t largo;
+    uint8_t estado;             // ESPECTADOR_JUGANDO / EN_PAUSA / TERMINADO
+} EspectadorFotoSerpiente;
+
+/**
+ * @brief Estado completo del Dino
+ */
+typedef struct {
+    uint8_t altura;
+    uint8_t cuadro;
+    uint16_t puntuacion;
+    uint32_t ticks;             // ticks_desde_inicio (el reloj de la pantalla)
+    uint8_t obstaculos[ESPECTADOR_COLUMNAS_DINO];
+    uint8_t estado;             // ESPECTADOR_JUGANDO / TERMINADO
+} EspectadorFotoDino;
+
+/**
+ * @brief Carga de una trama en construcción
+ */
+typedef struct {
+    uint8_t carga[PROTOCOLO_CARGA_MAXIMA];
+    uint8_t largo;
+} EspectadorTrama;
+
+/**
+ * @brief Un registro leído (solo vale el campo que corresponde a tipo)
+ */
+typedef struct {
+    uint8_t tipo;               // ESPECTADOR_PASO_SERPIENTE, ESPECTADOR_TICK_DINO, ...
+    EspectadorPaso paso;
+    EspectadorTick tick;
+    EspectadorFotoSerpiente foto_serpiente;
+    EspectadorFotoDino foto_dino;
+    uint16_t cuerpo_desde;      // Índice del segmento de la primera dirección
+    uint8_t cuerpo_cantidad;
+    uint8_t cuerpo[ESPECTADOR_CUERPO_MAXIMO];   // Del segmento i al i + 1 (hacia la cola)
+} EspectadorRegistro;
+
+/* === ESCRITURA (placa). Devuelven 0 si el registro no entra en la trama === */
+
+void espectador_iniciar_trama(EspectadorTrama *trama);
+uint8_t espectador_poner_paso(EspectadorTrama *trama, const EspectadorPaso *paso);
+uint8_t espectador_poner_tick(EspectadorTrama *trama, const EspectadorTick *tick);
+uint8_t espectador_poner_foto_serpiente(EspectadorTrama *trama, const EspectadorFotoSerpiente *foto);
+uint8_t espectador_poner_foto_dino(EspectadorTrama *trama, const EspectadorFotoDino *foto);
+uint8_t espectador_poner_marca(EspectadorTrama *trama, uint8_t tipo);  // PAUSA o FIN
+
+/**
+ * @brief Agrega un registro CUERPO con n direcciones (a lo sumo ESPECTADOR_CUERPO_MAXIMO).
+ * @param desde Índice (desde la cabeza) del segmento de direcciones[0]
+ */
+uint8_t espectador_poner_cuerpo(EspectadorTrama *trama, uint16_t desde,
+                                const uint8_t *direcciones, uint8_t n);
+
+/**
+ * @brief Cuántas direcciones entran en un registro CUERPO en lo que le queda a la trama.
+ */
+uint8_t espectador_lugar_cuerpo(const EspectadorTrama *trama);
+
+/**
+ * @brief Bytes en el enlace (tramas incluidas) de la foto de una serpiente de largo segmentos.
+ *
+ * Supone la foto armada como lo hace snake_game.c: FOTO_SERPIENTE y, en la
+ * misma trama y las siguientes, registros CUERPO tan largos como entren.
+ */
+uint32_t espectador_bytes_foto_serpiente(uint16_t largo);
+
+/* === LECTURA (espectador) === */
+
+/**
+ * @brief Lee el registro que empieza en carga[*posicion] y avanza *posicion.
+ * @return 1 si leyó uno; 0 al terminar la carga o si el registro está
+ *         incompleto o es desconocido (entonces *posicion != largo)
+ */
+uint8_t espectador_leer(const uint8_t *carga, uint8_t largo, uint8_t *posicion,
+                        EspectadorRegistro *registro);
+
+#endif // ESPECTADOR_H
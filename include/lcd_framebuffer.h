@@ -0,0 +1,100 @@
+/**
+ * @file lcd_framebuffer.h
+ * @brief Framebuffer en memoria (sombra) para el LCD 20x4 por I2C.
+ *
+ * Los juegos y el menú dibujan en un buffer de 20x4 caracteres en RAM y
+ * luego llaman a lcd_fb_volcar(). El módulo compara contra una copia de lo
+ * que el LCD muestra realmente y envía solo las celdas modificadas,
+ * agrupadas en tramos contiguos: el cursor se posiciona únicamente al
+ * comienzo de cada tramo.
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef LCD_FRAMEBUFFER_H
+#define LCD_FRAMEBUFFER_H
+
+#include <stdint.h>
+
+/* === DIMENSIONES === */
+#define LCD_FB_FILAS      4
+#define LCD_FB_COLUMNAS   20
+
+/**
+ * @brief Inicializa el framebuffer y borra el LCD.
+ *
+ * Llamar una vez después de lcd_inicializar().
+ */
+void lcd_fb_inicializar(void);
+
+/**
+ * @brief Escribe un carácter en el buffer (no envía nada al LCD).
+ * @param fila Fila (0 a 3)
+ * @param columna Columna (0 a 19)
+ * @param caracter Carácter a mostrar
+ */
+void lcd_fb_escribir_caracter(uint8_t fila, uint8_t columna, uint8_t caracter);
+
+/**
+ * @brief Escribe una cadena en el buffer a partir de (fila, columna).
+ *
+ * La cadena se recorta al llegar al final de la fila.
+ */
+void lcd_fb_escribir(uint8_t fila, uint8_t columna, const char *texto);
+
+/**
+ * @brief Rellena todo el buffer con espacios (no envía nada al LCD).
+ *
+ * Útil para redibujar un frame completo: solo las celdas que realmente
+ * cambien respecto de lo que muestra el LCD se enviarán en el volcado.
+ */
+void lcd_fb_limpiar(void);
+
+/**
+ * @brief Borra el LCD por hardware (comando 0x01) y sincroniza el buffer.
+ *
+ * Reemplaza a lcd_borrarPantalla() en todo el código que dibuja a través
+ * del framebuffer, para que la copia sombra no quede desincronizada.
+ */
+void lcd_fb_borrar_pantalla(void);
+
+/**
+ * @brief Envía al LCD las celdas modificadas desde el último volcado.
+ */
+void lcd_fb_volcar(void);
+
+/**
+ * @brief Marca todas las celdas como modificadas.
+ *
+ * Fuerza a que el próximo volcado reescriba la pantalla completa (por
+ * ejemplo, si alguien escribió en el LCD sin pasar por el framebuffer).
+ */
+void lcd_fb_invalidar(void);
+
+/**
+ * @brief Bytes I2C enviados durante el último lcd_fb_volcar().
+ * @return Cantidad de bytes PCF8574 puestos en el bus
+ */
+uint32_t lcd_fb_bytes_ultimo_volcado(void);
+
+/**
+ * @brief Obtiene el carácter de un glifo personalizado, cargándolo en CGRAM si hace falta.
+ *
+ * Los 8 slots de CGRAM funcionan como caché: si la clave ya está cargada
+ * se reutiliza; si no, se reemplaza el slot usado hace más tiempo entre los
+ * que no aparecen en el LCD ni en el buffer (cargar un slot cuesta 9 bytes
+ * al HD44780). Llamar antes de escribir el carácter devuelto con
+ * lcd_fb_escribir_caracter().
+ *
+ * @param clave Identificador del patrón (cualquier valor menor a 0xFFFF)
+ * @param patron 8 filas de 5 bits
+ * @return Carácter 0x08-0x0F a escribir, o 0 si los 8 slots están en uso
+ */
+uint8_t lcd_fb_glifo(uint16_t clave, const uint8_t patron[8]);
+
+/**
+ * @brief Cantidad de glifos cargados en CGRAM desde el arranque.
+ */
+uint32_t lcd_fb_cargas_cgram(void);
+
+#endif // LCD_FRAMEBUFFER_H
@@ -2,6 +2,10 @@
  * @file lcd_i2c.h
  * @brief header para controlar un display LCD basado mediante interfaz I2C..
  * Todas las funciones están diseñadas para facilitar el uso del LCD.
+ *
+ * Las escrituras no bloquean: se encolan y las transmite I2C0_IRQHandler.
+ * Solo el borrado de pantalla (y la inicialización) espera a que el bus se
+ * vacíe, porque el HD44780 necesita 1.52 ms para ejecutar el clear.
  */
 
 #ifndef LCD_I2C_H
@@ -75,4 +79,51 @@ void lcd_crear_caracter(uint8_t indice, const uint8_t patron[8]);
  */
 void lcd_escribir_byte(uint8_t caracter);
 
+/**
+ * @brief Comienza a agrupar operaciones en una sola transacción I2C.
+ *
+ * Hasta el lcd_terminar_lote() correspondiente, los comandos y caracteres se
+ * acumulan en un buffer y salen juntos con una única fase de dirección.
+ * Admite anidamiento; el lote se envía al cerrar el más externo (o antes si
+ * se llena el buffer interno).
+ */
+void lcd_iniciar_lote(void);
+
+/**
+ * @brief Termina un lote iniciado con lcd_iniciar_lote() y lo envía.
+ */
+void lcd_terminar_lote(void);
+
+/**
+ * @brief Indica si terminó de transmitirse todo lo encolado.
+ * @return 1 si la cola está vacía y el bus libre, 0 si hay bytes pendientes
+ */
+uint8_t lcd_transmision_completa(void);
+
+/**
+ * @brief Bloquea hasta que todo lo encolado haya salido por el bus.
+ */
+void lcd_esperar_transmision(void);
+
+/**
+ * @brief Máxima ocupación alcanzada por la cola de transmisión.
+ * @return High-water mark en bytes PCF8574 (la cola tiene 1024)
+ */
+uint16_t lcd_cola_maximo_ocupado(void);
+
+/**
+ * @brief Contador de bytes I2C (PCF8574) encolados hacia el LCD desde el arranque.
+ *
+ * Cada carácter o comando cuesta 6 bytes. Restando dos lecturas se obtiene
+ * el costo en bus de un frame.
+ * @return Total de bytes enviados
+ */
+uint32_t lcd_obtener_bytes_enviados(void);
+
+/**
+ * @brief Contador de transacciones I2C (START..STOP) hacia el LCD.
+ * @return Total de transacciones desde el arranque
+ */
+uint32_t lcd_obtener_transacciones_i2c(void);
+
 #endif // LCD_I2C_H
\ No newline at end of file
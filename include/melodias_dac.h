@@ -6,13 +6,16 @@
  *
  * Hardware requerido:
  * - P0.26: Salida DAC (AOUT)
- * - P0.22: LED indicador de actividad (opcional)
+ * - P0.22: LED indicador de actividad (encendido mientras suena una nota)
  *
  * Uso básico:
  * 1. Llamar melodias_init() al inicio del programa
  * 2. Llamar melodias_iniciar(melodia) para comenzar a tocar
- * 3. Llamar melodias_actualizar() en el loop principal
+ * 3. Llamar melodias_actualizar() en el loop principal (solo el LED: las
+ *    notas avanzan en la ISR de Timer1)
  * 4. Verificar melodias_esta_sonando() para saber si hay audio
+ * 5. Llamar melodias_efecto(efecto) para tocar un efecto encima de la música
+ * 6. Llamar melodias_clip_reproducir(&clips_pcm[CLIP_...]) para un sample PCM
  *
  * @date Noviembre 2025
  */
@@ -22,6 +25,18 @@
 
 #include <stdint.h>
 
+/* ========================== MOTOR DE AUDIO ================================ */
+
+// Frecuencia de muestreo fija del oscilador DDS (DACCNTVAL = PCLK_DAC / este valor)
+#define MELODIAS_FRECUENCIA_MUESTREO_HZ  20000
+
+// Muestras por bloque: una interrupción de DMA cada 64 / 20 kHz = 3.2 ms (312 Hz)
+#define MELODIAS_MUESTRAS_BLOQUE         64
+
+// Voces del mezclador: la 0 es la música, el resto toca efectos encima
+#define MELODIAS_VOCES                   4
+#define MELODIAS_VOZ_MUSICA              0
+
 /* ========================== DEFINICIONES DE NOTAS ========================= */
 
 // Frecuencias de notas musicales (en Hz) - Escala temperada
@@ -66,40 +81,153 @@
 
 #define SILENCIO 0
 
-// Duraciones de notas (en milisegundos)
-#define REDONDA      2000
-#define BLANCA       1000
-#define NEGRA        500
-#define CORCHEA      250
-#define SEMICORCHEA  125
+/* ===================== FORMATO DE CANCIÓN COMPILADA ====================== */
+
+/*
+ * Una canción es un arreglo de bytes generado por tools/compilador_canciones.c
+ * (a partir de texto o MIDI):
+ *
+ *   [0] tempo en negras por minuto (una semicorchea = 15000 / tempo ms)
+ *   [1] envolvente inicial (MELODIAS_ENV_*)
+ *   [2..] eventos, uno por byte:
+ *     0..CANCION_EVENTOS-1    nota + duración: CANCION_EVENTO(nota, codigo)
+ *     CANCION_LIGAR + n       prolonga la nota anterior n+1 semicorcheas (n = 0..15)
+ *     CANCION_ENVOLVENTE + k  envolvente k para las notas siguientes
+ *     CANCION_FORMA + k       forma de onda k (MELODIAS_FORMA_*) para las notas siguientes
+ *     CANCION_MARCA_LOOP      en loop, al llegar al fin se vuelve acá
+ *     CANCION_FIN
+ *
+ * La nota es un índice en CANCION_LISTA_NOTAS (0 = SILENCIO) y la duración
+ * un código 0..5 = 1, 2, 3, 4, 6 u 8 semicorcheas (CANCION_SEMICORCHEAS).
+ * Cada evento de nota se decodifica con una sola lectura de tabla.
+ */
+#define CANCION_LISTA_NOTAS(X, arg) \
+    X(SILENCIO, arg) \
+    X(DO_3, arg) X(DO_S3, arg) X(RE_3, arg) X(RE_S3, arg) X(MI_3, arg) X(FA_3, arg) \
+    X(FA_S3, arg) X(SOL_3, arg) X(SOL_S3, arg) X(LA_3, arg) X(LA_S3, arg) X(SI_3, arg) \
+    X(DO_4, arg) X(DO_S4, arg) X(RE_4, arg) X(RE_S4, arg) X(MI_4, arg) X(FA_4, arg) \
+    X(FA_S4, arg) X(SOL_4, arg) X(SOL_S4, arg) X(LA_4, arg) X(LA_S4, arg) X(SI_4, arg) \
+    X(DO_5, arg) X(DO_S5, arg) X(RE_5, arg) X(RE_S5, arg) X(MI_5, arg) X(FA_5, arg) \
+    X(FA_S5, arg) X(SOL_5, arg) X(SOL_S5, arg) X(LA_5, arg) X(LA_S5, arg) X(SI_5, arg)
+
+#define CANCION_NOTAS                37
+#define CANCION_DURACIONES           6
+#define CANCION_SEMICORCHEAS(c)      ((c) < 4 ? (c) + 1 : ((c) - 1) * 2)
+#define CANCION_EVENTOS              (CANCION_NOTAS * CANCION_DURACIONES)
+#define CANCION_EVENTO(nota, codigo) ((uint8_t)((codigo) * CANCION_NOTAS + (nota)))
+
+#define CANCION_LIGAR                0xE0
+#define CANCION_ENVOLVENTE           0xF0
+#define CANCION_FORMA                0xF4
+#define CANCION_MARCA_LOOP           0xFE
+#define CANCION_FIN                  0xFF
+#define CANCION_BYTES_CABECERA       2
+
+// Envolventes predefinidas (k de CANCION_ENVOLVENTE + k)
+#define MELODIAS_ENV_LEGATO          0   // Plena, 30 ms de liberación (la articulación de antes)
+#define MELODIAS_ENV_PERCUSIVA       1   // Golpe y caída al 40%
+#define MELODIAS_ENV_SUAVE           2   // Entrada y salida lentas
+#define MELODIAS_ENV_EFECTO          3   // Sin ataque, corte casi seco
+#define MELODIAS_ENVOLVENTES         4
+
+/* ========================== FORMAS DE ONDA ================================= */
+
+// Formas de onda (k de CANCION_FORMA + k); tablas en src/formas_onda.c
+#define MELODIAS_FORMA_TRIANGULAR    0   // La de siempre: cada voz arranca con esta
+#define MELODIAS_FORMA_SENO          1
+#define MELODIAS_FORMA_SIERRA        2
+#define MELODIAS_FORMA_CUADRADA_50   3
+#define MELODIAS_FORMA_CUADRADA_25   4   // Pulso: ciclo de trabajo 25%
+#define MELODIAS_FORMA_CUADRADA_12   5   // Pulso: ciclo de trabajo 12.5%
+#define MELODIAS_FORMA_RUIDO         6   // 256 muestras aleatorias: ruido con altura
+#define MELODIAS_FORMAS              7
+
+/*
+ * Cada forma tiene una tabla de 256 muestras int8_t por octava de
+ * CANCION_LISTA_NOTAS (banda 0 = octava 3). Las tablas tienen solo los
+ * armónicos que quedan por debajo de MELODIAS_FRECUENCIA_MUESTREO_HZ / 2
+ * para la nota más aguda de su octava, así que no hay aliasing. Se generan
+ * en la PC con tools/generador_formas.c; las formas que no dependen de la
+ * altura (seno, ruido) repiten el mismo puntero en las tres bandas.
+ */
+#define MELODIAS_BANDAS_FORMA        3
+#define MELODIAS_MUESTRAS_FORMA      256
+
+extern const int8_t *const formas_onda[MELODIAS_FORMAS][MELODIAS_BANDAS_FORMA];
 
-/* ========================== ESTRUCTURA DE NOTA ============================ */
+/* ========================== CLIPS PCM ====================================== */
+
+// Muestras de un clip, a MELODIAS_FRECUENCIA_MUESTREO_HZ (tools/convertidor_wav.c)
+#define CLIP_PCM_8                   1   // uint8_t: valor DAC >> 2, escrito en el byte 1 de DACR
+#define CLIP_PCM_10                  2   // uint16_t: valor DAC << 6, escrito en la mitad baja de DACR
+
+/* ========================== ESTRUCTURAS ==================================== */
+
+/**
+ * @brief Entrada del índice de clips PCM (el arreglo clips_pcm[] de clips_pcm.h)
+ *
+ * Las muestras quedan en flash tal como las escribe el DMA en DACR: el
+ * clip se reproduce sin que la CPU copie nada.
+ */
+typedef struct {
+    const void *muestras;           // En flash
+    uint32_t cantidad;              // Muestras (a 20 kHz)
+    uint8_t formato;                // CLIP_PCM_8 o CLIP_PCM_10
+} ClipPCM;
+
+/**
+ * @brief Estado de la reproducción de clips PCM
+ */
+typedef struct {
+    uint32_t reproducidos;          // Cadenas de clips que llegaron a sonar
+    uint32_t huecos;                // Underruns: un clip encolado no pudo seguir al anterior sin pausa
+    uint32_t rechazados;            // Sin lugar en la cola o en los descriptores
+    uint8_t en_cola;                // Clips esperando el próximo bloque
+} MelodiasEstadisticasClips;
+
+/**
+ * @brief Costo del mezclador (ciclos de CPU medidos con el DWT)
+ */
+typedef struct {
+    uint32_t bloques;               // Bloques mezclados desde el inicio
+    uint32_t ciclos_ultimo_bloque;
+    uint32_t ciclos_peor_bloque;
+    uint32_t ciclos_presupuesto;    // Ciclos de CPU que dura un bloque en tiempo real
+    uint32_t muestras_saturadas;    // Muestras recortadas a 0 o 1023
+    uint32_t bloques_tarde;         // Underruns: la ISR llegó con el DMA ya en ese bloque
+    uint8_t voces_activas;          // Voces con nota en este momento
+} MelodiasEstadisticasMezcla;
 
 /**
- * @brief Estructura que define una nota musical
- * @param frecuencia Frecuencia en Hz (0 = silencio)
- * @param duracion Duración en milisegundos
+ * @brief Jitter del secuenciador: atraso entre el instante programado de
+ *        una nota y su disparo real en la ISR de Timer1
+ * @note Solo cuenta notas encadenadas por el secuenciador (no la primera
+ *       de cada melodias_iniciar()). El mezclador aplica el cambio al
+ *       comienzo del bloque siguiente (hasta 3.2 ms más, fijo)
  */
 typedef struct {
-    uint16_t frecuencia;
-    uint16_t duracion;
-} Nota;
+    uint32_t notas;                 // Notas secuenciadas desde el último reinicio
+    uint32_t error_maximo_us;
+    uint32_t error_promedio_us;
+    uint32_t notas_tarde;           // Disparadas en un tick posterior al programado
+} MelodiasEstadisticasSecuenciador;
 
 /* ============================= MELODÍAS ===================================== */
 
-// Melodías predefinidas (terminan con {SILENCIO, 0})
-extern const Nota melodia_happy_birthday[];
-extern const Nota melodia_mario[];
-extern const Nota melodia_tetris[];
-extern const Nota melodia_nokia[];
-extern const Nota melodia_game_over[];  // Melodía corta para game over
-extern const Nota melodia_salto[];      // Efecto de sonido para salto
-extern const Nota melodia_fondo[];      // Melodía de fondo larga (tipo Mario Bros)
+// Melodías predefinidas: canciones compiladas en src/canciones.c
+// (fuente: tools/canciones.txt)
+extern const uint8_t melodia_happy_birthday[];
+extern const uint8_t melodia_mario[];
+extern const uint8_t melodia_tetris[];
+extern const uint8_t melodia_nokia[];
+extern const uint8_t melodia_game_over[];  // Melodía corta para game over
+extern const uint8_t melodia_salto[];      // Efecto de sonido para salto
+extern const uint8_t melodia_fondo[];      // Melodía de fondo larga (tipo Mario Bros)
 
 /* ==================== FUNCIONES PÚBLICAS ================================== */
 
 /**
- * @brief Inicializa el sistema de melodías (DAC + Timer0 + GPIO)
+ * @brief Inicializa el sistema de melodías (DAC + DMA + Timer1 + GPIO)
  * @note Debe llamarse una vez al inicio del programa, antes de usar melodías
  * @note Configura P0.26 como AOUT y P0.22 como GPIO para LED
  */
@@ -107,36 +235,47 @@ void melodias_inicializar(void);
 
 /**
  * @brief Inicia la reproducción de una melodía de forma no bloqueante
- * @param melodia Puntero al arreglo de notas (debe terminar con {SILENCIO, 0})
+ * @param melodia Canción compilada (cabecera + eventos, termina en CANCION_FIN)
  * @note La melodía se reproduce en segundo plano usando interrupciones
- * @note Si hay una melodía sonando, esta se detiene y empieza la nueva
+ * @note Usa la voz de música: si había una melodía (o un loop), la reemplaza.
+ *       Para sonar encima de la música usar melodias_efecto()
  */
-void melodias_iniciar(const Nota *melodia);
+void melodias_iniciar(const uint8_t *melodia);
 
 /**
  * @brief Inicia una melodía en modo loop continuo (música de fondo)
- * @param melodia Puntero al arreglo de notas (debe terminar con {SILENCIO, 0})
- * @note La melodía se repite automáticamente al terminar
+ * @param melodia Canción compilada (cabecera + eventos, termina en CANCION_FIN)
+ * @note Al terminar vuelve a CANCION_MARCA_LOOP (o al principio si no hay
+ *       marca): lo anterior a la marca suena una sola vez, como intro
  * @note Ideal para música de fondo en juegos
  */
-void melodias_iniciar_loop(const Nota *melodia);
+void melodias_iniciar_loop(const uint8_t *melodia);
+
+/**
+ * @brief Toca un efecto una vez en una voz de efectos, sin cortar la música
+ * @param efecto Canción compilada (cabecera + eventos, termina en CANCION_FIN)
+ * @note Si todas las voces de efectos están ocupadas, reemplaza la que
+ *       empezó hace más tiempo
+ */
+void melodias_efecto(const uint8_t *efecto);
 
 /**
- * @brief Detiene la reproducción de la melodía actual
- * @note Silencia el DAC y limpia el estado interno
+ * @brief Detiene la música y todos los efectos
+ * @note El DAC queda en el punto medio y el estado interno limpio
  */
 void melodias_detener(void);
 
 /**
- * @brief Actualiza el estado de la melodía (avanza notas si es necesario)
- * @note DEBE llamarse continuamente en el while(1) del main
+ * @brief Actualiza el LED indicador según las voces que suenan
+ * @note Las notas ya no dependen de esta llamada: el secuenciador corre en
+ *       la ISR de Timer1 y sigue a tiempo aunque el loop principal se demore
  * @note Es NO BLOQUEANTE - retorna inmediatamente
  */
 void melodias_actualizar(void);
 
 /**
  * @brief Verifica si hay una melodía activa en reproducción
- * @return 1 si hay una melodía sonando, 0 si no
+ * @return 1 si alguna voz (música o efecto) tiene una melodía, 0 si no
  * @note Retorna 1 incluso durante pausas entre notas de la misma melodía
  */
 uint8_t melodias_esta_sonando(void);
@@ -155,4 +294,70 @@ uint32_t melodias_obtener_tiempo_ms(void);
  */
 void melodias_establecer_volumen(uint8_t volumen_porcentaje);
 
+/**
+ * @brief Configura el volumen de una voz del mezclador (0-100)
+ * @param voz Índice de voz (MELODIAS_VOZ_MUSICA o un efecto, < MELODIAS_VOCES)
+ * @param volumen_porcentaje Porcentaje de volumen de esa voz
+ * @note La suma de voces se satura a 0..1023 (ver muestras_saturadas)
+ */
+void melodias_establecer_volumen_voz(uint8_t voz, uint8_t volumen_porcentaje);
+
+/**
+ * @brief Forma de onda con la que arranca una voz cada canción o efecto
+ * @param forma MELODIAS_FORMA_* (la canción la puede cambiar con CANCION_FORMA)
+ * @note Toma efecto en la próxima canción o efecto de esa voz; por defecto
+ *       MELODIAS_FORMA_TRIANGULAR
+ */
+void melodias_establecer_forma_voz(uint8_t voz, uint8_t forma);
+
+/**
+ * @brief Copia el costo de CPU del mezclador
+ * @note ciclos_peor_bloque / ciclos_presupuesto es la carga de pico del audio
+ */
+void melodias_obtener_estadisticas_mezcla(MelodiasEstadisticasMezcla *estadisticas);
+
+/**
+ * @brief Copia el jitter de inicio de nota (máximo y promedio, en µs)
+ */
+void melodias_obtener_estadisticas_secuenciador(MelodiasEstadisticasSecuenciador *estadisticas);
+
+/**
+ * @brief Pone en cero el jitter acumulado (por ejemplo, al cambiar de juego)
+ */
+void melodias_reiniciar_estadisticas_secuenciador(void);
+
+/**
+ * @brief Corta lo que haya de clips y reproduce este lo antes posible
+ * @return 0 si el clip no es válido o no hay descriptores libres
+ * @note Mientras suena un clip el DMA lee directo de flash y el mezclador
+ *       no corre: la música y los efectos se callan hasta que termina
+ */
+uint8_t melodias_clip_reproducir(const ClipPCM *clip);
+
+/**
+ * @brief Agrega un clip después de los que ya están sonando o en cola
+ * @return 0 si la cola está llena
+ * @note Si el DMA ya está en el último tramo del clip anterior, el nuevo
+ *       arranca después de un bloque de música y se cuenta un hueco
+ */
+uint8_t melodias_clip_encolar(const ClipPCM *clip);
+
+/**
+ * @brief Vacía la cola y corta el clip actual (<= 100 ms)
+ * @note El DMA ya cargó el tramo siguiente y ese no se puede redirigir:
+ *       suenan el tramo en curso y el próximo (dos tramos de 50 ms). Si el
+ *       clip todavía no empezó, su primer tramo suena igual
+ */
+void melodias_clip_detener(void);
+
+/**
+ * @return 1 si hay un clip sonando o esperando en la cola
+ */
+uint8_t melodias_clip_sonando(void);
+
+/**
+ * @brief Copia los contadores de clips (incluidos los huecos)
+ */
+void melodias_obtener_estadisticas_clips(MelodiasEstadisticasClips *estadisticas);
+
 #endif /* MELODIAS_DAC_H */
@@ -0,0 +1,119 @@
+/**
+ * @file mezclador_audio.h
+ * @brief Osciladores DDS y mezcla de voces por bloques, sin hardware.
+ *
+ * Es el núcleo de síntesis de melodias_dac.c, separado para poder
+ * compilarlo y medirlo en la PC (tools/prueba_mezclador.c). No toca
+ * registros: recibe incrementos de fase y volúmenes, y devuelve bloques
+ * de MELODIAS_MUESTRAS_BLOQUE palabras en formato DACR.
+ *
+ * Cada voz tiene su propia tabla de 256 muestras: su forma de onda (int8_t
+ * en flash) escalada por volumen_voz x volumen_maestro. Se reconstruye solo
+ * cuando cambia alguno de ellos o la forma. La envolvente avanza una vez
+ * por bloque y se aplica en la mezcla: por muestra hay una lectura de
+ * tabla, un producto por el nivel y una suma.
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef MEZCLADOR_AUDIO_H
+#define MEZCLADOR_AUDIO_H
+
+#include <stdint.h>
+#include "melodias_dac.h"   // MELODIAS_VOCES, MELODIAS_MUESTRAS_BLOQUE, frecuencia de muestreo
+
+/* === CONFIGURACIÓN === */
+#define MEZCLADOR_BITS_TABLA      8
+#define MEZCLADOR_TAMANO_TABLA    (1 << MEZCLADOR_BITS_TABLA)
+#define MEZCLADOR_MAXIMO_DAC      1023
+#define MEZCLADOR_MEDIO_DAC       512     // Reposo: las voces suman alrededor de acá
+
+/* Mismo formato que DAC_VALUE() de lpc17xx_dac.h (valor en bits 15:6) */
+#define MEZCLADOR_VALOR_DACR(n)   ((uint32_t)(((n) & 0x3FF) << 6))
+
+/**
+ * @brief Envolvente ADSR de una nota (tiempos en ms, resolución de un bloque)
+ */
+typedef struct {
+    uint16_t ataque_ms;             // De 0 al 100%
+    uint16_t decaimiento_ms;        // Del 100% al sostenido
+    uint8_t sostenido_porcentaje;   // Nivel mientras dura la nota
+    uint16_t liberacion_ms;         // Del nivel actual a 0 después de mezclador_liberar()
+} EnvolventeADSR;
+
+/**
+ * @brief Deja todas las voces en silencio con la misma forma de onda.
+ * @param forma Un período de 256 muestras centradas en cero (±127 = pleno)
+ * @note Volúmenes iniciales: 100% en todas las voces y en el maestro, y
+ *       envolvente sostenida al 100% (mezclador_establecer_incremento() suena
+ *       a nivel pleno hasta el primer mezclador_disparar())
+ */
+void mezclador_inicializar(const int8_t *forma);
+
+/**
+ * @brief Cambia la forma de onda de una voz (256 muestras, ±127).
+ *
+ * Solo guarda el puntero: la tabla de la voz se rehace en la etapa de
+ * control del próximo bloque, así que se puede llamar en cada nota.
+ * @note La tabla tiene que seguir existiendo mientras la voz la use (flash)
+ */
+void mezclador_establecer_forma(uint8_t voz, const int8_t *forma);
+
+/**
+ * @brief Incremento de fase de 32 bits para una frecuencia (redondeado).
+ * @return 2^32 * f / MELODIAS_FRECUENCIA_MUESTREO_HZ
+ */
+uint32_t mezclador_incremento_fase(uint16_t frecuencia_hz);
+
+/**
+ * @brief Fija el incremento de fase de una voz (0 = silencio inmediato).
+ * @note No toca la envolvente
+ */
+void mezclador_establecer_incremento(uint8_t voz, uint32_t incremento);
+
+/**
+ * @brief Empieza una nota con envolvente: ataque, decaimiento y sostenido.
+ *
+ * Si la voz estaba en silencio el ataque arranca desde 0; si venía sonando
+ * arranca desde el nivel actual (sin clic entre notas ligadas).
+ * @note Igual que los volúmenes, no se debe llamar mientras corre
+ *       mezclador_renderizar() (en la placa: con la IRQ de DMA enmascarada)
+ */
+void mezclador_disparar(uint8_t voz, uint32_t incremento, const EnvolventeADSR *envolvente);
+
+/**
+ * @brief Pasa la nota a la etapa de liberación; al llegar a 0 la voz se silencia.
+ */
+void mezclador_liberar(uint8_t voz);
+
+/**
+ * @return 1 si la voz tiene un incremento distinto de cero
+ */
+uint8_t mezclador_voz_activa(uint8_t voz);
+
+/**
+ * @brief Volumen de una voz (0-100). Reconstruye la tabla de esa voz.
+ */
+void mezclador_establecer_volumen_voz(uint8_t voz, uint8_t volumen_porcentaje);
+
+/**
+ * @brief Volumen maestro (0-100). Reconstruye las tablas de todas las voces.
+ */
+void mezclador_establecer_volumen_maestro(uint8_t volumen_porcentaje);
+
+/**
+ * @brief Produce un bloque de MELODIAS_MUESTRAS_BLOQUE palabras DACR.
+ *
+ * Trabajo acotado: a lo sumo MELODIAS_VOCES x MELODIAS_MUESTRAS_BLOQUE
+ * lecturas de tabla, productos por la envolvente y sumas, más la
+ * saturación. Las voces en silencio no cuestan. La envolvente no rehace
+ * tablas: solo un cambio de forma suma 256 productos a ese bloque.
+ */
+void mezclador_renderizar(uint32_t *destino);
+
+/**
+ * @return Muestras recortadas a 0 o 1023 desde el inicio
+ */
+uint32_t mezclador_obtener_saturadas(void);
+
+#endif // MEZCLADOR_AUDIO_H
@@ -0,0 +1,102 @@
+/**
+ * @file perfil_isr.h
+ * @brief Contabilidad de ciclos por interrupción con el contador DWT.
+ *
+ * Cada ISR instrumentada llama perfil_isr_entrar() al comenzar y
+ * perfil_isr_salir() al terminar. Por ISR se acumulan las entradas, los
+ * ciclos totales y la peor duración. Los ciclos son exclusivos: si una
+ * ISR de mayor prioridad la interrumpe (GPDMA sobre TIMER1, por ejemplo),
+ * ese tiempo se descuenta y queda solo en la que interrumpió, así que las
+ * cargas se pueden sumar.
+ *
+ * perfil_isr_volcar() arma una tabla de texto con la carga de cada ISR
+ * sobre la ventana medida; main.c la manda por Bluetooth con el comando 'I'.
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef PERFIL_ISR_H
+#define PERFIL_ISR_H
+
+#include <stdint.h>
+#include "LPC17xx.h"    // CoreDebug (PERFIL_HABILITAR_DWT)
+
+/* === CONTADOR DE CICLOS (DWT, no está en este core_cm3.h) ===
+   El simulador de tools/simulador/ trae los suyos en su LPC17xx.h */
+#ifndef PERFIL_DWT_CTRL
+#define PERFIL_DWT_CTRL            (*(volatile uint32_t *)0xE0001000)
+#define PERFIL_DWT_CYCCNT          (*(volatile uint32_t *)0xE0001004)
+#endif
+#define PERFIL_DWT_CTRL_CYCCNTENA  (1UL << 0)
+
+/* Habilita el contador sin reiniciarlo (puede haber una medición en curso) */
+#define PERFIL_HABILITAR_DWT()  do { \
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
+        PERFIL_DWT_CTRL |= PERFIL_DWT_CTRL_CYCCNTENA; \
+    } while (0)
+
+/* === INTERRUPCIONES MEDIDAS === */
+typedef enum {
+    PERFIL_ISR_GPDMA = 0,       // Bloques de audio y clips (prioridad 1)
+    PERFIL_ISR_TIMER1,          // Secuenciador de notas (prioridad 2)
+    PERFIL_ISR_SYSTICK,         // Planificador de los juegos (prioridad 3)
+    PERFIL_ISR_I2C0,            // Volcado del LCD (prioridad 3)
+    PERFIL_ISR_UART0,           // Recepción Bluetooth (prioridad 3)
+    PERFIL_ISR_CANTIDAD
+} PerfilIsr;
+
+/**
+ * @brief Lo que perfil_isr_entrar() anota para perfil_isr_salir()
+ */
+typedef struct {
+    uint32_t inicio;            // DWT al entrar
+    uint32_t anidados;          // Ciclos de otras ISR ya contados al entrar
+} PerfilMarca;
+
+/**
+ * @brief Contadores de una ISR desde el último reinicio
+ */
+typedef struct {
+    uint32_t entradas;
+    uint64_t ciclos_total;      // Exclusivos: sin las ISR que la interrumpieron
+    uint32_t ciclos_peor;
+} PerfilIsrEstadisticas;
+
+/**
+ * @brief Habilita el DWT y pone los contadores en cero.
+ * @note Llamar después de planificador_inicializar() (la ventana se mide en ms)
+ */
+void perfil_isr_inicializar(void);
+
+/**
+ * @brief Marca el comienzo de una ISR (primera línea del handler).
+ */
+void perfil_isr_entrar(PerfilMarca *marca);
+
+/**
+ * @brief Cierra la medición de una ISR (última línea del handler).
+ */
+void perfil_isr_salir(PerfilIsr isr, const PerfilMarca *marca);
+
+/**
+ * @brief Copia los contadores de una ISR.
+ */
+void perfil_isr_obtener(PerfilIsr isr, PerfilIsrEstadisticas *estadisticas);
+
+/**
+ * @brief Pone los contadores en cero y empieza una ventana nueva.
+ */
+void perfil_isr_reiniciar(void);
+
+/**
+ * @brief Escribe la tabla de cargas, una línea por llamada a escribir().
+ *
+ * Por ISR: entradas, ciclos promedio y peor, y carga en % de la CPU sobre
+ * la ventana. Al final, la carga del audio (GPDMA + TIMER1) y la total, y
+ * una línea por tarea del planificador (ejecuciones, liberaciones perdidas,
+ * plazos incumplidos y peor latencia).
+ * @param escribir Por ejemplo bt_escribir_cadena
+ */
+void perfil_isr_volcar(void (*escribir)(const char *cadena));
+
+#endif // PERFIL_ISR_H
@@ -0,0 +1,89 @@
+/**
+ * @file planificador.h
+ * @brief Planificador de tareas periódicas sobre SysTick (tick de 1 ms)
+ *
+ * Reemplaza a los timers que cada juego configuraba por su cuenta (TIMER2
+ * para Dino, TIMER3 para Snake y TIMER0 en main). Cada módulo crea una
+ * tarea con su período y su plazo; la ISR de SysTick solo marca las tareas
+ * que vencen y el bucle principal las consume con planificador_tarea_lista().
+ *
+ * Por cada tarea se cuentan:
+ * - Liberaciones perdidas (overrun): el período volvió a vencer antes de
+ *   que el bucle principal atendiera la liberación anterior.
+ * - Plazos incumplidos: la tarea se atendió más tarde que su plazo.
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef PLANIFICADOR_H
+#define PLANIFICADOR_H
+
+#include <stdint.h>
+
+/* === CONFIGURACIÓN === */
+#define PLANIFICADOR_MAX_TAREAS   8
+#define PLANIFICADOR_SIN_TAREA    0xFF    // Valor inicial para los identificadores de tarea
+
+/**
+ * @brief Estadísticas de una tarea
+ */
+typedef struct {
+    uint32_t ejecuciones;        // Liberaciones atendidas
+    uint32_t perdidas;           // Overruns: liberaciones que pisaron una pendiente
+    uint32_t plazos_incumplidos; // Atendidas después de su plazo
+    uint16_t peor_latencia_ms;   // Mayor demora entre liberación y atención
+    uint16_t periodo_ms;
+    uint8_t activa;              // 0 si está detenida
+} PlanificadorEstadisticas;
+
+/**
+ * @brief Configura SysTick a 1 ms y habilita su interrupción.
+ * @note Llamar una vez al inicio del programa, después de SystemInit()
+ */
+void planificador_inicializar(void);
+
+/**
+ * @brief Crea (o reinicia) una tarea periódica.
+ *
+ * Si *id ya tiene una tarea, se reinician su fase y sus estadísticas, de
+ * modo que volver a entrar a un juego no consume slots nuevos ni arrastra
+ * los contadores de la partida anterior.
+ *
+ * @param id Identificador de la tarea (iniciar en PLANIFICADOR_SIN_TAREA)
+ * @param periodo_ms Período de liberación en milisegundos (> 0)
+ * @param plazo_ms Demora máxima aceptable para atenderla (0 = igual al período)
+ * @return 1 si la tarea quedó activa, 0 si no hay slots libres
+ */
+uint8_t planificador_crear_tarea(uint8_t *id, uint16_t periodo_ms, uint16_t plazo_ms);
+
+/**
+ * @brief Detiene una tarea (deja de liberarse hasta volver a crearla).
+ *
+ * Los juegos detienen su tick al terminar: una tarea que nadie atiende
+ * sumaría liberaciones perdidas mientras se está en el menú.
+ */
+void planificador_detener_tarea(uint8_t id);
+
+/**
+ * @brief Consume la liberación pendiente de una tarea.
+ *
+ * Llamar desde el bucle principal. Actualiza latencia y plazos.
+ *
+ * @return 1 si la tarea estaba lista (y hay que ejecutarla), 0 si no
+ */
+uint8_t planificador_tarea_lista(uint8_t id);
+
+/**
+ * @brief Copia las estadísticas de una tarea.
+ *
+ * perfil_isr_volcar() recorre los id desde 0 hasta que esta devuelve 0.
+ * @return 1 si id es una tarea creada, 0 si no (no toca *estadisticas)
+ */
+uint8_t planificador_obtener_estadisticas(uint8_t id, PlanificadorEstadisticas *estadisticas);
+
+/**
+ * @brief Milisegundos desde planificador_inicializar().
+ */
+uint32_t planificador_obtener_ms(void);
+
+#endif // PLANIFICADOR_H
@@ -0,0 +1,162 @@
+/**
+ * @file protocolo_bt.h
+ * @brief Tramas binarias del enlace Bluetooth (C puro, sin periféricos).
+ *
+ * Formato de una trama (todo en little-endian):
+ *
+ *   0xA5 | tipo | secuencia | largo | carga (largo bytes) | CRC-8
+ *
+ * El CRC-8 (polinomio 0x07, valor inicial 0) cubre desde el tipo hasta el
+ * último byte de la carga. Los bytes que no forman parte de una trama
+ * (las letras W/A/S/D/B/I de una terminal, el texto que manda la placa)
+ * salen como "sueltos", así que texto y tramas comparten el enlace.
+ *
+ * El receptor se resincroniza solo: si el largo es imposible o el CRC no
+ * coincide, descarta únicamente el 0xA5 inicial y vuelve a analizar lo que
+ * ya tenía guardado, de modo que una trama buena pegada a basura no se
+ * pierde.
+ *
+ * Lo usan bluetooth_uart.c en la placa y tools/cliente_bt.c en la PC.
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef PROTOCOLO_BT_H
+#define PROTOCOLO_BT_H
+
+#include <stdint.h>
+
+/* === FORMATO === */
+#define PROTOCOLO_SINCRONISMO     0xA5
+#define PROTOCOLO_CABECERA        4       // Sincronismo, tipo, secuencia, largo
+#define PROTOCOLO_CARGA_MAXIMA    48
+#define PROTOCOLO_TRAMA_MAXIMA    (PROTOCOLO_CABECERA + PROTOCOLO_CARGA_MAXIMA + 1)
+
+/* === TIPOS DE TRAMA === */
+#define PROTOCOLO_TIPO_EVENTOS        0x01    // PC → placa: eventos de entrada
+#define PROTOCOLO_TIPO_PEDIR_TELEMETRIA 0x02  // PC → placa: responder telemetría ya
+#define PROTOCOLO_TIPO_ESPECTADOR     0x03    // PC → placa: carga[0] 1 = mandar el juego (con foto), 0 = parar
+#define PROTOCOLO_TIPO_TELEMETRIA     0x81    // Placa → PC
+#define PROTOCOLO_TIPO_JUEGO          0x82    // Placa → PC: registros de espectador.h
+
+/* === EVENTOS DE ENTRADA (3 bytes: tiempo_ms de 16 bits + código) === */
+#define PROTOCOLO_BYTES_EVENTO    3
+#define PROTOCOLO_EVENTOS_MAXIMO  (PROTOCOLO_CARGA_MAXIMA / PROTOCOLO_BYTES_EVENTO)
+
+#define PROTOCOLO_EVENTO_CENTRO       0x00    // Soltar la dirección
+#define PROTOCOLO_EVENTO_ARRIBA       0x01
+#define PROTOCOLO_EVENTO_ABAJO        0x02
+#define PROTOCOLO_EVENTO_IZQUIERDA    0x03
+#define PROTOCOLO_EVENTO_DERECHA      0x04
+#define PROTOCOLO_EVENTO_BOTON        0x05
+#define PROTOCOLO_EVENTO_PERFIL       0x06    // Igual que la letra 'I'
+
+/* === TELEMETRÍA === */
+#define PROTOCOLO_BYTES_TELEMETRIA    18
+
+/**
+ * @brief Una trama recibida con el CRC correcto
+ */
+typedef struct {
+    uint8_t tipo;
+    uint8_t secuencia;
+    uint8_t largo;
+    uint8_t carga[PROTOCOLO_CARGA_MAXIMA];
+} ProtocoloTrama;
+
+/**
+ * @brief Un evento de entrada; tiempo_ms es el reloj del que lo envía
+ */
+typedef struct {
+    uint16_t tiempo_ms;
+    uint8_t codigo;
+} ProtocoloEvento;
+
+/**
+ * @brief Estado de la placa que viaja en PROTOCOLO_TIPO_TELEMETRIA
+ */
+typedef struct {
+    uint32_t tiempo_ms;             // planificador_obtener_ms() al armarla
+    uint8_t ultima_secuencia;       // Última trama aceptada (sirve de ACK)
+    uint8_t eventos_pendientes;     // Eventos esperando su momento
+    uint16_t tramas_aceptadas;
+    uint16_t errores_crc;           // CRC, largo inválido o trama cortada
+    uint16_t tramas_perdidas;       // Saltos en la secuencia
+    uint16_t rx_descartados;        // Cola RX llena u overrun del FIFO
+    uint16_t tx_descartados;        // Bytes que no entraron en la cola TX
+    uint16_t latencia_peor_ms;      // Mayor atraso al aplicar un evento
+} ProtocoloTelemetria;
+
+/**
+ * @brief Receptor byte a byte con resincronización
+ */
+typedef struct {
+    uint8_t crudo[PROTOCOLO_TRAMA_MAXIMA];   // Desde el 0xA5 de la trama en curso
+    uint8_t cantidad;
+    uint32_t tramas;                // Aceptadas
+    uint32_t errores;               // CRC, largo inválido o trama cortada
+    uint32_t sueltos;               // Bytes fuera de una trama
+    void (*al_recibir_trama)(const ProtocoloTrama *trama);
+    void (*al_recibir_suelto)(uint8_t byte);
+} ProtocoloReceptor;
+
+/**
+ * @brief CRC-8 (polinomio 0x07) de n bytes, continuando desde crc.
+ */
+uint8_t protocolo_crc8(uint8_t crc, const uint8_t *datos, uint32_t n);
+
+/**
+ * @brief Prepara un receptor vacío.
+ * @param al_recibir_trama Se llama con cada trama aceptada
+ * @param al_recibir_suelto Se llama con cada byte fuera de una trama (puede ser NULL)
+ */
+void protocolo_inicializar(ProtocoloReceptor *receptor,
+                           void (*al_recibir_trama)(const ProtocoloTrama *trama),
+                           void (*al_recibir_suelto)(uint8_t byte));
+
+/**
+ * @brief Agrega un byte; puede disparar varias llamadas a los callbacks.
+ */
+void protocolo_recibir(ProtocoloReceptor *receptor, uint8_t byte);
+
+/**
+ * @brief Resuelve una trama a medias (la línea quedó quieta).
+ *
+ * Lo guardado no puede ser una trama completa: se descarta el 0xA5 y el
+ * resto se vuelve a analizar.
+ */
+void protocolo_vaciar(ProtocoloReceptor *receptor);
+
+/**
+ * @brief Arma una trama completa.
+ * @param salida Al menos PROTOCOLO_CABECERA + largo + 1 bytes
+ * @return Bytes escritos, o 0 si largo > PROTOCOLO_CARGA_MAXIMA
+ */
+uint8_t protocolo_armar_trama(uint8_t tipo, uint8_t secuencia,
+                              const uint8_t *carga, uint8_t largo, uint8_t *salida);
+
+/**
+ * @brief Escribe n eventos como carga de PROTOCOLO_TIPO_EVENTOS.
+ * @return Largo de la carga, o 0 si n > PROTOCOLO_EVENTOS_MAXIMO
+ */
+uint8_t protocolo_codificar_eventos(const ProtocoloEvento *eventos, uint8_t n, uint8_t *carga);
+
+/**
+ * @brief Lee los eventos de una carga.
+ * @return Cantidad de eventos (un resto que no llega a un evento se ignora)
+ */
+uint8_t protocolo_decodificar_eventos(const uint8_t *carga, uint8_t largo, ProtocoloEvento *eventos);
+
+/**
+ * @brief Escribe la telemetría (PROTOCOLO_BYTES_TELEMETRIA bytes).
+ */
+void protocolo_codificar_telemetria(const ProtocoloTelemetria *telemetria, uint8_t *carga);
+
+/**
+ * @brief Lee la telemetría.
+ * @return 0 si el largo no es PROTOCOLO_BYTES_TELEMETRIA
+ */
+uint8_t protocolo_decodificar_telemetria(const uint8_t *carga, uint8_t largo,
+                                         ProtocoloTelemetria *telemetria);
+
+#endif // PROTOCOLO_BT_H
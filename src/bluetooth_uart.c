@@ -1,34 +1,126 @@
 /**
  * @file bluetooth_uart.c
- * @brief Driver UART0 para Bluetooth HC-05 (sin DMA)
+ * @brief Driver UART0 para Bluetooth HC-05 (RX por interrupción, TX por DMA)
+ *
+ * La recepción es por interrupción: UART0_IRQHandler vacía el FIFO de
+ * hardware en una cola SPSC (cola_spsc.h) cada vez que llega a 8 bytes
+ * (RDA) o la línea queda quieta con bytes pendientes (CTI). El bucle
+ * principal solo consume la cola, así que una espera larga (un cuadro
+ * del LCD, por ejemplo) ya no pierde bytes: a 9600 bps 256 bytes son
+ * 266 ms de margen.
+ *
+ * La transmisión es la misma cola al revés: bt_escribir_cadena() copia la
+ * cadena y vuelve enseguida, y el canal 2 del GPDMA la lleva a THR sin la
+ * CPU. El DMA lee directo de la cola el tramo contiguo más largo; al
+ * terminar (bt_dma_on_transfer_complete, desde GPDMA_IRQHandler) libera
+ * esos bytes y arranca el tramo siguiente. Si la cola no tiene lugar la
+ * cadena se descarta entera y se cuenta.
+ *
+ * Lo recibido pasa por el receptor de protocolo_bt.h: las letras sueltas
+ * se aplican al llegar y las tramas binarias traen varios eventos con su
+ * marca de tiempo, que se reproducen con el mismo espaciado. Todo plazo
+ * (dirección sostenida, trama a medias, telemetría) se mide con
+ * planificador_obtener_ms().
+ *
+ * Con un espectador conectado (PROTOCOLO_TIPO_ESPECTADOR) los juegos
+ * mandan sus registros de espectador.h por bt_enviar_juego(), con su
+ * propia secuencia para que el espectador note las tramas perdidas.
  */
 
 #include "bluetooth_uart.h"
+#include "cola_spsc.h"
+#include "divisor_uart.h"
+#include "perfil_isr.h"
+#include "protocolo_bt.h"
+#include "planificador.h"
 #include "LPC17xx.h"
 #include "lpc17xx_pinsel.h"
+#include "lpc17xx_uart.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_clkpwr.h"
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 /* === CONFIGURACIÓN === */
-#define TAMAÑO_BUFFER_RX 256
+#define TAMAÑO_BUFFER_RX 256                // Potencia de 2 (cola SPSC)
+#define PRIORIDAD_IRQ_UART0 3               // Junto con SysTick e I2C, debajo del audio
+#define TAMAÑO_BUFFER_TX 1024               // Potencia de 2: la tabla del comando 'I' y la foto de la serpiente más larga (~640 B) entran enteras
+#define BT_DMA_CH_TX     2                  // Menos prioridad que el canal 1 del audio
+#define TX_TRAMO_MAXIMO  4095               // TransferSize del GPDMA es de 12 bits
 
-/* === BUFFER CIRCULAR === */
+#define BT_SOSTENER_MS          250         // Dirección sin CENTRO: se suelta sola
+#define BT_SILENCIO_TRAMA_MS    50          // Trama a medias sin bytes nuevos: se descarta
+#define BT_ESPACIADO_MAXIMO_MS  500         // Tope al desfase entre eventos de una trama
+#define BT_EVENTOS_PENDIENTES   16
+#define BT_PERIODO_TELEMETRIA_MS 1000
+#define BT_CLIENTE_ACTIVO_MS    5000        // Sin tramas por este tiempo: no más telemetría
+
+/* === COLA DE RECEPCIÓN (productor: UART0_IRQHandler, consumidor: bucle principal) === */
 static uint8_t buffer_rx_bt[TAMAÑO_BUFFER_RX];
-static volatile uint16_t contador_rx = 0;        // Índice de escritura
-static uint16_t contador_lectura = 0;            // Índice de lectura
+static ColaSpsc cola_rx;
+
+/* === COLA DE TRANSMISIÓN (productor: bucle principal, consumidor: GPDMA) === */
+static uint8_t buffer_tx_bt[TAMAÑO_BUFFER_TX];
+static ColaSpsc cola_tx;
+static volatile uint32_t tx_en_vuelo = 0;         // Bytes del tramo que mueve el DMA (0 = canal libre)
+static uint32_t bytes_encolados = 0;
+
+/* === VELOCIDAD === */
+static DivisorUart divisor_actual;
+
+/* === ESTADÍSTICAS DE RECEPCIÓN (las escribe solo la ISR) === */
+static volatile uint32_t bytes_recibidos = 0;
+static volatile uint32_t overrun_fifo = 0;        // OE: el FIFO se llenó antes que la ISR
+static volatile uint32_t errores_linea = 0;       // Paridad, trama o break
 
 /* === VARIABLES DE COMANDO === */
 static uint16_t valor_x_simulado = 2048;
 static uint16_t valor_y_simulado = 2048;
 static uint8_t comando_boton = 0;
 static uint8_t bandera_boton_procesado = 0;
-static uint8_t duracion_comando = 0;  // Duraci del comando en ciclos
+static uint8_t direccion_activa = 0;
+static uint32_t fin_direccion_ms = 0;  // Cuándo se suelta la dirección sostenida
+static uint8_t pedido_perfil = 0;     // 'I': volcar perfil_isr por UART
+
+/* === PROTOCOLO BINARIO === */
+typedef struct {
+    uint32_t aplicar_ms;
+    uint8_t codigo;
+} EventoPendiente;
+
+static ProtocoloReceptor receptor;
+static EventoPendiente pendientes[BT_EVENTOS_PENDIENTES];
+static uint8_t primero_pendiente = 0;
+static uint8_t cantidad_pendientes = 0;
+static uint32_t ultimo_byte_ms = 0;
+static uint8_t ultima_secuencia = 0;
+static uint8_t hay_secuencia = 0;     // Se borra cuando el cliente calla BT_CLIENTE_ACTIVO_MS
+static uint16_t tramas_perdidas = 0;
+static uint16_t latencia_peor_ms = 0;
+static uint8_t cliente_binario = 0;      // Llegó una trama hace menos de BT_CLIENTE_ACTIVO_MS
+static uint32_t ultima_trama_ms = 0;
+static uint8_t pedido_telemetria = 0;
+static uint32_t ultima_telemetria_ms = 0;
+static uint8_t secuencia_tx = 0;
+
+/* === ESPECTADOR === */
+static uint8_t espectador_activo = 0;
+static uint8_t pedido_foto = 0;          // Pedido del espectador o trama que no entró
+static uint8_t secuencia_juego = 0;
 
 /* === FORWARD DECLARATIONS === */
-static void procesar_comando_bt(char comando);
+static void procesar_comando_bt(uint8_t comando);
+static void procesar_trama_bt(const ProtocoloTrama *trama);
+static void actualizar_eventos(uint32_t ahora);
+static void enviar_telemetria(uint32_t ahora);
 
 /**
- * @brief Inicializa UART0 para Bluetooth (9600 bps, 8N1)
+ * @brief Inicializa UART0 para Bluetooth (BT_VELOCIDAD_UART0, 8N1)
+ *
+ * Es la única configuración de UART0: los divisores salen de
+ * divisor_uart_calcular() con el PCLK real, así que cambiar
+ * BT_VELOCIDAD_UART0 o PCLKSEL0 no requiere tocar nada más.
  */
 void bt_inicializar(void) {
     /* Configurar pines P0.2 (TXD0) y P0.3 (RXD0) */
@@ -49,20 +141,64 @@ void bt_inicializar(void) {
     /* Habilitar UART0 en PCONP */
     LPC_SC->PCONP |= (1 << 3);
     
-    /* Configurar UART0 directamente por registros: 9600 bps, 8N1 */
-    uint32_t pclk = SystemCoreClock / 4;  // PCLK para UART0
-    uint32_t divisor_baudrate = pclk / (16 * 9600);
-    
-    LPC_UART0->LCR = 0x83;  /* 8N1, acceso a divisores de velocidad */
-    LPC_UART0->DLL = (divisor_baudrate & 0xFF);
-    LPC_UART0->DLM = ((divisor_baudrate >> 8) & 0xFF);
-    LPC_UART0->LCR = 0x03;  /* 8N1, fin de acceso a divisores */
-    LPC_UART0->FCR = 0x07;  /* Habilitar FIFO, limpiar TX/RX */
+    /* Velocidad: DLM:DLL y divisor fraccional con el menor error */
+    memset(&divisor_actual, 0, sizeof(divisor_actual));
+    uint8_t velocidad_valida = divisor_uart_calcular(CLKPWR_GetPCLK(CLKPWR_PCLKSEL_UART0),
+                                                     BT_VELOCIDAD_UART0, &divisor_actual);
+    if (velocidad_valida) {
+        LPC_UART0->LCR = UART_LCR_WLEN8 | UART_LCR_DLAB_EN;    /* 8N1, acceso a divisores */
+        LPC_UART0->DLL = divisor_actual.divisor & 0xFF;
+        LPC_UART0->DLM = (divisor_actual.divisor >> 8) & 0xFF;
+        LPC_UART0->FDR = divisor_uart_fdr(&divisor_actual);
+    }
+    LPC_UART0->LCR = UART_LCR_WLEN8;                        /* 8N1, fin de acceso a divisores */
+    LPC_UART0->TER = velocidad_valida ? UART_TER_TXEN : 0;  /* Sin velocidad válida no se transmite */
+    /* Habilitar FIFO, limpiar TX/RX; RDA cada 8 bytes (CTI avisa el resto).
+       El modo DMA habilita los pedidos de TX para el GPDMA */
+    LPC_UART0->FCR = UART_FCR_FIFO_EN | UART_FCR_RX_RS | UART_FCR_TX_RS |
+                     UART_FCR_DMAMODE_SEL | UART_FCR_TRG_LEV2;
     
     /* Limpiar buffers */
     memset(buffer_rx_bt, 0, TAMAÑO_BUFFER_RX);
-    contador_rx = 0;
-    contador_lectura = 0;
+    cola_spsc_inicializar(&cola_rx, buffer_rx_bt, TAMAÑO_BUFFER_RX);
+    cola_spsc_inicializar(&cola_tx, buffer_tx_bt, TAMAÑO_BUFFER_TX);
+    tx_en_vuelo = 0;
+    bytes_encolados = 0;
+    protocolo_inicializar(&receptor, procesar_trama_bt, procesar_comando_bt);
+
+    /* Recepción por interrupción: RDA/CTI y estado de línea */
+    LPC_UART0->IER = UART_IER_RBRINT_EN | UART_IER_RLSINT_EN;
+    NVIC_SetPriority(UART0_IRQn, PRIORIDAD_IRQ_UART0);
+    NVIC_EnableIRQ(UART0_IRQn);
+}
+
+/**
+ * @brief ISR de UART0: pasa el FIFO de hardware a la cola de recepción
+ *
+ * RDA, CTI y estado de línea se atienden igual: se lee LSR y RBR hasta
+ * vaciar el FIFO. Leer RBR limpia RDA/CTI y leer LSR limpia RLS. Si la
+ * cola está llena el byte se descarta y lo cuenta la cola.
+ */
+void UART0_IRQHandler(void) {
+    PerfilMarca marca;
+    perfil_isr_entrar(&marca);
+
+    uint32_t lsr;
+    while ((lsr = LPC_UART0->LSR) & UART_LSR_RDR) {
+        if (lsr & UART_LSR_OE) {
+            overrun_fifo++;
+        }
+        if (lsr & (UART_LSR_PE | UART_LSR_FE | UART_LSR_BI)) {
+            errores_linea++;
+        }
+        cola_spsc_poner(&cola_rx, (uint8_t)LPC_UART0->RBR);
+        bytes_recibidos++;
+    }
+    if (lsr & UART_LSR_OE) {
+        overrun_fifo++;     // Estado de línea sin datos: el overrun llegó solo
+    }
+
+    perfil_isr_salir(PERFIL_ISR_UART0, &marca);
 }
 
 /**
@@ -70,75 +206,292 @@ void bt_inicializar(void) {
  * @return Carácter recibido o -1 si no hay datos
  */
 int bt_leer_caracter_no_bloqueante(void) {
-    if (contador_lectura != contador_rx) {
-        uint8_t caracter = buffer_rx_bt[contador_lectura];
-        contador_lectura = (contador_lectura + 1) % TAMAÑO_BUFFER_RX;
-        return (int)caracter;
+    return cola_spsc_sacar(&cola_rx);
+}
+
+/**
+ * @brief Programa el canal TX con el tramo contiguo más viejo de la cola
+ *
+ * Se llama desde la ISR de DMA o con su IRQ enmascarada, así que nunca
+ * hay dos llamadas a la vez. Sin bytes pendientes deja el canal libre.
+ */
+static void tx_arrancar_tramo(void) {
+    GPDMA_Channel_CFG_Type dma_cfg;
+    const uint8_t *inicio;
+    uint32_t cantidad = cola_spsc_tramo(&cola_tx, &inicio);
+
+    if (cantidad > TX_TRAMO_MAXIMO) {
+        cantidad = TX_TRAMO_MAXIMO;
+    }
+    tx_en_vuelo = cantidad;
+    if (cantidad == 0) return;
+
+    dma_cfg.channelNum = BT_DMA_CH_TX;
+    dma_cfg.transferSize = cantidad;
+    dma_cfg.transferWidth = GPDMA_BYTE;                    // No aplica (lo fija la conexión)
+    dma_cfg.srcMemAddr = (uint32_t)(uintptr_t)inicio;      // Directo de la cola
+    dma_cfg.dstMemAddr = 0;                                // No aplica (destino es THR)
+    dma_cfg.transferType = GPDMA_M2P;
+    dma_cfg.srcConn = 0;                                   // No aplica
+    dma_cfg.dstConn = GPDMA_UART0_Tx;
+    dma_cfg.linkedList = 0;                                // Un tramo por vez
+
+    GPDMA_Setup(&dma_cfg);
+    GPDMA_ChannelCmd(BT_DMA_CH_TX, ENABLE);
+}
+
+/**
+ * @brief Callback de GPDMA_IRQHandler: terminó (o falló) el tramo en vuelo
+ */
+void bt_dma_on_transfer_complete(void) {
+    cola_spsc_liberar(&cola_tx, tx_en_vuelo);
+    tx_arrancar_tramo();
+}
+
+/**
+ * @brief Arranca el DMA si estaba parado; si ya corre, el callback sigue solo
+ */
+static void tx_despertar(void) {
+    /* Antes de GPDMA_Init() (melodias_inicializar) los bytes esperan en la cola */
+    if (!(LPC_SC->PCONP & CLKPWR_PCONP_PCGPDMA)) return;
+
+    NVIC_DisableIRQ(DMA_IRQn);
+    if (tx_en_vuelo == 0) {
+        tx_arrancar_tramo();
     }
-    return -1;
+    NVIC_EnableIRQ(DMA_IRQn);
 }
 
 /**
- * @brief Escribe un carácter por UART0
+ * @brief Encola n bytes enteros o ninguno y despierta el DMA
+ * @return 0 si no entraron (quedan contados como descartados)
+ */
+static uint8_t tx_encolar(const uint8_t *bytes, uint32_t n) {
+    uint8_t encolados = cola_spsc_poner_bloque(&cola_tx, bytes, n);
+    if (encolados) {
+        bytes_encolados += n;
+    }
+    tx_despertar();
+    return encolados;
+}
+
+/**
+ * @brief Encola un carácter para UART0 (no bloquea)
  */
 void bt_escribir_caracter(char caracter) {
-    while (!(LPC_UART0->LSR & (1 << 5)));  /* Esperar a que THRE esté listo */
-    LPC_UART0->THR = caracter;
+    uint8_t byte = (uint8_t)caracter;
+    tx_encolar(&byte, 1);
 }
 
 /**
- * @brief Escribe una cadena por UART0
+ * @brief Encola una cadena para UART0 (no bloquea)
  */
 void bt_escribir_cadena(const char *cadena) {
-    while (*cadena) {
-        bt_escribir_caracter(*cadena++);
-    }
+    tx_encolar((const uint8_t *)cadena, strlen(cadena));
+}
+
+/**
+ * @brief Copia los contadores de transmisión
+ */
+void bt_obtener_estadisticas_tx(BtEstadisticasTx *estadisticas) {
+    if (estadisticas == NULL) return;
+
+    estadisticas->encolados = bytes_encolados;
+    estadisticas->descartados = cola_spsc_descartados(&cola_tx);
+    estadisticas->en_cola = cola_spsc_ocupados(&cola_tx);
+    estadisticas->maximo_en_cola = cola_spsc_maximo_ocupado(&cola_tx);
 }
 
 /**
  * @brief Procesa todos los comandos Bluetooth en el buffer
+ *
+ * Pasa los bytes por el receptor de tramas, aplica los eventos que ya
+ * vencieron y suelta la dirección si se cumplió su plazo.
  */
 void bt_procesar_comandos(void) {
+    uint32_t ahora = planificador_obtener_ms();
     int caracter;
+
+    if (receptor.cantidad > 0 && ahora - ultimo_byte_ms >= BT_SILENCIO_TRAMA_MS) {
+        protocolo_vaciar(&receptor);    // Trama cortada: lo que siga se resincroniza
+    }
     while ((caracter = bt_leer_caracter_no_bloqueante()) != -1) {
-        procesar_comando_bt((char)caracter);
+        protocolo_recibir(&receptor, (uint8_t)caracter);
+        ultimo_byte_ms = ahora;
     }
+
+    actualizar_eventos(ahora);
 }
 
 /**
- * @brief Procesa un comando Bluetooth individual
- * Mantiene el comando activo por varios ciclos para que sea detectado
+ * @brief Aplica un evento de entrada (de una letra o de una trama)
+ *
+ * Una dirección queda sostenida hasta CENTRO, otra dirección o
+ * BT_SOSTENER_MS, medido en ms y no en vueltas del bucle.
  */
-static void procesar_comando_bt(char comando) {
-    comando = (comando >= 'a') ? (comando - 32) : comando;  /* Convertir a mayúscula */
-    
-    /* Resetear duración del comando */
-    duracion_comando = 5;  /* Mantener comando activo ~5 ciclos */
-    
-    switch (comando) {
-        case 'W':  /* Arriba */
+static void aplicar_evento(uint8_t codigo, uint32_t ahora) {
+    switch (codigo) {
+        case PROTOCOLO_EVENTO_ARRIBA:
             valor_x_simulado = 2048;
             valor_y_simulado = 200;
             break;
-        case 'S':  /* Abajo */
+        case PROTOCOLO_EVENTO_ABAJO:
             valor_x_simulado = 2048;
             valor_y_simulado = 3800;
             break;
-        case 'A':  /* Izquierda */
+        case PROTOCOLO_EVENTO_IZQUIERDA:
             valor_x_simulado = 200;
             valor_y_simulado = 2048;
             break;
-        case 'D':  /* Derecha */
+        case PROTOCOLO_EVENTO_DERECHA:
             valor_x_simulado = 3800;
             valor_y_simulado = 2048;
             break;
-        case 'B':  /* Botón */
+        case PROTOCOLO_EVENTO_CENTRO:
+            valor_x_simulado = 2048;
+            valor_y_simulado = 2048;
+            direccion_activa = 0;
+            return;
+        case PROTOCOLO_EVENTO_BOTON:
             comando_boton = 1;
             bandera_boton_procesado = 0;
-            break;
+            return;
+        case PROTOCOLO_EVENTO_PERFIL:
+            pedido_perfil = 1;
+            return;
         default:
-            break;
+            return;
     }
+    direccion_activa = 1;
+    fin_direccion_ms = ahora + BT_SOSTENER_MS;
+}
+
+/**
+ * @brief Byte fuera de una trama: las letras de siempre desde una terminal
+ */
+static void procesar_comando_bt(uint8_t comando) {
+    uint32_t ahora = planificador_obtener_ms();
+    comando = (comando >= 'a') ? (comando - 32) : comando;  /* Convertir a mayúscula */
+
+    switch (comando) {
+        case 'W': aplicar_evento(PROTOCOLO_EVENTO_ARRIBA, ahora); break;
+        case 'S': aplicar_evento(PROTOCOLO_EVENTO_ABAJO, ahora); break;
+        case 'A': aplicar_evento(PROTOCOLO_EVENTO_IZQUIERDA, ahora); break;
+        case 'D': aplicar_evento(PROTOCOLO_EVENTO_DERECHA, ahora); break;
+        case 'B': aplicar_evento(PROTOCOLO_EVENTO_BOTON, ahora); break;
+        case 'I': aplicar_evento(PROTOCOLO_EVENTO_PERFIL, ahora); break;
+        default: break;
+    }
+}
+
+/**
+ * @brief Guarda un evento para aplicarlo en aplicar_ms
+ *
+ * Con la lista llena se adelanta el más viejo: un evento llega tarde pero
+ * no se pierde.
+ */
+static void agendar_evento(uint32_t aplicar_ms, uint8_t codigo, uint32_t ahora) {
+    if (cantidad_pendientes == BT_EVENTOS_PENDIENTES) {
+        aplicar_evento(pendientes[primero_pendiente].codigo, ahora);
+        primero_pendiente = (primero_pendiente + 1) % BT_EVENTOS_PENDIENTES;
+        cantidad_pendientes--;
+    }
+    EventoPendiente *evento = &pendientes[(primero_pendiente + cantidad_pendientes) % BT_EVENTOS_PENDIENTES];
+    evento->aplicar_ms = aplicar_ms;
+    evento->codigo = codigo;
+    cantidad_pendientes++;
+}
+
+/**
+ * @brief Trama binaria aceptada por el receptor (CRC correcto)
+ *
+ * Los eventos de una trama se reproducen con el mismo espaciado con el que
+ * se capturaron, contando desde la llegada de la trama: la latencia es el
+ * viaje más la ventana de agrupado del emisor, siempre la misma.
+ *
+ * Una trama después de BT_CLIENTE_ACTIVO_MS de silencio es de otra sesión
+ * (cada ejecución del cliente arranca su secuencia en 0): no se compara
+ * con la última, ni para contar pérdidas ni para descartarla por repetida.
+ */
+static void procesar_trama_bt(const ProtocoloTrama *trama) {
+    uint32_t ahora = planificador_obtener_ms();
+
+    if (ahora - ultima_trama_ms >= BT_CLIENTE_ACTIVO_MS) {
+        hay_secuencia = 0;
+    }
+    if (hay_secuencia) {
+        uint8_t salto = (uint8_t)(trama->secuencia - ultima_secuencia);
+        if (salto == 0) return;                     // Repetida: el emisor reintentó
+        tramas_perdidas += salto - 1;
+    }
+    ultima_secuencia = trama->secuencia;
+    hay_secuencia = 1;
+    ultima_trama_ms = ahora;
+    cliente_binario = 1;
+
+    if (trama->tipo == PROTOCOLO_TIPO_EVENTOS) {
+        ProtocoloEvento eventos[PROTOCOLO_EVENTOS_MAXIMO];
+        uint8_t n = protocolo_decodificar_eventos(trama->carga, trama->largo, eventos);
+
+        for (uint8_t i = 0; i < n; i++) {
+            int16_t desfase = (int16_t)(eventos[i].tiempo_ms - eventos[0].tiempo_ms);
+            if (desfase < 0) desfase = 0;
+            if (desfase > BT_ESPACIADO_MAXIMO_MS) desfase = BT_ESPACIADO_MAXIMO_MS;
+            agendar_evento(ahora + (uint32_t)desfase, eventos[i].codigo, ahora);
+        }
+    } else if (trama->tipo == PROTOCOLO_TIPO_PEDIR_TELEMETRIA) {
+        pedido_telemetria = 1;
+    } else if (trama->tipo == PROTOCOLO_TIPO_ESPECTADOR && trama->largo >= 1) {
+        espectador_activo = trama->carga[0] ? 1 : 0;
+        pedido_foto = espectador_activo;            // Empieza (o se resincroniza) con una foto
+    }
+}
+
+/**
+ * @brief Aplica los eventos vencidos y suelta la dirección si expiró
+ */
+static void actualizar_eventos(uint32_t ahora) {
+    while (cantidad_pendientes > 0) {
+        EventoPendiente *evento = &pendientes[primero_pendiente];
+        uint32_t atraso = ahora - evento->aplicar_ms;
+        if ((int32_t)atraso < 0) break;
+
+        if (atraso > latencia_peor_ms) {
+            latencia_peor_ms = (uint16_t)(atraso > 0xFFFF ? 0xFFFF : atraso);
+        }
+        aplicar_evento(evento->codigo, ahora);
+        primero_pendiente = (primero_pendiente + 1) % BT_EVENTOS_PENDIENTES;
+        cantidad_pendientes--;
+    }
+
+    if (direccion_activa && (int32_t)(ahora - fin_direccion_ms) >= 0) {
+        /* Comando expiró, volver al centro */
+        aplicar_evento(PROTOCOLO_EVENTO_CENTRO, ahora);
+    }
+}
+
+/**
+ * @brief Manda el estado del enlace en una trama PROTOCOLO_TIPO_TELEMETRIA
+ */
+static void enviar_telemetria(uint32_t ahora) {
+    ProtocoloTelemetria telemetria;
+    uint8_t carga[PROTOCOLO_BYTES_TELEMETRIA];
+    uint8_t trama[PROTOCOLO_TRAMA_MAXIMA];
+
+    telemetria.tiempo_ms = ahora;
+    telemetria.ultima_secuencia = ultima_secuencia;
+    telemetria.eventos_pendientes = cantidad_pendientes;
+    telemetria.tramas_aceptadas = (uint16_t)receptor.tramas;
+    telemetria.errores_crc = (uint16_t)receptor.errores;
+    telemetria.tramas_perdidas = tramas_perdidas;
+    telemetria.rx_descartados = (uint16_t)(cola_spsc_descartados(&cola_rx) + overrun_fifo);
+    telemetria.tx_descartados = (uint16_t)cola_spsc_descartados(&cola_tx);
+    telemetria.latencia_peor_ms = latencia_peor_ms;
+
+    protocolo_codificar_telemetria(&telemetria, carga);
+    tx_encolar(trama, protocolo_armar_trama(PROTOCOLO_TIPO_TELEMETRIA, secuencia_tx++,
+                                            carga, sizeof(carga), trama));
+    ultima_telemetria_ms = ahora;
 }
 
 /**
@@ -175,29 +528,108 @@ void bt_limpiar_comando_boton(void) {
 }
 
 /**
- * @brief Actualiza el buffer leyendo caracteres del UART
+ * @brief Consume el pedido de volcado del perfil de interrupciones
+ */
+uint8_t bt_obtener_pedido_perfil(void) {
+    uint8_t pedido = pedido_perfil;
+    pedido_perfil = 0;
+    return pedido;
+}
+
+/**
+ * @brief Copia los contadores de recepción
+ */
+void bt_obtener_estadisticas_rx(BtEstadisticasRx *estadisticas) {
+    if (estadisticas == NULL) return;
+
+    estadisticas->recibidos = bytes_recibidos;
+    estadisticas->descartados = cola_spsc_descartados(&cola_rx);
+    estadisticas->overrun_fifo = overrun_fifo;
+    estadisticas->errores_linea = errores_linea;
+    estadisticas->maximo_en_cola = cola_spsc_maximo_ocupado(&cola_rx);
+}
+
+/**
+ * @brief Procesa lo que dejó la ISR en la cola de recepción
  * Se llama periódicamente desde el loop principal
- * Mantiene el comando activo brevemente después de recibirse
+ * Además responde la telemetría pedida y, mientras haya un cliente
+ * binario, la manda sola cada BT_PERIODO_TELEMETRIA_MS.
  */
 void bt_actualizar_buffer(void) {
-    /* Leer todos los caracteres disponibles en UART */
-    while (LPC_UART0->LSR & (1 << 0)) {  /* Mientras hay datos disponibles */
-        uint8_t caracter = (uint8_t)(LPC_UART0->RBR & 0xFF);
-        buffer_rx_bt[contador_rx] = caracter;
-        contador_rx = (contador_rx + 1) % TAMAÑO_BUFFER_RX;
-        
-        /* Procesar comando inmediatamente */
-        procesar_comando_bt((char)caracter);
+    /* Consumir todos los caracteres que dejó UART0_IRQHandler */
+    bt_procesar_comandos();
+
+    uint32_t ahora = planificador_obtener_ms();
+    if (cliente_binario && ahora - ultima_trama_ms >= BT_CLIENTE_ACTIVO_MS) {
+        cliente_binario = 0;
+        hay_secuencia = 0;      // El próximo cliente empieza su propia secuencia
     }
-    
-    /* Decrementar duración del comando */
-    if (duracion_comando > 0) {
-        duracion_comando--;
-        if (duracion_comando == 0) {
-            /* Comando expiró, volver al centro */
-            valor_x_simulado = 2048;
-            valor_y_simulado = 2048;
-        }
+    if (pedido_telemetria ||
+        (cliente_binario && ahora - ultima_telemetria_ms >= BT_PERIODO_TELEMETRIA_MS)) {
+        pedido_telemetria = 0;
+        enviar_telemetria(ahora);
+    }
+}
+
+/**
+ * @brief Copia los contadores del protocolo binario
+ */
+void bt_obtener_estadisticas_protocolo(BtEstadisticasProtocolo *estadisticas) {
+    if (estadisticas == NULL) return;
+
+    estadisticas->tramas_aceptadas = receptor.tramas;
+    estadisticas->errores_crc = receptor.errores;
+    estadisticas->tramas_perdidas = tramas_perdidas;
+    estadisticas->bytes_sueltos = receptor.sueltos;
+    estadisticas->latencia_peor_ms = latencia_peor_ms;
+}
+
+/**
+ * @brief Indica si hay un espectador conectado
+ */
+uint8_t bt_espectador_activo(void) {
+    return espectador_activo;
+}
+
+/**
+ * @brief Consume el pedido de foto del espectador
+ */
+uint8_t bt_obtener_pedido_foto(void) {
+    uint8_t pedido = pedido_foto;
+    pedido_foto = 0;
+    return pedido;
+}
+
+/**
+ * @brief Manda una trama PROTOCOLO_TIPO_JUEGO con los registros de un tick
+ *
+ * La secuencia avanza aunque la trama no entre en la cola: el espectador
+ * ve el salto igual que si se hubiera perdido en el aire. Como sin esa
+ * trama su copia ya no sirve, se deja pedida una foto.
+ */
+uint8_t bt_enviar_juego(const uint8_t *registros, uint8_t largo) {
+    uint8_t trama[PROTOCOLO_TRAMA_MAXIMA];
+
+    if (!espectador_activo) return 0;
+
+    uint8_t n = protocolo_armar_trama(PROTOCOLO_TIPO_JUEGO, secuencia_juego++, registros, largo, trama);
+    if (n == 0 || !tx_encolar(trama, n)) {
+        pedido_foto = 1;
+        return 0;
     }
+    return 1;
+}
+
+/**
+ * @brief Bytes libres en la cola de transmisión
+ */
+uint32_t bt_tx_libres(void) {
+    return cola_spsc_libres(&cola_tx);
+}
+
+void bt_obtener_divisor(DivisorUart *divisor) {
+    if (divisor == NULL) return;
+
+    *divisor = divisor_actual;
 }
 
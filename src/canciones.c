@@ -0,0 +1,62 @@
+/**
+ * @file canciones.c
+ * @brief Canciones compiladas al formato de bytes de melodias_dac.h
+ *
+ * Generado por tools/compilador_canciones.c desde tools/canciones.txt. No editar a mano:
+ *   ./compilador_canciones tools/canciones.txt > src/canciones.c
+ *
+ * @date Noviembre 2025
+ */
+
+#include "melodias_dac.h"
+
+// melodia_happy_birthday: 12 notas, 17 bytes (52 como Nota[])
+const uint8_t melodia_happy_birthday[] = {
+    120, 0,  // tempo, envolvente
+    0x7C, 0x32, 0xC8, 0xC6, 0xCB, 0xCA, 0xE7, 0x7C, 0x32, 0xC8, 0xC6, 0xCD,
+    0xCB, 0xE7, 0xFF,
+};
+
+// melodia_mario: 12 notas, 16 bytes (52 como Nota[])
+const uint8_t melodia_mario[] = {
+    120, 1,  // tempo, envolvente
+    0xF7, 0x42, 0x42, 0x25, 0x42, 0x25, 0x3E, 0x42, 0x25, 0x8F, 0x6F, 0x83,
+    0x6F, 0xFF,
+};
+
+// melodia_tetris: 16 notas, 20 bytes (68 como Nota[])
+const uint8_t melodia_tetris[] = {
+    120, 0,  // tempo, envolvente
+    0xF8, 0x80, 0x31, 0x32, 0x7E, 0x32, 0x31, 0x79, 0x2F, 0x32, 0x80, 0x34,
+    0x32, 0xA0, 0x32, 0x7E, 0x80, 0xFF,
+};
+
+// melodia_nokia: 13 notas, 17 bytes (56 como Nota[])
+const uint8_t melodia_nokia[] = {
+    120, 1,  // tempo, envolvente
+    0xF8, 0x42, 0x40, 0x82, 0x84, 0x3F, 0x3D, 0x7E, 0x80, 0x3D, 0x3B, 0x7D,
+    0x80, 0xCF, 0xFF,
+};
+
+// melodia_game_over: 9 notas, 14 bytes (40 como Nota[])
+const uint8_t melodia_game_over[] = {
+    120, 0,  // tempo, envolvente
+    0xF6, 0x32, 0x2D, 0x74, 0x2F, 0x31, 0x2F, 0x2E, 0xF2, 0xC4, 0xC2, 0xFF,
+};
+
+// melodia_salto: 3 notas, 7 bytes (16 como Nota[])
+const uint8_t melodia_salto[] = {
+    120, 3,  // tempo, envolvente
+    0xF9, 0x19, 0x1D, 0x20, 0xFF,
+};
+
+// melodia_fondo: 64 notas, 68 bytes (260 como Nota[])
+const uint8_t melodia_fondo[] = {
+    120, 1,  // tempo, envolvente
+    0x42, 0x42, 0x25, 0x42, 0x25, 0x3E, 0x42, 0x25, 0x8F, 0x6F, 0x83, 0x6F,
+    0xFE, 0x88, 0x25, 0x83, 0x25, 0x80, 0x25, 0x3B, 0x25, 0x3D, 0x25, 0x3C,
+    0x3B, 0x83, 0x8C, 0x8F, 0x47, 0x25, 0x43, 0x45, 0x25, 0x42, 0x25, 0x3E,
+    0x40, 0x3D, 0x6F, 0x88, 0x25, 0x83, 0x25, 0x80, 0x25, 0x3B, 0x25, 0x3D,
+    0x25, 0x3C, 0x3B, 0x83, 0x8C, 0x8F, 0x47, 0x25, 0x43, 0x45, 0x25, 0x42,
+    0x25, 0x3E, 0x40, 0x3D, 0x6F, 0xFF,
+};
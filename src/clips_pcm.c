@@ -0,0 +1,412 @@
+/**
+ * @file clips_pcm.c
+ * @brief Clips PCM a 20000 Hz, en flash, para melodias_clip_reproducir()
+ *
+ * Generado por tools/convertidor_wav.c. No editar a mano:
+ *   ./convertidor_wav tools/clips/golpe.wav tools/clips/moneda.wav:10
+ *
+ * @date Noviembre 2025
+ */
+
+#include "clips_pcm.h"
+
+// golpe: 3000 muestras (150 ms), 3000 bytes
+static const uint8_t clip_golpe[] = {
+    0x65, 0x5B, 0x52, 0x5D, 0x7D, 0x9C, 0x7B, 0x5A, 0x58, 0x75, 0x92, 0x8A, 0x81, 0x74, 0x63, 0x52,
+    0x6E, 0x89, 0x8A, 0x70, 0x56, 0x6E, 0x86, 0x88, 0x74, 0x60, 0x62, 0x64, 0x70, 0x84, 0x98, 0xB0,
+    0xC8, 0xC0, 0x98, 0x71, 0x77, 0x7E, 0x8D, 0xA5, 0xBC, 0xCF, 0xE2, 0xE1, 0xCC, 0xB7, 0xAD, 0xA3,
+    0xAF, 0xD0, 0xF0, 0xBC, 0x88, 0x84, 0xB2, 0xE0, 0xC0, 0xA0, 0x8C, 0x84, 0x7C, 0x7A, 0x78, 0x7D,
+    0x86, 0x90, 0xAC, 0xC8, 0xC4, 0xA1, 0x7E, 0x93, 0xA8, 0xB4, 0xB6, 0xB8, 0xA9, 0x9A, 0x97, 0xA0,
+    0xA8, 0x8D, 0x72, 0x64, 0x63, 0x63, 0x69, 0x70, 0x80, 0x97, 0xAF, 0xA1, 0x93, 0x88, 0x81, 0x7A,
+    0x87, 0x94, 0x96, 0x8E, 0x86, 0x7D, 0x74, 0x7C, 0x94, 0xAC, 0xA6, 0xA0, 0x91, 0x78, 0x60, 0x6F,
+    0x7F, 0x85, 0x81, 0x7E, 0x8E, 0x9F, 0xA3, 0x9A, 0x91, 0x7A, 0x62, 0x68, 0x89, 0xAB, 0x7F, 0x53,
+    0x44, 0x52, 0x60, 0x70, 0x80, 0x78, 0x59, 0x3A, 0x4A, 0x5A, 0x56, 0x3F, 0x29, 0x47, 0x65, 0x76,
+    0x7A, 0x7F, 0x75, 0x6B, 0x6D, 0x7B, 0x88, 0x6D, 0x51, 0x4D, 0x5F, 0x71, 0x6B, 0x66, 0x63, 0x62,
+    0x62, 0x5C, 0x56, 0x5C, 0x6E, 0x80, 0x85, 0x8A, 0x81, 0x6B, 0x55, 0x5E, 0x67, 0x5E, 0x42, 0x26,
+    0x44, 0x62, 0x71, 0x6F, 0x6D, 0x7D, 0x8D, 0x92, 0x8A, 0x82, 0x6B, 0x53, 0x49, 0x4E, 0x54, 0x61,
+    0x6F, 0x67, 0x4B, 0x2F, 0x43, 0x58, 0x5C, 0x50, 0x44, 0x42, 0x41, 0x40, 0x3E, 0x3D, 0x5D, 0x7D,
+    0x80, 0x65, 0x4A, 0x50, 0x56, 0x5D, 0x64, 0x6C, 0x81, 0x97, 0x92, 0x70, 0x4F, 0x60, 0x71, 0x7C,
+    0x82, 0x87, 0x97, 0xA6, 0xAD, 0xAB, 0xA9, 0xAC, 0xAF, 0xA4, 0x8C, 0x74, 0x7A, 0x81, 0x84, 0x83,
+    0x81, 0x98, 0xAF, 0xBC, 0xC0, 0xC4, 0xA3, 0x82, 0x72, 0x74, 0x76, 0x79, 0x7C, 0x7E, 0x7E, 0x7F,
+    0x8A, 0x95, 0x9D, 0xA2, 0xA6, 0x99, 0x8C, 0x80, 0x77, 0x6D, 0x7E, 0x8F, 0x96, 0x94, 0x92, 0x9B,
+    0xA3, 0xAF, 0xBF, 0xCE, 0xC4, 0xB9, 0xB0, 0xA9, 0xA1, 0xA5, 0xA9, 0xAC, 0xAE, 0xB0, 0x98, 0x7F,
+    0x83, 0xA4, 0xC5, 0xC0, 0xBB, 0xBA, 0xBD, 0xC0, 0xBD, 0xB9, 0xAF, 0x9F, 0x8E, 0x8E, 0x8E, 0x87,
+    0x7C, 0x70, 0x83, 0x97, 0x96, 0x7F, 0x69, 0x68, 0x68, 0x6A, 0x6F, 0x74, 0x71, 0x6E, 0x70, 0x76,
+    0x7C, 0x70, 0x64, 0x5D, 0x5A, 0x58, 0x5C, 0x61, 0x62, 0x5F, 0x5D, 0x66, 0x6F, 0x6D, 0x5F, 0x52,
+    0x70, 0x8E, 0x98, 0x8E, 0x83, 0x72, 0x60, 0x59, 0x5C, 0x5F, 0x61, 0x64, 0x66, 0x66, 0x66, 0x5C,
+    0x52, 0x5A, 0x74, 0x8D, 0x92, 0x96, 0x8F, 0x7B, 0x68, 0x68, 0x68, 0x60, 0x52, 0x44, 0x44, 0x44,
+    0x48, 0x50, 0x59, 0x55, 0x52, 0x5A, 0x6D, 0x80, 0x69, 0x52, 0x44, 0x3F, 0x3B, 0x5A, 0x7A, 0x82,
+    0x74, 0x66, 0x58, 0x4B, 0x4B, 0x59, 0x67, 0x55, 0x43, 0x43, 0x54, 0x66, 0x75, 0x85, 0x8A, 0x86,
+    0x82, 0x7D, 0x78, 0x6F, 0x61, 0x53, 0x57, 0x5B, 0x59, 0x53, 0x4D, 0x61, 0x75, 0x7C, 0x75, 0x6E,
+    0x76, 0x7E, 0x7C, 0x6E, 0x60, 0x5D, 0x5A, 0x63, 0x77, 0x8A, 0x90, 0x96, 0x98, 0x94, 0x90, 0x90,
+    0x8F, 0x8F, 0x90, 0x91, 0x8F, 0x8D, 0x85, 0x76, 0x67, 0x70, 0x7A, 0x7D, 0x79, 0x75, 0x6B, 0x61,
+    0x5D, 0x5E, 0x5F, 0x67, 0x6F, 0x74, 0x74, 0x75, 0x82, 0x90, 0x9B, 0xA4, 0xAC, 0x9E, 0x8F, 0x8F,
+    0x9F, 0xAE, 0xB0, 0xB2, 0xB3, 0xB2, 0xB1, 0xA0, 0x8F, 0x85, 0x81, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x85, 0x92, 0x9E, 0xA7, 0xAF, 0xB3, 0xB1, 0xAF, 0xA5, 0x9B, 0x98, 0x9D, 0xA2,
+    0xA6, 0xAA, 0xA2, 0x8E, 0x7A, 0x8A, 0x9A, 0xA6, 0xAD, 0xB3, 0xB0, 0xAC, 0xAA, 0xA9, 0xA7, 0x9F,
+    0x97, 0x8F, 0x86, 0x7E, 0x8E, 0x9F, 0xA1, 0x94, 0x86, 0x93, 0xA0, 0xA9, 0xAD, 0xB1, 0xA1, 0x91,
+    0x88, 0x88, 0x87, 0x96, 0xA4, 0xA8, 0xA1, 0x9A, 0x8B, 0x7B, 0x73, 0x71, 0x70, 0x70, 0x70, 0x79,
+    0x8D, 0xA0, 0x9D, 0x9A, 0x8F, 0x7D, 0x6B, 0x7C, 0x8E, 0x98, 0x9C, 0x9F, 0x96, 0x8D, 0x84, 0x7B,
+    0x73, 0x77, 0x7B, 0x78, 0x6D, 0x62, 0x5E, 0x5A, 0x65, 0x7D, 0x94, 0x8C, 0x83, 0x7D, 0x79, 0x76,
+    0x80, 0x89, 0x88, 0x7B, 0x6E, 0x78, 0x83, 0x88, 0x86, 0x84, 0x75, 0x65, 0x5D, 0x5E, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5E, 0x5D, 0x65, 0x6D, 0x6D, 0x65, 0x5D, 0x61, 0x65, 0x63, 0x5C, 0x55, 0x67, 0x7A,
+    0x7D, 0x6F, 0x62, 0x64, 0x67, 0x6A, 0x6D, 0x70, 0x78, 0x80, 0x7E, 0x72, 0x67, 0x73, 0x7F, 0x80,
+    0x77, 0x6D, 0x6E, 0x6F, 0x70, 0x70, 0x70, 0x64, 0x58, 0x58, 0x62, 0x6D, 0x67, 0x61, 0x5D, 0x59,
+    0x55, 0x68, 0x7B, 0x7D, 0x6F, 0x61, 0x68, 0x70, 0x77, 0x7D, 0x83, 0x80, 0x7C, 0x78, 0x73, 0x6F,
+    0x74, 0x79, 0x7C, 0x7D, 0x7F, 0x84, 0x8A, 0x85, 0x76, 0x68, 0x72, 0x7D, 0x7F, 0x79, 0x73, 0x74,
+    0x75, 0x7B, 0x87, 0x92, 0x8D, 0x87, 0x85, 0x87, 0x89, 0x8E, 0x93, 0x97, 0x9B, 0x9E, 0x94, 0x8A,
+    0x88, 0x8C, 0x90, 0x8E, 0x8C, 0x8C, 0x8C, 0x8C, 0x90, 0x94, 0x94, 0x8F, 0x8A, 0x8C, 0x8E, 0x8F,
+    0x8E, 0x8D, 0x97, 0xA1, 0xA4, 0x9F, 0x99, 0x9D, 0xA1, 0xA4, 0xA6, 0xA7, 0x99, 0x8B, 0x87, 0x8D,
+    0x93, 0x9B, 0xA3, 0xA6, 0xA4, 0xA1, 0x93, 0x85, 0x7D, 0x7D, 0x7D, 0x83, 0x89, 0x89, 0x81, 0x7A,
+    0x7D, 0x80, 0x80, 0x7C, 0x79, 0x84, 0x90, 0x96, 0x98, 0x9A, 0x9C, 0x9E, 0x98, 0x89, 0x7A, 0x84,
+    0x8F, 0x94, 0x92, 0x90, 0x86, 0x7C, 0x7E, 0x8B, 0x99, 0x9B, 0x9C, 0x95, 0x86, 0x78, 0x85, 0x93,
+    0x94, 0x89, 0x7E, 0x7F, 0x80, 0x85, 0x8E, 0x97, 0x94, 0x90, 0x88, 0x7B, 0x6E, 0x72, 0x77, 0x7A,
+    0x7B, 0x7D, 0x79, 0x75, 0x72, 0x6F, 0x6C, 0x6E, 0x70, 0x74, 0x7B, 0x82, 0x75, 0x67, 0x65, 0x6F,
+    0x79, 0x76, 0x74, 0x6F, 0x67, 0x5F, 0x64, 0x6A, 0x6F, 0x74, 0x79, 0x77, 0x75, 0x6F, 0x67, 0x5F,
+    0x6F, 0x7F, 0x86, 0x82, 0x7F, 0x81, 0x84, 0x7E, 0x6F, 0x60, 0x62, 0x65, 0x65, 0x61, 0x5D, 0x69,
+    0x76, 0x78, 0x6F, 0x67, 0x64, 0x62, 0x63, 0x68, 0x6E, 0x76, 0x7E, 0x82, 0x81, 0x80, 0x76, 0x6C,
+    0x67, 0x65, 0x64, 0x71, 0x7E, 0x82, 0x7C, 0x77, 0x79, 0x7B, 0x78, 0x6E, 0x64, 0x64, 0x64, 0x69,
+    0x74, 0x7F, 0x7B, 0x77, 0x72, 0x6C, 0x67, 0x75, 0x83, 0x88, 0x84, 0x80, 0x83, 0x86, 0x82, 0x76,
+    0x6B, 0x78, 0x85, 0x85, 0x79, 0x6D, 0x7A, 0x87, 0x8A, 0x84, 0x7E, 0x7C, 0x7A, 0x7C, 0x80, 0x83,
+    0x8A, 0x90, 0x8E, 0x84, 0x7A, 0x78, 0x76, 0x79, 0x7F, 0x85, 0x81, 0x7E, 0x7B, 0x79, 0x78, 0x78,
+    0x79, 0x79, 0x78, 0x77, 0x79, 0x7B, 0x7E, 0x80, 0x81, 0x81, 0x81, 0x85, 0x8C, 0x93, 0x8D, 0x86,
+    0x84, 0x87, 0x8A, 0x86, 0x81, 0x80, 0x83, 0x85, 0x81, 0x7C, 0x7B, 0x7F, 0x82, 0x7F, 0x7B, 0x7F,
+    0x89, 0x93, 0x91, 0x8F, 0x8B, 0x85, 0x80, 0x83, 0x87, 0x8D, 0x94, 0x9A, 0x8E, 0x82, 0x81, 0x8B,
+    0x95, 0x90, 0x8A, 0x88, 0x88, 0x88, 0x8D, 0x92, 0x91, 0x8B, 0x84, 0x86, 0x87, 0x89, 0x8B, 0x8D,
+    0x91, 0x95, 0x92, 0x89, 0x80, 0x86, 0x8D, 0x8F, 0x8D, 0x8A, 0x89, 0x88, 0x86, 0x82, 0x7F, 0x7E,
+    0x7D, 0x7A, 0x76, 0x72, 0x72, 0x73, 0x73, 0x72, 0x71, 0x79, 0x82, 0x83, 0x7C, 0x76, 0x74, 0x72,
+    0x71, 0x6F, 0x6E, 0x78, 0x81, 0x86, 0x86, 0x86, 0x84, 0x81, 0x7D, 0x77, 0x72, 0x71, 0x71, 0x71,
+    0x71, 0x72, 0x74, 0x76, 0x74, 0x70, 0x6C, 0x6F, 0x73, 0x73, 0x71, 0x6F, 0x77, 0x80, 0x84, 0x84,
+    0x84, 0x7F, 0x79, 0x75, 0x71, 0x6D, 0x76, 0x7F, 0x7F, 0x77, 0x6F, 0x6F, 0x70, 0x6E, 0x69, 0x65,
+    0x69, 0x6E, 0x71, 0x72, 0x74, 0x74, 0x74, 0x73, 0x6F, 0x6C, 0x70, 0x74, 0x73, 0x6D, 0x67, 0x6A,
+    0x6D, 0x6E, 0x6C, 0x6A, 0x6E, 0x72, 0x72, 0x6E, 0x6A, 0x6A, 0x6A, 0x6B, 0x6F, 0x73, 0x72, 0x71,
+    0x73, 0x77, 0x7C, 0x7B, 0x7B, 0x7C, 0x7F, 0x82, 0x81, 0x80, 0x80, 0x81, 0x82, 0x84, 0x86, 0x85,
+    0x80, 0x7B, 0x7A, 0x79, 0x7D, 0x84, 0x8C, 0x83, 0x7A, 0x79, 0x80, 0x86, 0x86, 0x85, 0x81, 0x7B,
+    0x75, 0x7E, 0x87, 0x8C, 0x8D, 0x8D, 0x8B, 0x88, 0x87, 0x89, 0x8A, 0x8B, 0x8C, 0x89, 0x82, 0x7B,
+    0x7F, 0x83, 0x85, 0x85, 0x85, 0x89, 0x8D, 0x8F, 0x8F, 0x8E, 0x8F, 0x8F, 0x8E, 0x8C, 0x89, 0x8D,
+    0x90, 0x90, 0x8E, 0x8C, 0x8C, 0x8C, 0x8A, 0x85, 0x80, 0x7F, 0x7D, 0x7C, 0x7D, 0x7F, 0x81, 0x83,
+    0x83, 0x80, 0x7E, 0x85, 0x8D, 0x8F, 0x8C, 0x89, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8B, 0x8B, 0x8A,
+    0x88, 0x86, 0x81, 0x7C, 0x7E, 0x85, 0x8D, 0x8D, 0x8C, 0x8A, 0x87, 0x84, 0x85, 0x85, 0x86, 0x87,
+    0x87, 0x81, 0x7C, 0x7C, 0x82, 0x88, 0x84, 0x7F, 0x7C, 0x7A, 0x78, 0x79, 0x7B, 0x7E, 0x82, 0x86,
+    0x81, 0x7B, 0x7B, 0x80, 0x85, 0x87, 0x89, 0x88, 0x83, 0x7F, 0x7D, 0x7B, 0x7B, 0x7C, 0x7D, 0x7F,
+    0x80, 0x82, 0x82, 0x82, 0x81, 0x7F, 0x7F, 0x7F, 0x7F, 0x79, 0x73, 0x71, 0x71, 0x72, 0x73, 0x74,
+    0x77, 0x7B, 0x80, 0x7B, 0x77, 0x76, 0x78, 0x7B, 0x75, 0x70, 0x6E, 0x6E, 0x6F, 0x70, 0x72, 0x74,
+    0x78, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x78, 0x74, 0x74, 0x76, 0x78, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x74, 0x71, 0x73, 0x7A, 0x80, 0x7B, 0x75, 0x75, 0x7C, 0x82, 0x82, 0x82, 0x7E, 0x76, 0x6F,
+    0x72, 0x76, 0x79, 0x7D, 0x80, 0x82, 0x83, 0x81, 0x7D, 0x79, 0x77, 0x76, 0x75, 0x75, 0x75, 0x7B,
+    0x81, 0x81, 0x7C, 0x76, 0x79, 0x7C, 0x7C, 0x78, 0x75, 0x78, 0x7C, 0x7F, 0x83, 0x86, 0x80, 0x7A,
+    0x79, 0x7F, 0x84, 0x82, 0x80, 0x81, 0x84, 0x87, 0x86, 0x84, 0x82, 0x7E, 0x7B, 0x80, 0x86, 0x87,
+    0x84, 0x80, 0x7D, 0x7A, 0x79, 0x79, 0x79, 0x7D, 0x80, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7F, 0x7E,
+    0x7D, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x85, 0x89, 0x88, 0x81, 0x7B, 0x80, 0x86, 0x8A, 0x8B, 0x8B,
+    0x86, 0x80, 0x81, 0x87, 0x8D, 0x8C, 0x8A, 0x8A, 0x8B, 0x8C, 0x88, 0x84, 0x82, 0x82, 0x82, 0x83,
+    0x83, 0x86, 0x8A, 0x8E, 0x8B, 0x88, 0x86, 0x84, 0x82, 0x83, 0x83, 0x83, 0x82, 0x80, 0x7F, 0x7D,
+    0x7C, 0x7C, 0x7D, 0x82, 0x87, 0x87, 0x83, 0x80, 0x84, 0x89, 0x89, 0x84, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x81, 0x82, 0x80, 0x7E, 0x7D, 0x7E, 0x80, 0x83, 0x87, 0x89, 0x88, 0x87, 0x87, 0x86, 0x85, 0x84,
+    0x82, 0x84, 0x86, 0x86, 0x86, 0x86, 0x84, 0x81, 0x80, 0x81, 0x81, 0x7D, 0x78, 0x78, 0x7D, 0x81,
+    0x80, 0x7E, 0x7D, 0x7F, 0x80, 0x80, 0x7F, 0x7D, 0x7B, 0x79, 0x77, 0x75, 0x77, 0x7D, 0x82, 0x7D,
+    0x77, 0x76, 0x78, 0x7B, 0x79, 0x78, 0x77, 0x77, 0x77, 0x7A, 0x7D, 0x7F, 0x80, 0x81, 0x7D, 0x78,
+    0x77, 0x7A, 0x7D, 0x7A, 0x78, 0x77, 0x79, 0x7B, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x75, 0x75,
+    0x75, 0x76, 0x7A, 0x7E, 0x7F, 0x7C, 0x7A, 0x78, 0x76, 0x78, 0x7C, 0x80, 0x81, 0x82, 0x81, 0x7D,
+    0x7A, 0x78, 0x76, 0x76, 0x76, 0x77, 0x76, 0x76, 0x76, 0x78, 0x7A, 0x78, 0x76, 0x76, 0x77, 0x79,
+    0x79, 0x79, 0x7A, 0x7C, 0x7E, 0x80, 0x82, 0x83, 0x82, 0x81, 0x80, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7C, 0x7B, 0x7A, 0x7B, 0x7C, 0x7F, 0x83, 0x87, 0x83, 0x7E,
+    0x7D, 0x7F, 0x80, 0x82, 0x83, 0x84, 0x85, 0x86, 0x83, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x80, 0x81, 0x81, 0x81, 0x83, 0x86, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x84, 0x7F, 0x7D, 0x7D,
+    0x7D, 0x80, 0x84, 0x87, 0x88, 0x88, 0x86, 0x84, 0x84, 0x84, 0x84, 0x81, 0x7E, 0x7E, 0x80, 0x82,
+    0x85, 0x88, 0x89, 0x88, 0x87, 0x87, 0x87, 0x88, 0x89, 0x89, 0x85, 0x81, 0x7F, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7F, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x86, 0x85, 0x84, 0x84, 0x83, 0x84, 0x84,
+    0x84, 0x82, 0x80, 0x81, 0x81, 0x80, 0x7D, 0x7B, 0x7E, 0x82, 0x82, 0x7F, 0x7D, 0x80, 0x83, 0x84,
+    0x83, 0x81, 0x80, 0x7E, 0x7C, 0x7B, 0x7A, 0x7A, 0x7B, 0x7C, 0x7E, 0x80, 0x80, 0x80, 0x7F, 0x7C,
+    0x79, 0x78, 0x78, 0x79, 0x7B, 0x7E, 0x7E, 0x7E, 0x7D, 0x7C, 0x7C, 0x7A, 0x79, 0x7A, 0x7C, 0x7E,
+    0x7B, 0x78, 0x77, 0x78, 0x7A, 0x7A, 0x7B, 0x7D, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x7E,
+    0x7C, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7D, 0x80, 0x7F, 0x7E, 0x7D, 0x7B, 0x79, 0x77, 0x76,
+    0x77, 0x79, 0x7C, 0x7C, 0x7D, 0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x7A, 0x7C, 0x7E, 0x7F, 0x80, 0x7F,
+    0x7C, 0x79, 0x78, 0x78, 0x78, 0x79, 0x7B, 0x7B, 0x7B, 0x7C, 0x7D, 0x7F, 0x7D, 0x7B, 0x7B, 0x7E,
+    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7C, 0x7B, 0x7C, 0x80, 0x83, 0x81, 0x7E, 0x7E, 0x80, 0x82,
+    0x80, 0x7E, 0x7D, 0x7D, 0x7D, 0x7F, 0x81, 0x81, 0x80, 0x7E, 0x80, 0x83, 0x84, 0x82, 0x80, 0x7F,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x84, 0x85, 0x84, 0x81, 0x7E, 0x7F, 0x80,
+    0x80, 0x7F, 0x7F, 0x82, 0x85, 0x85, 0x82, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x81, 0x82,
+    0x84, 0x86, 0x86, 0x86, 0x86, 0x85, 0x84, 0x86, 0x87, 0x87, 0x87, 0x86, 0x84, 0x82, 0x80, 0x80,
+    0x80, 0x82, 0x85, 0x86, 0x85, 0x84, 0x82, 0x7F, 0x7F, 0x81, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7E, 0x7D, 0x7D, 0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x82, 0x84, 0x81,
+    0x7E, 0x7E, 0x81, 0x84, 0x82, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x82, 0x82, 0x82, 0x82, 0x81, 0x7F,
+    0x7E, 0x7C, 0x7B, 0x7C, 0x7E, 0x7E, 0x7E, 0x7E, 0x80, 0x81, 0x81, 0x7E, 0x7C, 0x7C, 0x7C, 0x7E,
+    0x80, 0x81, 0x7E, 0x7B, 0x7A, 0x7B, 0x7D, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x7D, 0x7A, 0x79, 0x79,
+    0x79, 0x79, 0x79, 0x7A, 0x7D, 0x80, 0x7E, 0x7C, 0x7B, 0x7D, 0x7F, 0x7F, 0x7F, 0x7F, 0x7D, 0x7B,
+    0x7B, 0x7B, 0x7C, 0x7E, 0x80, 0x7F, 0x7E, 0x7D, 0x7C, 0x7B, 0x7C, 0x7E, 0x7E, 0x7C, 0x7B, 0x7B,
+    0x7B, 0x7A, 0x79, 0x79, 0x7B, 0x7D, 0x7F, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x7E, 0x7B,
+    0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7D, 0x7F, 0x80, 0x81, 0x81, 0x80, 0x7F, 0x7D, 0x7C, 0x7C, 0x7C,
+    0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x80, 0x7E, 0x7D, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x81, 0x82,
+    0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x82, 0x82, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F,
+    0x81, 0x81, 0x80, 0x80, 0x81, 0x83, 0x84, 0x84, 0x83, 0x84, 0x84, 0x83, 0x81, 0x80, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81, 0x7F, 0x80, 0x81,
+    0x83, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80,
+    0x82, 0x82, 0x80, 0x7F, 0x7E, 0x7D, 0x7D, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7F, 0x7D,
+    0x7C, 0x7D, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7D, 0x7B, 0x7B, 0x7C, 0x7C,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x7E, 0x7D, 0x7D, 0x7E,
+    0x80, 0x7E, 0x7D, 0x7C, 0x7C, 0x7C, 0x7D, 0x7E, 0x7F, 0x7F, 0x80, 0x7E, 0x7C, 0x7B, 0x7C, 0x7E,
+    0x7E, 0x7E, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D,
+    0x7E, 0x7F, 0x7F, 0x7F, 0x7E, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x7E, 0x7D,
+    0x7D, 0x7D, 0x7E, 0x7D, 0x7D, 0x7D, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x80,
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
+    0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x82, 0x82, 0x81, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x81, 0x82,
+    0x82, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82,
+    0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x80, 0x80, 0x81, 0x81, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x7F, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7D, 0x7D, 0x7F, 0x80, 0x7F,
+    0x7E, 0x7E, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7E, 0x7D, 0x7D, 0x7E, 0x80, 0x7E, 0x7D,
+    0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7D,
+    0x7C, 0x7C, 0x7D, 0x7E, 0x7E, 0x7F, 0x7D, 0x7C, 0x7C, 0x7E, 0x80, 0x7E, 0x7D, 0x7D, 0x7E, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7D, 0x7D, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80,
+    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81,
+    0x81, 0x81, 0x80, 0x7F, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7F,
+    0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F,
+    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F,
+    0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7E, 0x7D, 0x7D,
+    0x7E, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7E, 0x7D, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7E, 0x7E, 0x7E,
+    0x7F, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F,
+    0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80,
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x80,
+    0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80,
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80,
+};
+
+// moneda: 2400 muestras (120 ms), 4800 bytes
+static const uint16_t clip_moneda[] = {
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCA00, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x39C0, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xC240, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x4180, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xBA80, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x4940, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xA280,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x6100, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x9AC0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x68C0, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0x9300, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x70C0, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0x7B40, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x8880, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x7380, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x9040, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x6B80, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x9800, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0x53C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0xAFC0,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x4C00, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0xB7C0, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x4440, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0xBF80, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0x3C40, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x3300, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xC8C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x3AC0, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xC100, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x5280, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xA940, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x5A80, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xA180, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x6240, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0x99C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x7A00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x81C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x81C0, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x7A00, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x89C0, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0x7240, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x9180, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0x5A80, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0xA940, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x5280, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0xB100, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x4AC0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0xB8C0, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0x3300, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x3440, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xB7C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x4C00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xAFC0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x53C0, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xA800, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x5B80, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0x9040, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x7380, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x8880, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x7B40, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x80C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x8300, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0x78C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x9AC0, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x6100,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0xA280, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x5940, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0xAA80, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0x5180, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0,
+    0x31C0, 0x31C0, 0xC240, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00,
+    0x39C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0x31C0, 0xCA00, 0xCE00,
+    0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0xCE00, 0x31C0, 0x3200, 0x3200, 0x3200,
+    0x71C0, 0xCD80, 0xCD40, 0xCD40, 0xCD40, 0xCD00, 0xCD00, 0xB940, 0x3300, 0x3300, 0x3340, 0x3340,
+    0x3340, 0x3380, 0x3380, 0xC400, 0xCC00, 0xCC00, 0xCBC0, 0xCBC0, 0xCB80, 0xCB80, 0xCB80, 0x5780,
+    0x3480, 0x3480, 0x34C0, 0x34C0, 0x3500, 0x3500, 0x7D80, 0xCA80, 0xCA80, 0xCA80, 0xCA40, 0xCA40,
+    0xCA00, 0xAC00, 0x35C0, 0x3600, 0x3600, 0x3600, 0x3640, 0x3640, 0x3640, 0x39C0, 0xC940, 0xC900,
+    0xC900, 0xC900, 0xC8C0, 0xC8C0, 0xC8C0, 0x4E00, 0x3740, 0x3780, 0x3780, 0x3780, 0x37C0, 0x37C0,
+    0x8880, 0xC7C0, 0xC7C0, 0xC7C0, 0xC780, 0xC780, 0xC780, 0xC740, 0x9100, 0x38C0, 0x38C0, 0x38C0,
+    0x3900, 0x3900, 0x3900, 0x4700, 0xC680, 0xC680, 0xC640, 0xC640, 0xC640, 0xC600, 0xC600, 0x4580,
+    0x3A00, 0x3A00, 0x3A40, 0x3A40, 0x3A40, 0x3A80, 0x3A80, 0xA0C0, 0xC500, 0xC500, 0xC500, 0xC4C0,
+    0xC4C0, 0xC4C0, 0x8600, 0x3B40, 0x3B40, 0x3B80, 0x3B80, 0x3B80, 0x3BC0, 0x3BC0, 0x6140, 0xC3C0,
+    0xC3C0, 0xC3C0, 0xC380, 0xC380, 0xC380, 0xC340, 0x3C80, 0x3C80, 0x3CC0, 0x3CC0, 0x3CC0, 0x3D00,
+    0x3D00, 0xA980, 0xC280, 0xC280, 0xC280, 0xC240, 0xC240, 0xC240, 0xC200, 0x6E80, 0x3DC0, 0x3E00,
+    0x3E00, 0x3E00, 0x3E40, 0x3E40, 0x6C40, 0xC140, 0xC140, 0xC140, 0xC100, 0xC100, 0xC100, 0xB800,
+    0x3F00, 0x3F00, 0x3F40, 0x3F40, 0x3F40, 0x3F80, 0x3F80, 0x3F80, 0xBEC0, 0xC000, 0xC000, 0xBFC0,
+    0xBFC0, 0xBFC0, 0xBF80, 0x6580, 0x4040, 0x4080, 0x4080, 0x4080, 0x4080, 0x40C0, 0x7640, 0xBF00,
+    0xBEC0, 0xBEC0, 0xBEC0, 0xBE80, 0xBE80, 0xBE80, 0x9FC0, 0x4180, 0x4180, 0x41C0, 0x41C0, 0x41C0,
+    0x41C0, 0x4200, 0xBDC0, 0xBDC0, 0xBD80, 0xBD80, 0xBD80, 0xBD40, 0xBD40, 0x5D40, 0x42C0, 0x42C0,
+    0x42C0, 0x42C0, 0x4300, 0x4300, 0x4300, 0x8C40, 0xBC80, 0xBC80, 0xBC40, 0xBC40, 0xBC40, 0xBC40,
+    0x9580, 0x43C0, 0x43C0, 0x4400, 0x4400, 0x4400, 0x4440, 0x4440, 0x5500, 0xBB80, 0xBB40, 0xBB40,
+    0xBB40, 0xBB00, 0xBB00, 0xBB00, 0x4980, 0x4500, 0x4500, 0x4500, 0x4540, 0x4540, 0x4540, 0x9480,
+    0xBA40, 0xBA40, 0xBA40, 0xBA00, 0xBA00, 0xBA00, 0xB9C0, 0x8040, 0x4600, 0x4640, 0x4640, 0x4640,
+    0x4640, 0x4680, 0x5F40, 0xB940, 0xB900, 0xB900, 0xB900, 0xB900, 0xB8C0, 0xB8C0, 0x4700, 0x4740,
+    0x4740, 0x4740, 0x4740, 0x4780, 0x4780, 0x4780, 0xA7C0, 0xB800, 0xB800, 0xB800, 0xB7C0, 0xB7C0,
+    0xB7C0, 0x77C0, 0x4840, 0x4840, 0x4840, 0x4880, 0x4880, 0x4880, 0x68C0, 0xB700, 0xB700, 0xB700,
+    0xB6C0, 0xB6C0, 0xB6C0, 0xB6C0, 0xAA80, 0x4940, 0x4940, 0x4940, 0x4980, 0x4980, 0x4980, 0x49C0,
+    0xAE80, 0xB600, 0xB600, 0xB5C0, 0xB5C0, 0xB5C0, 0xB5C0, 0x7000, 0x4A40, 0x4A40, 0x4A40, 0x4A80,
+    0x4A80, 0x4A80, 0x4AC0, 0x7C80, 0xB500, 0xB500, 0xB4C0, 0xB4C0, 0xB4C0, 0xB4C0, 0xA100, 0x4B40,
+    0x4B40, 0x4B40, 0x4B80, 0x4B80, 0x4B80, 0x4B80, 0x4C40, 0xB400, 0xB400, 0xB3C0, 0xB3C0, 0xB3C0,
+    0xB3C0, 0xB380, 0x5E40, 0x4C40, 0x4C40, 0x4C80, 0x4C80, 0x4C80, 0x4C80, 0x8440, 0xB300, 0xB300,
+    0xB300, 0xB2C0, 0xB2C0, 0xB2C0, 0xB2C0, 0x8DC0, 0x4D40, 0x4D40, 0x4D40, 0x4D80, 0x4D80, 0x4D80,
+    0x55C0, 0xB200, 0xB200, 0xB200, 0xB200, 0xB1C0, 0xB1C0, 0xB1C0, 0x5800, 0x4E40, 0x4E40, 0x4E40,
+    0x4E40, 0x4E80, 0x4E80, 0x4E80, 0x9580, 0xB100, 0xB100, 0xB100, 0xB100, 0xB0C0, 0xB0C0, 0x8600,
+    0x4F00, 0x4F40, 0x4F40, 0x4F40, 0x4F40, 0x4F80, 0x5E80, 0xB040, 0xB040, 0xB000, 0xB000, 0xB000,
+    0xB000, 0xAFC0, 0xAFC0, 0x5000, 0x5000, 0x5000, 0x5040, 0x5040, 0x5040, 0x5040, 0x9BC0, 0xAF40,
+    0xAF40, 0xAF40, 0xAF00, 0xAF00, 0xAF00, 0xAF00, 0x7500, 0x5100, 0x5100, 0x5100, 0x5140, 0x5140,
+    0x5140, 0x7040, 0xAE80, 0xAE40, 0xAE40, 0xAE40, 0xAE40, 0xAE00, 0xA980, 0x51C0, 0x51C0, 0x5200,
+    0x5200, 0x5200, 0x5200, 0x5200, 0x5240, 0xAB00, 0xAD80, 0xAD80, 0xAD40, 0xAD40, 0xAD40, 0xAD40,
+    0x6EC0, 0x52C0, 0x52C0, 0x52C0, 0x52C0, 0x5300, 0x5300, 0x7780, 0xACC0, 0xAC80, 0xAC80, 0xAC80,
+    0xAC80, 0xAC80, 0xAC40, 0x9800, 0x5380, 0x5380, 0x53C0, 0x53C0, 0x53C0, 0x53C0, 0x53C0, 0xABC0,
+    0xABC0, 0xABC0, 0xABC0, 0xABC0, 0xAB80, 0xAB80, 0x68C0, 0x5440, 0x5480, 0x5480, 0x5480, 0x5480,
+    0x5480, 0x54C0, 0x8740, 0xAB00, 0xAB00, 0xAAC0, 0xAAC0, 0xAAC0, 0xAAC0, 0x90C0, 0x5540, 0x5540,
+    0x5540, 0x5540, 0x5540, 0x5580, 0x5740, 0xAA40, 0xAA40, 0xAA00, 0xAA00, 0xAA00, 0xAA00, 0xAA00,
+    0xA9C0, 0x5AC0, 0x5600, 0x5600, 0x5600, 0x5640, 0x5640, 0x5640, 0x8D40, 0xA980, 0xA940, 0xA940,
+    0xA940, 0xA940, 0xA940, 0xA900, 0x8180, 0x56C0, 0x56C0, 0x5700, 0x5700, 0x5700, 0x5700, 0x6740,
+    0xA880, 0xA880, 0xA880, 0xA880, 0xA880, 0xA840, 0xA840, 0x5780, 0x5780, 0x5780, 0x57C0, 0x57C0,
+    0x57C0, 0x57C0, 0x57C0, 0x9AC0, 0xA7C0, 0xA7C0, 0xA7C0, 0xA7C0, 0xA780, 0xA780, 0x7B80, 0x5840,
+    0x5840, 0x5880, 0x5880, 0x5880, 0x5880, 0x6E00, 0xA700, 0xA700, 0xA700, 0xA700, 0xA700, 0xA6C0,
+    0xA6C0, 0x9F80, 0x5900, 0x5900, 0x5900, 0x5940, 0x5940, 0x5940, 0x5940, 0x9FC0, 0xA640, 0xA640,
+    0xA640, 0xA640, 0xA640, 0xA600, 0x7600, 0x59C0, 0x59C0, 0x59C0, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
+    0x7C00, 0xA5C0, 0xA580, 0xA580, 0xA580, 0xA580, 0xA580, 0x98C0, 0x5A80, 0x5A80, 0x5A80, 0x5A80,
+    0x5AC0, 0x5AC0, 0x5AC0, 0xA400, 0xA500, 0xA500, 0xA4C0, 0xA4C0, 0xA4C0, 0xA4C0, 0xA4C0, 0x6940,
+    0x5B40, 0x5B40, 0x5B40, 0x5B40, 0x5B80, 0x5B80, 0x81C0, 0xA440, 0xA440, 0xA440, 0xA400, 0xA400,
+    0xA400, 0xA400, 0x8B00, 0x5BC0, 0x5C00, 0x5C00, 0x5C00, 0x5C00, 0x5C00, 0x6080, 0xA380, 0xA380,
+    0xA380, 0xA380, 0xA380, 0xA340, 0xA340, 0x64C0, 0x5C80, 0x5C80, 0x5CC0, 0x5CC0, 0x5CC0, 0x5CC0,
+    0x5CC0, 0x8E00, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0xA2C0, 0x8580, 0x5D40, 0x5D40, 0x5D40,
+    0x5D40, 0x5D40, 0x5D80, 0x6700, 0xA240, 0xA240, 0xA240, 0xA200, 0xA200, 0xA200, 0xA200, 0xA200,
+    0x5DC0, 0x5E00, 0x5E00, 0x5E00, 0x5E00, 0x5E00, 0x5E00, 0x9280, 0xA180, 0xA180, 0xA180, 0xA180,
+    0xA180, 0xA140, 0x8040, 0x5E80, 0x5E80, 0x5E80, 0x5E80, 0x5EC0, 0x5EC0, 0x5EC0, 0x7380, 0xA100,
+    0xA100, 0xA0C0, 0xA0C0, 0xA0C0, 0xA0C0, 0x9E80, 0x5F00, 0x5F40, 0x5F40, 0x5F40, 0x5F40, 0x5F40,
+    0x5F40, 0x5F80, 0x9D80, 0xA040, 0xA040, 0xA040, 0xA040, 0xA000, 0xA000, 0x74C0, 0x5FC0, 0x5FC0,
+    0x5FC0, 0x5FC0, 0x6000, 0x6000, 0x78C0, 0x9FC0, 0x9FC0, 0x9FC0, 0x9F80, 0x9F80, 0x9F80, 0x9F80,
+    0x9240, 0x6040, 0x6080, 0x6080, 0x6080, 0x6080, 0x6080, 0x6080, 0x9F40, 0x9F00, 0x9F00, 0x9F00,
+    0x9F00, 0x9F00, 0x9F00, 0x7080, 0x6100, 0x6100, 0x6100, 0x6100, 0x6100, 0x6100, 0x6140, 0x8400,
+    0x9E80, 0x9E80, 0x9E80, 0x9E80, 0x9E40, 0x9E40, 0x8D00, 0x6180, 0x6180, 0x6180, 0x6180, 0x61C0,
+    0x61C0, 0x6200, 0x9E00, 0x9E00, 0x9E00, 0x9DC0, 0x9DC0, 0x9DC0, 0x9DC0, 0x9DC0, 0x6680, 0x6200,
+    0x6240, 0x6240, 0x6240, 0x6240, 0x6240, 0x8840, 0x9D80, 0x9D40, 0x9D40, 0x9D40, 0x9D40, 0x9D40,
+    0x8800, 0x6280, 0x62C0, 0x62C0, 0x62C0, 0x62C0, 0x62C0, 0x62C0, 0x6D40, 0x9CC0, 0x9CC0, 0x9CC0,
+    0x9CC0, 0x9CC0, 0x9CC0, 0x9C80, 0x6340, 0x6340, 0x6340, 0x6340, 0x6340, 0x6340, 0x6380, 0x6380,
+    0x9200, 0x9C40, 0x9C40, 0x9C40, 0x9C40, 0x9C00, 0x9C00, 0x7DC0, 0x63C0, 0x63C0, 0x63C0, 0x63C0,
+    0x63C0, 0x6400, 0x7240, 0x9BC0, 0x9BC0, 0x9BC0, 0x9BC0, 0x9BC0, 0x9B80, 0x9B80, 0x9780, 0x6440,
+    0x6440, 0x6440, 0x6440, 0x6480, 0x6480, 0x6480, 0x9580, 0x9B40, 0x9B40, 0x9B40, 0x9B00, 0x9B00,
+    0x9B00, 0x79C0, 0x64C0, 0x64C0, 0x64C0, 0x64C0, 0x6500, 0x6500, 0x6500, 0x7C40, 0x9AC0, 0x9AC0,
+    0x9AC0, 0x9A80, 0x9A80, 0x9A80, 0x9280, 0x6540, 0x6540, 0x6540, 0x6540, 0x6580, 0x6580, 0x6580,
+    0x98C0, 0x9A40, 0x9A40, 0x9A40, 0x9A00, 0x9A00, 0x9A00, 0x9A00, 0x70C0, 0x65C0, 0x65C0, 0x65C0,
+    0x6600, 0x6600, 0x6600, 0x8040, 0x99C0, 0x99C0, 0x99C0, 0x99C0, 0x9980, 0x9980, 0x8E00, 0x6640,
+    0x6640, 0x6640, 0x6640, 0x6680, 0x6680, 0x6680, 0x68C0, 0x9940, 0x9940, 0x9940, 0x9940, 0x9900,
+    0x9900, 0x9900, 0x6D80, 0x66C0, 0x66C0, 0x66C0, 0x66C0, 0x6700, 0x6700, 0x6700, 0x8900, 0x98C0,
+    0x98C0, 0x98C0, 0x98C0, 0x9880, 0x9880, 0x84C0, 0x6740, 0x6740, 0x6740, 0x6740, 0x6740, 0x6780,
+    0x6D40, 0x9840, 0x9840, 0x9840, 0x9840, 0x9840, 0x9840, 0x9840, 0x9800, 0x67C0, 0x67C0, 0x67C0,
+    0x67C0, 0x67C0, 0x67C0, 0x67C0, 0x8C40, 0x97C0, 0x97C0, 0x97C0, 0x97C0, 0x97C0, 0x97C0, 0x8100,
+    0x6840, 0x6840, 0x6840, 0x6840, 0x6840, 0x6840, 0x6840, 0x7640, 0x9780, 0x9740, 0x9740, 0x9740,
+    0x9740, 0x9740, 0x9680, 0x6880, 0x6880, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x68C0, 0x8F40, 0x9700,
+    0x9700, 0x9700, 0x96C0, 0x96C0, 0x96C0, 0x96C0, 0x78C0, 0x6900, 0x6900, 0x6900, 0x6900, 0x6940,
+    0x6940, 0x7A00, 0x9680, 0x9680, 0x9680, 0x9680, 0x9680, 0x9640, 0x9240, 0x6980, 0x6980, 0x6980,
+    0x6980, 0x6980, 0x6980, 0x6980, 0x69C0, 0x9600, 0x9600, 0x9600, 0x9600, 0x9600, 0x9600, 0x9600,
+    0x75C0, 0x6A00, 0x6A00, 0x6A00, 0x6A00, 0x6A00, 0x6A00, 0x6A00, 0x8200, 0x95C0, 0x95C0, 0x9580,
+    0x9580, 0x9580, 0x9580, 0x8A00, 0x6A40, 0x6A40, 0x6A40, 0x6A40, 0x6A80, 0x6A80, 0x6A80, 0x9540,
+    0x9540, 0x9540, 0x9540, 0x9540, 0x9540, 0x9500, 0x9500, 0x6E80, 0x6AC0, 0x6AC0, 0x6AC0, 0x6AC0,
+    0x6AC0, 0x6AC0, 0x8500, 0x94C0, 0x94C0, 0x94C0, 0x94C0, 0x94C0, 0x94C0, 0x8680, 0x6B00, 0x6B00,
+    0x6B40, 0x6B40, 0x6B40, 0x6B40, 0x6B40, 0x7200, 0x9480, 0x9480, 0x9480, 0x9480, 0x9440, 0x9440,
+    0x9440, 0x6C40, 0x6B80, 0x6B80, 0x6B80, 0x6B80, 0x6B80, 0x6B80, 0x8800, 0x9400, 0x9400, 0x9400,
+    0x9400, 0x9400, 0x9400, 0x9400, 0x7F00, 0x6BC0, 0x6C00, 0x6C00, 0x6C00, 0x6C00, 0x6C00, 0x7580,
+    0x93C0, 0x93C0, 0x93C0, 0x93C0, 0x9380, 0x9380, 0x9380, 0x9140, 0x6C40, 0x6C40, 0x6C40, 0x6C40,
+    0x6C40, 0x6C40, 0x6C80, 0x8E80, 0x9340, 0x9340, 0x9340, 0x9340, 0x9340, 0x9340, 0x7C40, 0x6C80,
+    0x6CC0, 0x6CC0, 0x6CC0, 0x6CC0, 0x6CC0, 0x6CC0, 0x7C80, 0x9300, 0x9300, 0x9300, 0x9300, 0x92C0,
+    0x92C0, 0x8DC0, 0x6D00, 0x6D00, 0x6D00, 0x6D00, 0x6D00, 0x6D00, 0x6D00, 0x90C0, 0x9280, 0x9280,
+    0x9280, 0x9280, 0x9280, 0x9280, 0x9280, 0x75C0, 0x6D40, 0x6D40, 0x6D80, 0x6D80, 0x6D80, 0x6D80,
+    0x7F80, 0x9240, 0x9240, 0x9240, 0x9240, 0x9240, 0x9240, 0x8A80, 0x6DC0, 0x6DC0, 0x6DC0, 0x6DC0,
+    0x6DC0, 0x6DC0, 0x6DC0, 0x6EC0, 0x9200, 0x9200, 0x91C0, 0x91C0, 0x91C0, 0x91C0, 0x91C0, 0x7380,
+    0x6E00, 0x6E00, 0x6E00, 0x6E00, 0x6E00, 0x6E40, 0x8240, 0x9180, 0x9180, 0x9180, 0x9180, 0x9180,
+    0x9180, 0x9180, 0x8400, 0x6E40, 0x6E80, 0x6E80, 0x6E80, 0x6E80, 0x6E80, 0x7200, 0x9140, 0x9140,
+    0x9140, 0x9140, 0x9140, 0x9140, 0x9100, 0x9100, 0x6EC0, 0x6EC0, 0x6EC0, 0x6EC0, 0x6EC0, 0x6EC0,
+    0x6EC0, 0x8840, 0x9100, 0x9100, 0x90C0, 0x90C0, 0x90C0, 0x90C0, 0x8140, 0x6F00, 0x6F00, 0x6F00,
+    0x6F00, 0x6F00, 0x6F00, 0x6F40, 0x7880, 0x9080, 0x9080, 0x9080, 0x9080, 0x9080, 0x9080, 0x9080,
+    0x6F40, 0x6F40, 0x6F40, 0x6F40, 0x6F80, 0x6F80, 0x6F80, 0x8A40, 0x9040, 0x9040, 0x9040, 0x9040,
+    0x9040, 0x9040, 0x9040, 0x7B80, 0x6FC0, 0x6FC0, 0x6FC0, 0x6FC0, 0x6FC0, 0x6FC0, 0x7B40, 0x9000,
+    0x9000, 0x9000, 0x9000, 0x9000, 0x8FC0, 0x8D80, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000,
+    0x7000, 0x7000, 0x8F80, 0x8FC0, 0x8FC0, 0x8F80, 0x8F80, 0x8F80, 0x8F80, 0x7940, 0x7040, 0x7040,
+    0x7040, 0x7040, 0x7040, 0x7040, 0x7DC0, 0x8F80, 0x8F40, 0x8F40, 0x8F40, 0x8F40, 0x8F40, 0x8F40,
+    0x8780, 0x7080, 0x7080, 0x7080, 0x7080, 0x7080, 0x7080, 0x70C0, 0x8F00, 0x8F00, 0x8F00, 0x8F00,
+    0x8F00, 0x8F00, 0x8F00, 0x8F00, 0x7440, 0x70C0, 0x70C0, 0x70C0, 0x7100, 0x7100, 0x7100, 0x8300,
+    0x8EC0, 0x8EC0, 0x8EC0, 0x8EC0, 0x8EC0, 0x8EC0, 0x8500, 0x7100, 0x7100, 0x7140, 0x7140, 0x7140,
+    0x7140, 0x7140, 0x7580, 0x8E80, 0x8E80, 0x8E80, 0x8E80, 0x8E80, 0x8E80, 0x8E80, 0x7280, 0x7180,
+    0x7180, 0x7180, 0x7180, 0x7180, 0x7180, 0x8500, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40, 0x8E40,
+    0x8E40, 0x7FC0, 0x71C0, 0x71C0, 0x71C0, 0x71C0, 0x71C0, 0x71C0, 0x7800, 0x8E00, 0x8E00, 0x8E00,
+    0x8E00, 0x8E00, 0x8E00, 0x8DC0, 0x7200, 0x7200, 0x7200, 0x7200, 0x7200, 0x7200, 0x7200, 0x7200,
+    0x89C0, 0x8DC0, 0x8DC0, 0x8DC0, 0x8DC0, 0x8DC0, 0x8D80, 0x7DC0, 0x7240, 0x7240, 0x7240, 0x7240,
+    0x7240, 0x7240, 0x7A40, 0x8D80, 0x8D80, 0x8D80, 0x8D80, 0x8D80, 0x8D40, 0x8D40, 0x8A40, 0x7280,
+    0x7280, 0x7280, 0x7280, 0x7280, 0x7280, 0x7280, 0x8B80, 0x8D40, 0x8D40, 0x8D40, 0x8D40, 0x8D00,
+    0x8D00, 0x8D00, 0x7940, 0x72C0, 0x72C0, 0x72C0, 0x72C0, 0x72C0, 0x72C0, 0x7F40, 0x8D00, 0x8D00,
+    0x8D00, 0x8D00, 0x8CC0, 0x8CC0, 0x8800, 0x7300, 0x7300, 0x7300, 0x7300, 0x7300, 0x7300, 0x7300,
+    0x7340, 0x8CC0, 0x8CC0, 0x8CC0, 0x8CC0, 0x8CC0, 0x8C80, 0x8C80, 0x7780, 0x7340, 0x7340, 0x7340,
+    0x7340, 0x7340, 0x7340, 0x8100, 0x8C80, 0x8C80, 0x8C80, 0x8C80, 0x8C80, 0x8C80, 0x8C40, 0x8340,
+    0x7380, 0x7380, 0x7380, 0x7380, 0x7380, 0x7380, 0x7580, 0x8C40, 0x8C40, 0x8C40, 0x8C40, 0x8C40,
+    0x8C40, 0x8C40, 0x7600, 0x73C0, 0x73C0, 0x73C0, 0x73C0, 0x73C0, 0x73C0, 0x73C0, 0x8540, 0x8C00,
+    0x8C00, 0x8C00, 0x8C00, 0x8C00, 0x8C00, 0x8140, 0x7400, 0x7400, 0x7400, 0x7400, 0x7400, 0x7400,
+    0x7400, 0x7A40, 0x8BC0, 0x8BC0, 0x8BC0, 0x8BC0, 0x8BC0, 0x8BC0, 0x8BC0, 0x7400, 0x7400, 0x7440,
+    0x7440, 0x7440, 0x7440, 0x7440, 0x86C0, 0x8B80, 0x8B80, 0x8B80, 0x8B80, 0x8B80, 0x8B80, 0x8B80,
+    0x7D00, 0x7440, 0x7440, 0x7440, 0x7480, 0x7480, 0x7480, 0x7C40, 0x8B40, 0x8B40, 0x8B40, 0x8B40,
+    0x8B40, 0x8B40, 0x8A00, 0x7480, 0x7480, 0x7480, 0x7480, 0x7480, 0x7480, 0x7480, 0x74C0, 0x8A80,
+    0x8B00, 0x8B00, 0x8B00, 0x8B00, 0x8B00, 0x8B00, 0x7B80, 0x74C0, 0x74C0, 0x74C0, 0x74C0, 0x74C0,
+    0x74C0, 0x7E00, 0x8B00, 0x8B00, 0x8AC0, 0x8AC0, 0x8AC0, 0x8AC0, 0x8AC0, 0x85C0, 0x7500, 0x7500,
+    0x7500, 0x7500, 0x7500, 0x7500, 0x7500, 0x8AC0, 0x8AC0, 0x8AC0, 0x8AC0, 0x8AC0, 0x8A80, 0x8A80,
+    0x7A00, 0x7540, 0x7540, 0x7540, 0x7540, 0x7540, 0x7540, 0x7540, 0x81C0, 0x8A80, 0x8A80, 0x8A80,
+};
+
+const ClipPCM clips_pcm[CLIPS_PCM_CANTIDAD] = {
+    { clip_golpe, 3000, CLIP_PCM_8 },
+    { clip_moneda, 2400, CLIP_PCM_10 },
+};
@@ -0,0 +1,115 @@
+/**
+ * @file cola_spsc.c
+ * @brief Cola de bytes de un productor y un consumidor (C puro).
+ *
+ * Cada lado lee su propio índice sin sincronizar (nadie más lo escribe) y
+ * el del otro con acquire; publica el suyo con release después de tocar
+ * el dato. Así el consumidor nunca ve un índice adelantado a un byte que
+ * todavía no se escribió, y el productor nunca pisa un byte que el
+ * consumidor todavía no leyó.
+ *
+ * @date Noviembre 2025
+ */
+
+#include "cola_spsc.h"
+#include <stddef.h>
+
+uint8_t cola_spsc_inicializar(ColaSpsc *cola, uint8_t *datos, uint32_t tamano) {
+    if (cola == NULL || datos == NULL || tamano == 0 || (tamano & (tamano - 1)) != 0) {
+        return 0;
+    }
+    cola->datos = datos;
+    cola->mascara = tamano - 1;
+    cola->escritura = 0;
+    cola->lectura = 0;
+    cola->descartados = 0;
+    cola->maximo_ocupado = 0;
+    return 1;
+}
+
+uint8_t cola_spsc_poner(ColaSpsc *cola, uint8_t byte) {
+    uint32_t escritura = cola->escritura;
+    uint32_t lectura = __atomic_load_n(&cola->lectura, __ATOMIC_ACQUIRE);
+    uint32_t ocupados = escritura - lectura;
+
+    if (ocupados > cola->mascara) {
+        __atomic_store_n(&cola->descartados, cola->descartados + 1, __ATOMIC_RELAXED);
+        return 0;
+    }
+
+    cola->datos[escritura & cola->mascara] = byte;
+    __atomic_store_n(&cola->escritura, escritura + 1, __ATOMIC_RELEASE);
+
+    if (ocupados + 1 > cola->maximo_ocupado) {
+        __atomic_store_n(&cola->maximo_ocupado, ocupados + 1, __ATOMIC_RELAXED);
+    }
+    return 1;
+}
+
+uint8_t cola_spsc_poner_bloque(ColaSpsc *cola, const uint8_t *bytes, uint32_t n) {
+    uint32_t escritura = cola->escritura;
+    uint32_t lectura = __atomic_load_n(&cola->lectura, __ATOMIC_ACQUIRE);
+    uint32_t ocupados = escritura - lectura;
+
+    if (n > cola->mascara + 1 - ocupados) {
+        __atomic_store_n(&cola->descartados, cola->descartados + n, __ATOMIC_RELAXED);
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        cola->datos[(escritura + i) & cola->mascara] = bytes[i];
+    }
+    __atomic_store_n(&cola->escritura, escritura + n, __ATOMIC_RELEASE);
+
+    if (ocupados + n > cola->maximo_ocupado) {
+        __atomic_store_n(&cola->maximo_ocupado, ocupados + n, __ATOMIC_RELAXED);
+    }
+    return 1;
+}
+
+uint32_t cola_spsc_libres(const ColaSpsc *cola) {
+    uint32_t lectura = __atomic_load_n(&cola->lectura, __ATOMIC_ACQUIRE);
+    return cola->mascara + 1 - (cola->escritura - lectura);
+}
+
+int cola_spsc_sacar(ColaSpsc *cola) {
+    uint32_t lectura = cola->lectura;
+    uint32_t escritura = __atomic_load_n(&cola->escritura, __ATOMIC_ACQUIRE);
+
+    if (lectura == escritura) {
+        return -1;
+    }
+
+    uint8_t byte = cola->datos[lectura & cola->mascara];
+    __atomic_store_n(&cola->lectura, lectura + 1, __ATOMIC_RELEASE);
+    return byte;
+}
+
+uint32_t cola_spsc_tramo(const ColaSpsc *cola, const uint8_t **inicio) {
+    uint32_t lectura = cola->lectura;
+    uint32_t escritura = __atomic_load_n(&cola->escritura, __ATOMIC_ACQUIRE);
+    uint32_t posicion = lectura & cola->mascara;
+    uint32_t hasta_el_final = cola->mascara + 1 - posicion;
+    uint32_t disponibles = escritura - lectura;
+
+    *inicio = &cola->datos[posicion];
+    return disponibles < hasta_el_final ? disponibles : hasta_el_final;
+}
+
+void cola_spsc_liberar(ColaSpsc *cola, uint32_t n) {
+    __atomic_store_n(&cola->lectura, cola->lectura + n, __ATOMIC_RELEASE);
+}
+
+uint32_t cola_spsc_ocupados(const ColaSpsc *cola) {
+    uint32_t escritura = __atomic_load_n(&cola->escritura, __ATOMIC_ACQUIRE);
+    uint32_t lectura = __atomic_load_n(&cola->lectura, __ATOMIC_ACQUIRE);
+    return escritura - lectura;
+}
+
+uint32_t cola_spsc_descartados(const ColaSpsc *cola) {
+    return __atomic_load_n(&cola->descartados, __ATOMIC_RELAXED);
+}
+
+uint32_t cola_spsc_maximo_ocupado(const ColaSpsc *cola) {
+    return __atomic_load_n(&cola->maximo_ocupado, __ATOMIC_RELAXED);
+}
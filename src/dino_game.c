@@ -9,26 +9,28 @@
  * - P0.26: Salida DAC para melodías (usado por melodias_dac.c)
  *
  * Timers utilizados:
- * - TIMER0: Sistema de melodías DAC (melodias_dac.c) - Generación de audio
- * - TIMER1: Sistema de melodías DAC (melodias_dac.c) - Contador de tiempo
- * - TIMER2: Motor del juego (este archivo) - Ticks de 50ms (20 Hz)
+ * - TIMER1: Sistema de melodías DAC (melodias_dac.c) - Tiempo y secuenciador
+ * - SysTick: Planificador (planificador.c) - Tarea del juego cada 50ms (20 Hz)
  *
  * Arquitectura:
- * - TIMER2_IRQHandler setea un flag (game_tick_flag) cada 50ms
+ * - El planificador libera la tarea del juego cada 50ms desde SysTick
  * - El main loop procesa el tick: actualiza física, detección, dibuja
  * - Las funciones I2C/LCD se llaman SOLO desde el main loop (nunca desde ISR)
- * - Las melodías se actualizan con melodias_actualizar() (no bloqueante)
+ * - Las melodías avanzan en la ISR de TIMER1, aunque el main loop se demore
+ * - Cada tick viaja al espectador remoto como un registro de espectador.h
  *
  * @date Noviembre 2025
  */
 
 #include "dino_game.h"
-#include "lcd_i2c.h"
+#include "lcd_framebuffer.h"
 #include "melodias_dac.h"  // Sistema de melodías
+#include "clips_pcm.h"     // Golpe del choque
 #include "bluetooth_uart.h" // Comandos Bluetooth
+#include "planificador.h"   // Tick del juego (SysTick)
+#include "espectador.h"     // Ticks para el espectador remoto
 #include "LPC17xx.h"
 #include "lpc17xx_pinsel.h"
-#include "lpc17xx_timer.h"
 
 #include <stdint.h>
 #include <string.h>
@@ -59,8 +61,8 @@
 
 /* ========================== VARIABLES DE ESTADO ========================== */
 
-/* Flag de tick del timer (seteado por TIMER2_IRQHandler cada 50ms) */
-static volatile uint8_t bandera_tick_juego = 0;
+/* Tarea del planificador que libera un tick cada 50ms */
+static uint8_t tarea_tick_juego = PLANIFICADOR_SIN_TAREA;
 
 /* Array de obstáculos (0 = vacío, 1-3 = tamaño del obstáculo) */
 static uint8_t obstaculos[COLUMNAS_DINO];
@@ -97,6 +99,10 @@ static uint8_t umbral_spawn = UMBRAL_SPAWN_BASE; /* Umbral de spawn (0-255) */
 static int frame_actual = 0;        /* Frame actual de animación (0 o 1) */
 static int contador_animacion = 0;    /* Contador para velocidad de animación */
 
+/* Espectador remoto */
+static EspectadorTick tick_espectador;     /* Lo que cambió en actualizar_tick_juego() */
+static uint8_t foto_pendiente = 0;         /* El espectador espera el estado completo */
+
 /* ========================== DECLARACIONES FORWARD ======================== */
 
 static void actualizar_animacion_dino(void);
@@ -174,6 +180,18 @@ static uint16_t generar_aleatorio_lfsr16(void) {
     return l;
 }
 
+/**
+ * @brief Altura del sprite en filas (0 = suelo, 1 o 2 en el aire).
+ *
+ * Umbrales conservadores sobre posicion_vertical_dino para evitar
+ * parpadeos.
+ */
+static uint8_t altura_dino(void) {
+    if (posicion_vertical_dino >= 10) return 2;     /* muy alto */
+    if (posicion_vertical_dino >= 5) return 1;      /* medio */
+    return 0;                                       /* en el suelo */
+}
+
 /**
  * @brief Dibuja el frame completo del juego en el LCD.
  *
@@ -181,29 +199,19 @@ static uint16_t generar_aleatorio_lfsr16(void) {
  * - Dinosaurio en su posición con altura de salto calculada
  * - Obstáculos en la fila inferior (pueden ser múltiples '#' consecutivos)
  *
- * Optimizado para evitar parpadeo usando dibujo directo sin borrado previo.
+ * Dibuja en el framebuffer; al volcarlo solo se envían las celdas que
+ * cambiaron (obstáculos desplazados y sprite del dinosaurio).
  */
 static void dibujar_pantalla_juego(void) {
     /* Calcular altura del salto del dinosaurio
        Altura ajustada dinámicamente según la duración del salto actual
        y la velocidad de caída */
-    int height = 0;
-
-    /* Umbrales más conservadores para evitar parpadeos */
-    if (posicion_vertical_dino >= 10) {
-        height = 2;      /* muy alto */
-    } else if (posicion_vertical_dino >= 5) {
-        height = 1;      /* medio */
-    } else {
-        height = 0;      /* en el suelo */
-    }
+    int height = altura_dino();
 
     int fila_inferior_dino = FILA_SUELO_DINO - height;
 
     /* Dibujar fila por fila (filas 1-3, la 0 es para marcadores) */
     for (int row = 1; row <= FILA_SUELO_DINO; row++) {
-        lcd_establecer_cursor(row, 0);
-
         for (int col = 0; col < COLUMNAS_DINO; col++) {
             char ch = ' '; /* por defecto vacío */
 
@@ -236,11 +244,69 @@ static void dibujar_pantalla_juego(void) {
                 }
             }
 
-            lcd_escribir_byte(ch);
+            lcd_fb_escribir_caracter(row, col, ch);
         }
     }
 }
 
+/* ========================== ESPECTADOR ==================================== */
+
+/**
+ * @brief Manda el tick que acaba de dibujarse (física de actualizar_tick_juego() + pose)
+ */
+static void transmitir_tick(void) {
+    if (!bt_espectador_activo()) return;
+
+    EspectadorTrama trama;
+    tick_espectador.altura = altura_dino();
+    tick_espectador.cuadro = (uint8_t)frame_actual;
+
+    espectador_iniciar_trama(&trama);
+    espectador_poner_tick(&trama, &tick_espectador);
+    bt_enviar_juego(trama.carga, trama.largo);
+}
+
+/**
+ * @brief Manda la pantalla de Game Over
+ */
+static void transmitir_fin(void) {
+    if (!bt_espectador_activo()) return;
+
+    EspectadorTrama trama;
+    espectador_iniciar_trama(&trama);
+    espectador_poner_marca(&trama, ESPECTADOR_FIN);
+    bt_enviar_juego(trama.carga, trama.largo);
+}
+
+/**
+ * @brief Responde un pedido de foto del espectador
+ */
+static void atender_espectador(void) {
+    uint8_t pedido = bt_obtener_pedido_foto();
+
+    if (!bt_espectador_activo()) {
+        foto_pendiente = 0;
+        return;
+    }
+    if (pedido) foto_pendiente = 1;
+    if (!foto_pendiente) return;
+
+    EspectadorTrama trama;
+    EspectadorFotoDino foto;
+    foto.altura = altura_dino();
+    foto.cuadro = (uint8_t)frame_actual;
+    foto.puntuacion = (uint16_t)puntuacion;
+    foto.ticks = ticks_desde_inicio;
+    memcpy(foto.obstaculos, obstaculos, sizeof(foto.obstaculos));
+    foto.estado = juego_terminado ? ESPECTADOR_TERMINADO : ESPECTADOR_JUGANDO;
+
+    espectador_iniciar_trama(&trama);
+    espectador_poner_foto_dino(&trama, &foto);
+    if (bt_enviar_juego(trama.carga, trama.largo)) {
+        foto_pendiente = 0;
+    }
+}
+
 /**
  * @brief Comprueba si hay colisión entre el dinosaurio y un obstáculo.
  *
@@ -272,8 +338,9 @@ static void verificar_colision(void) {
     /* Verificar si hay obstáculo en la columna del dinosaurio */
     if (obstaculos[columna_dino]) {
         juego_terminado = 1;
-        /* Detener música de fondo antes de reproducir melodía de game over */
+        /* Detener música de fondo; el golpe suena antes de la melodía de game over */
         melodias_detener();
+        melodias_clip_reproducir(&clips_pcm[CLIP_GOLPE]);
         melodias_iniciar(melodia_game_over);
     }
 }
@@ -329,6 +396,10 @@ void juego_dinosaurio_reiniciar(void) {
 static void actualizar_tick_juego(void) {
     if (juego_terminado) return;
 
+    tick_espectador.desplazo = 0;
+    tick_espectador.obstaculo = 0;
+    tick_espectador.punto = 0;
+
     /* Contador global de ticks (para ajustar dificultad con el tiempo) */
     ticks_desde_inicio++;
 
@@ -382,6 +453,8 @@ static void actualizar_tick_juego(void) {
     } else {
         obstaculos[COLUMNAS_DINO - 1] = 0;
     }
+    tick_espectador.desplazo = 1;
+    tick_espectador.obstaculo = obstaculos[COLUMNAS_DINO - 1];
 
      /* Ajustar dificultad dinámicamente según puntuación (cada obstáculo pasado).
          - intervalo_movimiento baja gradualmente (obstáculos se mueven más rápido).
@@ -406,54 +479,7 @@ static void actualizar_tick_juego(void) {
     int ahora_en_dino = obstaculos[columna_dino];
     if (habia_en_dino && !ahora_en_dino && !juego_terminado) {
         puntuacion++;
-    }
-}
-
-/**
- * @brief Inicializa TIMER2 para generar ticks de juego cada 50ms.
- *
- * Configura TIMER2 en modo contador con prescaler de 1ms y match en 50ms.
- * Genera interrupción periódica que setea bandera_tick_juego para actualización
- * del juego en el main loop.
- */
-static void inicializar_timer2(void) {
-    TIM_TIMERCFG_Type configuracion_timer;
-    TIM_MATCHCFG_Type configuracion_match;
-
-    /* Configurar prescaler para base de tiempo de 1ms */
-    configuracion_timer.prescaleOption = TIM_USVAL;
-    configuracion_timer.prescaleValue = 1000; /* 1ms base time */
-
-    TIM_Init(LPC_TIM2, TIM_TIMER_MODE, &configuracion_timer);
-
-    /* Configurar match para período de tick del juego (50ms) */
-    configuracion_match.matchChannel = TIM_MATCH_CHANNEL_0;
-    configuracion_match.intOnMatch = ENABLE;        /* Generar interrupción */
-    configuracion_match.resetOnMatch = ENABLE;      /* Reset automático en match */
-    configuracion_match.stopOnMatch = DISABLE;      /* Continuar después del match */
-    configuracion_match.extMatchOutputType = TIM_NOTHING;
-    configuracion_match.matchValue = TICK_MS;       /* 50ms tick rate */
-
-    TIM_ConfigMatch(LPC_TIM2, &configuracion_match);
-
-    /* Habilitar interrupción TIMER2 en NVIC */
-    NVIC_EnableIRQ(TIMER2_IRQn);
-
-    /* Iniciar TIMER2 */
-    TIM_Cmd(LPC_TIM2, ENABLE);
-}
-
-/**
- * @brief Handler de interrupción de TIMER2.
- *
- * Se ejecuta cada 50ms (20 Hz) cuando TIMER2 alcanza el valor de match.
- * Setea la bandera bandera_tick_juego para indicar al main loop que debe
- * procesar un tick de juego. Mantiene la ISR lo más breve posible.
- */
-void TIMER2_IRQHandler(void) {
-    if (TIM_GetIntStatus(LPC_TIM2, TIM_MR0_INT)) {
-        bandera_tick_juego = 1;
-        TIM_ClearIntPending(LPC_TIM2, TIM_MR0_INT);
+        tick_espectador.punto = 1;
     }
 }
 
@@ -462,12 +488,9 @@ void TIMER2_IRQHandler(void) {
  *
  * Configura:
  * - P0.4 como GPIO input con pull-up para el botón de salto
- * - TIMER2 para generar ticks de juego cada 50ms
+ * - Tarea del planificador para generar ticks de juego cada 50ms
  * - Estado inicial del juego
  * - Pantalla inicial en LCD
- *
- * Nota: Deshabilita TIMER0_IRQn para evitar conflictos con otras ISRs
- * que puedan escribir en el LCD simultáneamente.
  */
 void juego_dinosaurio_inicializar(void) {
     /* NOTA: P0.4 YA está configurado como GPIO input con PULL-UP en main.c
@@ -476,14 +499,8 @@ void juego_dinosaurio_inicializar(void) {
     /* Asegurar que P0.4 es entrada (sin tocar el pinMode) */
     LPC_GPIO0->FIODIR &= ~(1u << PIN_BOTON_DINO);
 
-    /* Deshabilitar IRQ de TIMER2 por si estaba activo */
-    NVIC_DisableIRQ(TIMER2_IRQn);
-    
-    /* Limpiar flag de tick pendiente */
-    bandera_tick_juego = 0;
-    
-    /* Iniciar TIMER2 para ticks del juego (TIM_Init ya resetea el timer) */
-    inicializar_timer2();
+    /* (Re)iniciar la tarea de 50ms: descarta un tick pendiente de la partida anterior */
+    planificador_crear_tarea(&tarea_tick_juego, TICK_MS, TICK_MS);
 
     /* Resetear estado del juego */
     juego_dinosaurio_reiniciar();
@@ -492,13 +509,16 @@ void juego_dinosaurio_inicializar(void) {
     juego_iniciado = 1;
 
     /* SIEMPRE dibujar pantalla inicial limpia */
-    lcd_borrarPantalla();
+    lcd_fb_borrar_pantalla();
     dibujar_marcadores();
     dibujar_pantalla_juego();
+    lcd_fb_volcar();
+
+    foto_pendiente = 1;     /* Un espectador ya conectado arranca con esta partida */
+    atender_espectador();
 
-    /* NOTA: TIMER0_IRQn debe estar HABILITADO para que funcione el DAC/audio.
-       El sistema de melodías no interfiere con el LCD porque usa DMA y
-       no hace llamadas bloqueantes desde la ISR. */
+    /* El sistema de melodías no interfiere con el LCD: el DAC se alimenta
+       por DMA y no hay ISR de audio por muestra. */
 }
 /**
  * @brief Debounce del botón y actualización de estado.
@@ -564,8 +584,7 @@ static int flanco_boton_presionado(void) {
  */
 static void dibujar_marcadores(void) {
     /* Mostrar etiqueta DINO en esquina superior izquierda */
-    lcd_establecer_cursor(0, 0);
-    lcd_escribir("DINO");
+    lcd_fb_escribir(0, 0, "DINO");
 
     /* Mostrar tiempo transcurrido (segundos) en el centro */
     int tiempo_s = (int)(ticks_desde_inicio / TICKS_POR_SEGUNDO);
@@ -576,8 +595,7 @@ static void dibujar_marcadores(void) {
     buffer_tiempo[1] = (ts % 10) + '0'; ts /= 10;
     buffer_tiempo[0] = (ts % 10) + '0';
     int columna_tiempo = (COLUMNAS_DINO - 3) / 2;
-    lcd_establecer_cursor(0, columna_tiempo);
-    lcd_escribir(buffer_tiempo);
+    lcd_fb_escribir(0, columna_tiempo, buffer_tiempo);
 
     /* Mostrar puntuación en esquina superior derecha */
     char texto_puntuacion[4];
@@ -586,35 +604,28 @@ static void dibujar_marcadores(void) {
     texto_puntuacion[2] = (sc % 10) + '0'; sc /= 10;
     texto_puntuacion[1] = (sc % 10) + '0'; sc /= 10;
     texto_puntuacion[0] = (sc % 10) + '0';
-    lcd_establecer_cursor(0, COLUMNAS_DINO - 3);
-    lcd_escribir(texto_puntuacion);
+    lcd_fb_escribir(0, COLUMNAS_DINO - 3, texto_puntuacion);
 }
 
 /**
- * @brief Actualiza el juego si hay un tick pendiente del TIMER2.
+ * @brief Actualiza el juego si hay un tick pendiente del planificador.
  *
  * Esta función debe ser llamada periódicamente desde el main loop.
  * Procesa el tick del juego (física, colisiones, dibujo) solo cuando
- * TIMER2 ha generado una interrupción (game_tick_flag == 1).
+ * el planificador liberó la tarea del juego.
  *
  * Flujo:
- * 1. Verificar si hay tick pendiente (por ISR o polling)
+ * 1. Verificar si hay tick pendiente
  * 2. Actualizar estado del botón
  * 3. Si no iniciado, esperar pulsación del usuario
  * 4. Si jugando: procesar salto, física, colisiones, animación, dibujo
  * 5. Si game over: mostrar mensaje y esperar reinicio
  */
 void juego_dinosaurio_ejecutar(void) {
-    /* Polling adicional del flag de TIMER2 por si la ISR no se ejecuta.
-       Esto previene que el juego se bloquee si NVIC está deshabilitado. */
-    if (TIM_GetIntStatus(LPC_TIM2, TIM_MR0_INT)) {
-        TIM_ClearIntPending(LPC_TIM2, TIM_MR0_INT);
-        bandera_tick_juego = 1;
-    }
-
     /* Salir si no hay tick pendiente */
-    if (!bandera_tick_juego) return;
-    bandera_tick_juego = 0;
+    if (!planificador_tarea_lista(tarea_tick_juego)) return;
+
+    atender_espectador();
 
     /* Actualizar estado del botón en cada tick */
     actualizar_estado_boton();
@@ -631,10 +642,12 @@ void juego_dinosaurio_ejecutar(void) {
 
             /* Iniciar música de fondo en loop continuo */
 
-            lcd_borrarPantalla();
+            lcd_fb_borrar_pantalla();
             /* dibujar primer frame inmediatamente */
             dibujar_marcadores();
             dibujar_pantalla_juego();
+            lcd_fb_volcar();
+            foto_pendiente = 1;
         } else {
             return; /* esperar a que el usuario pulse */
         }
@@ -652,8 +665,8 @@ void juego_dinosaurio_ejecutar(void) {
             posicion_vertical_dino = duracion_salto;
             salto_solicitado = 0; /* Limpiar flag después de usar */
 
-            // NO reproducir efecto (interrumpe música de fondo)
-            // melodias_iniciar(melodia_salto);
+            // Efecto en su propia voz: la música de fondo sigue sonando
+            melodias_efecto(melodia_salto);
         }
 
         /* Actualizar física del juego (movimiento, colisiones, spawns) */
@@ -662,27 +675,30 @@ void juego_dinosaurio_ejecutar(void) {
         /* Actualizar animación del dinosaurio (ciclo de frames) */
         actualizar_animacion_dino();
 
-        /* Actualizar sistema de melodías DAC (no bloqueante) */
+        /* LED de melodías (las notas avanzan solas en TIMER1) */
         melodias_actualizar();
 
-        /* Dibujar todo el frame (optimizado, sin parpadeo) */
+        /* Dibujar todo el frame y enviar solo las celdas modificadas */
         dibujar_pantalla_juego();
         dibujar_marcadores();
+        lcd_fb_volcar();
+        transmitir_tick();
     } else {
         /* Game over: mostrar mensaje y esperar botón para volver al menú */
         static uint8_t game_over_mostrado = 0;
         
         if (!game_over_mostrado) {
-            lcd_establecer_cursor(1, 0);
-            lcd_escribir("  GAME OVER   ");
-            lcd_establecer_cursor(3, 0);
-            lcd_escribir("Boton:Volver al menu");
+            lcd_fb_escribir(1, 0, "  GAME OVER   ");
+            lcd_fb_escribir(3, 0, "Boton:Volver al menu");
+            lcd_fb_volcar();
+            transmitir_fin();
             game_over_mostrado = 1;
         }
         
         if (flanco_boton_presionado()) {
             /* Usuario quiere volver al menú */
             juego_terminado = 2;  // Estado especial: volver al menú solicitado
+            planificador_detener_tarea(tarea_tick_juego);   // Nadie la atiende en el menú
             game_over_mostrado = 0;
         }
     }
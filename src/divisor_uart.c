@@ -0,0 +1,62 @@
+/**
+ * @file divisor_uart.c
+ * @brief Divisores de velocidad de las UART del LPC17xx (C puro).
+ *
+ * Para cada MULVAL/DIVADDVAL el divisor ideal cae entre dos enteros; se
+ * prueban los dos porque el error relativo no es simétrico alrededor del
+ * ideal. Todo en enteros de 64 bits: corre una vez al inicializar.
+ *
+ * @date Noviembre 2025
+ */
+
+#include "divisor_uart.h"
+#include <stddef.h>
+
+#define DIVISOR_MAXIMO      0xFFFF
+#define MULVAL_MAXIMO       15
+#define DIVISOR_MINIMO_FRACCIONAL 3     // DLM:DLL con DIVADDVAL > 0
+
+uint8_t divisor_uart_calcular(uint32_t pclk, uint32_t baudios, DivisorUart *resultado) {
+    DivisorUart mejor;
+    uint8_t encontrado = 0;
+    uint32_t mejor_error = 0;
+
+    if (resultado == NULL || baudios == 0) return 0;
+
+    for (uint8_t mulval = 1; mulval <= MULVAL_MAXIMO; mulval++) {
+        for (uint8_t divaddval = 0; divaddval < mulval; divaddval++) {
+            /* baudios = pclk * mulval / (16 * divisor * (mulval + divaddval)) */
+            uint64_t numerador = (uint64_t)pclk * mulval;
+            uint64_t por_divisor = (uint64_t)16 * (mulval + divaddval);
+            uint64_t ideal = numerador / (por_divisor * baudios);
+
+            for (uint64_t divisor = ideal; divisor <= ideal + 1; divisor++) {
+                if (divisor == 0 || divisor > DIVISOR_MAXIMO) continue;
+                if (divaddval > 0 && divisor < DIVISOR_MINIMO_FRACCIONAL) continue;
+
+                uint64_t denominador = por_divisor * divisor;
+                int64_t ppm = (int64_t)((numerador * 1000000u + denominador * baudios / 2) /
+                                        (denominador * baudios)) - 1000000;
+                uint32_t error = (uint32_t)(ppm < 0 ? -ppm : ppm);
+
+                if (!encontrado || error < mejor_error) {
+                    encontrado = 1;
+                    mejor_error = error;
+                    mejor.divisor = (uint16_t)divisor;
+                    mejor.divaddval = divaddval;
+                    mejor.mulval = mulval;
+                    mejor.baudios_reales = (uint32_t)((numerador + denominador / 2) / denominador);
+                    mejor.error_ppm = (int32_t)ppm;
+                }
+            }
+        }
+    }
+
+    if (!encontrado || mejor_error > DIVISOR_UART_ERROR_MAXIMO_PPM) return 0;
+    *resultado = mejor;
+    return 1;
+}
+
+uint8_t divisor_uart_fdr(const DivisorUart *divisor) {
+    return (uint8_t)((divisor->mulval << 4) | divisor->divaddval);
+}
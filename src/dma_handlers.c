@@ -8,21 +8,25 @@
  * - Funciones de callback para cada canal DMA
  * 
  * DMA activo:
- * - Canal 1: Melodías (DAC)
- * - Bluetooth: SIN DMA (solo UART polling)
+ * - Canal 1: Melodías (DAC) - ping-pong de dos LLI, una interrupción por bloque
+ * - Canal 2: Bluetooth TX (UART0) - un tramo de la cola por transferencia
+ * - Bluetooth RX: SIN DMA (interrupción UART0)
  * 
  * @date Noviembre 2025
  */
 
 #include "LPC17xx.h"
 #include "lpc17xx_gpdma.h"
+#include "perfil_isr.h"
 
 /* === CONFIGURACIÓN DE CANALES === */
 #define CANAL_DMA_MELODIAS    1  // Canal DMA 1 para DAC
+#define CANAL_DMA_BT_TX       2  // Canal DMA 2 para UART0 TX
 
 /* === PROTOTIPOS DE FUNCIONES CALLBACK === */
 
 extern void melodias_dma_on_transfer_complete(void);
+extern void bt_dma_on_transfer_complete(void);
 
 /* === MANEJADOR PRINCIPAL DMA === */
 
@@ -34,11 +38,28 @@ extern void melodias_dma_on_transfer_complete(void);
  * a las funciones de callback correspondientes.
  */
 void GPDMA_IRQHandler(void) {
-    /* Verificar canal 1 (Melodías DAC) */
+    PerfilMarca marca;
+    perfil_isr_entrar(&marca);
+
+    /* Verificar canal 1 (Melodías DAC): rellenar el bloque que terminó */
     if (GPDMA_IntGetStatus(GPDMA_INTTC, CANAL_DMA_MELODIAS) == SET) {
         GPDMA_ClearIntPending(GPDMA_CLR_INTTC, CANAL_DMA_MELODIAS);
         melodias_dma_on_transfer_complete();
     }
+    if (GPDMA_IntGetStatus(GPDMA_INTERR, CANAL_DMA_MELODIAS) == SET) {
+        GPDMA_ClearIntPending(GPDMA_CLR_INTERR, CANAL_DMA_MELODIAS);
+    }
+    
+    /* Verificar canal 2 (Bluetooth TX): liberar el tramo y seguir con la cola.
+       Con error el tramo también se da por terminado (esos bytes se pierden),
+       una sola vez aunque estén las dos banderas */
+    if (GPDMA_IntGetStatus(GPDMA_INT, CANAL_DMA_BT_TX) == SET) {
+        GPDMA_ClearIntPending(GPDMA_CLR_INTTC, CANAL_DMA_BT_TX);
+        GPDMA_ClearIntPending(GPDMA_CLR_INTERR, CANAL_DMA_BT_TX);
+        bt_dma_on_transfer_complete();
+    }
     
     /* Aquí se pueden agregar más canales si es necesario */
+
+    perfil_isr_salir(PERFIL_ISR_GPDMA, &marca);
 }
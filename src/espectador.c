@@ -0,0 +1,275 @@
+/**
+ * @file espectador.c
+ * @brief Registros del estado de los juegos para el espectador (C puro).
+ *
+ * Cada registro empieza con un byte que dice qué es; los pasos de la
+ * serpiente y los ticks del Dino, que son casi todo el tráfico, llevan sus
+ * datos en los bits que le sobran a ese byte.
+ *
+ * @date Noviembre 2025
+ */
+
+#include "espectador.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === BITS DE LOS REGISTROS DE UN BYTE === */
+#define PASO_DIRECCION      0x03
+#define PASO_COMIO          0x04
+#define PASO_CRECIO         0x08
+#define PASO_COMIDA         0x10    // Siguen x, y de la comida
+#define PASO_VISTA          0x20    // Siguen x, y de la vista
+
+#define TICK_ALTURA         0x03
+#define TICK_CUADRO         0x04
+#define TICK_DESPLAZO       0x08
+#define TICK_OBSTACULO      0x30    // Bits 5:4
+#define TICK_PUNTO          0x40
+
+#define BYTES_FOTO_SERPIENTE    14
+#define BYTES_OBSTACULOS        ((ESPECTADOR_COLUMNAS_DINO + 3) / 4)
+#define BYTES_FOTO_DINO         (8 + BYTES_OBSTACULOS)
+#define BYTES_CABECERA_CUERPO   4   // Tipo, desde (u16), cantidad
+
+/* === FUNCIONES PRIVADAS === */
+
+static void escribir_u16(uint8_t *p, uint16_t valor) {
+    p[0] = (uint8_t)valor;
+    p[1] = (uint8_t)(valor >> 8);
+}
+
+static uint16_t leer_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/**
+ * @brief Reserva n bytes al final de la trama (NULL si no entran)
+ */
+static uint8_t *reservar(EspectadorTrama *trama, uint8_t n) {
+    if (trama->largo + n > PROTOCOLO_CARGA_MAXIMA) return NULL;
+
+    uint8_t *p = &trama->carga[trama->largo];
+    trama->largo += n;
+    return p;
+}
+
+/**
+ * @brief Empaqueta valores de 2 bits, cuatro por byte (el primero en los bits bajos)
+ */
+static void empaquetar(uint8_t *destino, const uint8_t *valores, uint8_t n) {
+    memset(destino, 0, (n + 3) / 4);
+    for (uint8_t i = 0; i < n; i++) {
+        destino[i / 4] |= (uint8_t)((valores[i] & 0x03) << ((i % 4) * 2));
+    }
+}
+
+static void desempaquetar(uint8_t *valores, const uint8_t *origen, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++) {
+        valores[i] = (origen[i / 4] >> ((i % 4) * 2)) & 0x03;
+    }
+}
+
+/* === ESCRITURA === */
+
+void espectador_iniciar_trama(EspectadorTrama *trama) {
+    trama->largo = 0;
+}
+
+uint8_t espectador_poner_paso(EspectadorTrama *trama, const EspectadorPaso *paso) {
+    uint8_t n = 1 + (paso->comida_movida ? 2 : 0) + (paso->vista_movida ? 2 : 0);
+    uint8_t *p = reservar(trama, n);
+    if (p == NULL) return 0;
+
+    *p++ = ESPECTADOR_PASO_SERPIENTE | (paso->direccion & PASO_DIRECCION) |
+           (paso->comio ? PASO_COMIO : 0) | (paso->crecio ? PASO_CRECIO : 0) |
+           (paso->comida_movida ? PASO_COMIDA : 0) | (paso->vista_movida ? PASO_VISTA : 0);
+    if (paso->comida_movida) {
+        *p++ = paso->comida_x;
+        *p++ = paso->comida_y;
+    }
+    if (paso->vista_movida) {
+        *p++ = paso->vista_x;
+        *p++ = paso->vista_y;
+    }
+    return 1;
+}
+
+uint8_t espectador_poner_tick(EspectadorTrama *trama, const EspectadorTick *tick) {
+    uint8_t *p = reservar(trama, 1);
+    if (p == NULL) return 0;
+
+    *p = ESPECTADOR_TICK_DINO | (tick->altura & TICK_ALTURA) | (tick->cuadro ? TICK_CUADRO : 0) |
+         (tick->desplazo ? TICK_DESPLAZO : 0) | ((tick->obstaculo << 4) & TICK_OBSTACULO) |
+         (tick->punto ? TICK_PUNTO : 0);
+    return 1;
+}
+
+uint8_t espectador_poner_foto_serpiente(EspectadorTrama *trama, const EspectadorFotoSerpiente *foto) {
+    uint8_t *p = reservar(trama, BYTES_FOTO_SERPIENTE);
+    if (p == NULL) return 0;
+
+    p[0] = ESPECTADOR_FOTO_SERPIENTE;
+    p[1] = foto->ancho;
+    p[2] = foto->alto;
+    p[3] = foto->cabeza_x;
+    p[4] = foto->cabeza_y;
+    p[5] = foto->comida_x;
+    p[6] = foto->comida_y;
+    p[7] = foto->vista_x;
+    p[8] = foto->vista_y;
+    escribir_u16(&p[9], foto->puntuacion);
+    escribir_u16(&p[11], foto->largo);
+    p[13] = foto->estado;
+    return 1;
+}
+
+uint8_t espectador_poner_foto_dino(EspectadorTrama *trama, const EspectadorFotoDino *foto) {
+    uint8_t *p = reservar(trama, BYTES_FOTO_DINO);
+    if (p == NULL) return 0;
+
+    p[0] = ESPECTADOR_FOTO_DINO;
+    p[1] = (foto->altura & 0x03) | (foto->cuadro ? 0x04 : 0) | (uint8_t)(foto->estado << 4);
+    escribir_u16(&p[2], foto->puntuacion);
+    escribir_u16(&p[4], (uint16_t)foto->ticks);
+    escribir_u16(&p[6], (uint16_t)(foto->ticks >> 16));
+    empaquetar(&p[8], foto->obstaculos, ESPECTADOR_COLUMNAS_DINO);
+    return 1;
+}
+
+uint8_t espectador_poner_marca(EspectadorTrama *trama, uint8_t tipo) {
+    uint8_t *p = reservar(trama, 1);
+    if (p == NULL) return 0;
+
+    *p = tipo;
+    return 1;
+}
+
+uint8_t espectador_poner_cuerpo(EspectadorTrama *trama, uint16_t desde,
+                                const uint8_t *direcciones, uint8_t n) {
+    if (n == 0 || n > ESPECTADOR_CUERPO_MAXIMO) return 0;
+
+    uint8_t *p = reservar(trama, BYTES_CABECERA_CUERPO + (n + 3) / 4);
+    if (p == NULL) return 0;
+
+    p[0] = ESPECTADOR_CUERPO;
+    escribir_u16(&p[1], desde);
+    p[3] = n;
+    empaquetar(&p[BYTES_CABECERA_CUERPO], direcciones, n);
+    return 1;
+}
+
+uint8_t espectador_lugar_cuerpo(const EspectadorTrama *trama) {
+    uint8_t libres = PROTOCOLO_CARGA_MAXIMA - trama->largo;
+    if (libres <= BYTES_CABECERA_CUERPO) return 0;
+
+    uint16_t lugar = (uint16_t)(libres - BYTES_CABECERA_CUERPO) * 4;
+    return (uint8_t)(lugar > ESPECTADOR_CUERPO_MAXIMO ? ESPECTADOR_CUERPO_MAXIMO : lugar);
+}
+
+uint32_t espectador_bytes_foto_serpiente(uint16_t largo) {
+    EspectadorTrama trama;
+    uint32_t bytes = 0;
+    uint32_t faltan = largo > 0 ? largo - 1u : 0;   // Direcciones entre segmentos
+
+    espectador_iniciar_trama(&trama);
+    trama.largo = BYTES_FOTO_SERPIENTE;
+    for (;;) {
+        uint8_t lugar = espectador_lugar_cuerpo(&trama);
+        uint8_t n = (uint8_t)(faltan < lugar ? faltan : lugar);
+        if (n > 0) {
+            trama.largo += BYTES_CABECERA_CUERPO + (n + 3) / 4;
+            faltan -= n;
+        }
+        if (faltan == 0 || n == 0) {
+            bytes += PROTOCOLO_CABECERA + trama.largo + 1;
+            if (faltan == 0) return bytes;
+            espectador_iniciar_trama(&trama);
+        }
+    }
+}
+
+/* === LECTURA === */
+
+uint8_t espectador_leer(const uint8_t *carga, uint8_t largo, uint8_t *posicion,
+                        EspectadorRegistro *registro) {
+    if (*posicion >= largo) return 0;
+
+    const uint8_t *p = &carga[*posicion];
+    uint8_t quedan = largo - *posicion;
+    uint8_t tipo = p[0];
+    uint8_t usados;
+
+    if (tipo & ESPECTADOR_TICK_DINO) {
+        EspectadorTick *tick = &registro->tick;
+        registro->tipo = ESPECTADOR_TICK_DINO;
+        tick->altura = tipo & TICK_ALTURA;
+        tick->cuadro = (tipo & TICK_CUADRO) ? 1 : 0;
+        tick->desplazo = (tipo & TICK_DESPLAZO) ? 1 : 0;
+        tick->obstaculo = (tipo & TICK_OBSTACULO) >> 4;
+        tick->punto = (tipo & TICK_PUNTO) ? 1 : 0;
+        usados = 1;
+    } else if (tipo & ESPECTADOR_PASO_SERPIENTE) {
+        EspectadorPaso *paso = &registro->paso;
+        usados = 1 + ((tipo & PASO_COMIDA) ? 2 : 0) + ((tipo & PASO_VISTA) ? 2 : 0);
+        if (quedan < usados) return 0;
+        registro->tipo = ESPECTADOR_PASO_SERPIENTE;
+        paso->direccion = tipo & PASO_DIRECCION;
+        paso->comio = (tipo & PASO_COMIO) ? 1 : 0;
+        paso->crecio = (tipo & PASO_CRECIO) ? 1 : 0;
+        paso->comida_movida = (tipo & PASO_COMIDA) ? 1 : 0;
+        paso->vista_movida = (tipo & PASO_VISTA) ? 1 : 0;
+        const uint8_t *datos = &p[1];
+        if (paso->comida_movida) {
+            paso->comida_x = *datos++;
+            paso->comida_y = *datos++;
+        }
+        if (paso->vista_movida) {
+            paso->vista_x = *datos++;
+            paso->vista_y = *datos++;
+        }
+    } else if (tipo == ESPECTADOR_FOTO_SERPIENTE) {
+        EspectadorFotoSerpiente *foto = &registro->foto_serpiente;
+        usados = BYTES_FOTO_SERPIENTE;
+        if (quedan < usados) return 0;
+        registro->tipo = tipo;
+        foto->ancho = p[1];
+        foto->alto = p[2];
+        foto->cabeza_x = p[3];
+        foto->cabeza_y = p[4];
+        foto->comida_x = p[5];
+        foto->comida_y = p[6];
+        foto->vista_x = p[7];
+        foto->vista_y = p[8];
+        foto->puntuacion = leer_u16(&p[9]);
+        foto->largo = leer_u16(&p[11]);
+        foto->estado = p[13];
+    } else if (tipo == ESPECTADOR_FOTO_DINO) {
+        EspectadorFotoDino *foto = &registro->foto_dino;
+        usados = BYTES_FOTO_DINO;
+        if (quedan < usados) return 0;
+        registro->tipo = tipo;
+        foto->altura = p[1] & 0x03;
+        foto->cuadro = (p[1] & 0x04) ? 1 : 0;
+        foto->estado = p[1] >> 4;
+        foto->puntuacion = leer_u16(&p[2]);
+        foto->ticks = leer_u16(&p[4]) | ((uint32_t)leer_u16(&p[6]) << 16);
+        desempaquetar(foto->obstaculos, &p[8], ESPECTADOR_COLUMNAS_DINO);
+    } else if (tipo == ESPECTADOR_CUERPO) {
+        if (quedan < BYTES_CABECERA_CUERPO) return 0;
+        uint8_t n = p[3];
+        usados = BYTES_CABECERA_CUERPO + (n + 3) / 4;
+        if (n == 0 || n > ESPECTADOR_CUERPO_MAXIMO || quedan < usados) return 0;
+        registro->tipo = tipo;
+        registro->cuerpo_desde = leer_u16(&p[1]);
+        registro->cuerpo_cantidad = n;
+        desempaquetar(registro->cuerpo, &p[BYTES_CABECERA_CUERPO], n);
+    } else if (tipo == ESPECTADOR_PAUSA || tipo == ESPECTADOR_FIN) {
+        registro->tipo = tipo;
+        usados = 1;
+    } else {
+        return 0;
+    }
+
+    *posicion += usados;
+    return 1;
+}
@@ -0,0 +1,362 @@
+/**
+ * @file formas_onda.c
+ * @brief Tablas de formas de onda sin aliasing, una por octava
+ *
+ * Generado por tools/generador_formas.c. No editar a mano:
+ *   ./generador_formas > src/formas_onda.c
+ *
+ * @date Noviembre 2025
+ */
+
+#include "melodias_dac.h"
+
+// triangular, banda 0: 40 armónicos
+static const int8_t forma_triangular_0[256] = {
+       0,    2,    4,    6,    8,   10,   12,   14,   16,   18,   20,   22,   24,   26,   28,   31,
+      33,   35,   37,   39,   41,   43,   45,   47,   49,   51,   53,   55,   57,   59,   61,   63,
+      65,   67,   69,   71,   73,   75,   77,   79,   81,   83,   85,   87,   89,   91,   94,   96,
+      98,  100,  102,  104,  106,  108,  110,  112,  114,  116,  118,  120,  122,  124,  126,  127,
+     127,  127,  126,  124,  122,  120,  118,  116,  114,  112,  110,  108,  106,  104,  102,  100,
+      98,   96,   94,   91,   89,   87,   85,   83,   81,   79,   77,   75,   73,   71,   69,   67,
+      65,   63,   61,   59,   57,   55,   53,   51,   49,   47,   45,   43,   41,   39,   37,   35,
+      33,   31,   28,   26,   24,   22,   20,   18,   16,   14,   12,   10,    8,    6,    4,    2,
+       0,   -2,   -4,   -6,   -8,  -10,  -12,  -14,  -16,  -18,  -20,  -22,  -24,  -26,  -28,  -31,
+     -33,  -35,  -37,  -39,  -41,  -43,  -45,  -47,  -49,  -51,  -53,  -55,  -57,  -59,  -61,  -63,
+     -65,  -67,  -69,  -71,  -73,  -75,  -77,  -79,  -81,  -83,  -85,  -87,  -89,  -91,  -94,  -96,
+     -98, -100, -102, -104, -106, -108, -110, -112, -114, -116, -118, -120, -122, -124, -126, -127,
+    -127, -127, -126, -124, -122, -120, -118, -116, -114, -112, -110, -108, -106, -104, -102, -100,
+     -98,  -96,  -94,  -91,  -89,  -87,  -85,  -83,  -81,  -79,  -77,  -75,  -73,  -71,  -69,  -67,
+     -65,  -63,  -61,  -59,  -57,  -55,  -53,  -51,  -49,  -47,  -45,  -43,  -41,  -39,  -37,  -35,
+     -33,  -31,  -28,  -26,  -24,  -22,  -20,  -18,  -16,  -14,  -12,  -10,   -8,   -6,   -4,   -2,
+};
+
+// triangular, banda 1: 20 armónicos
+static const int8_t forma_triangular_1[256] = {
+       0,    2,    4,    6,    8,   10,   13,   15,   17,   19,   21,   23,   25,   27,   29,   31,
+      33,   35,   38,   40,   42,   44,   46,   48,   50,   52,   54,   56,   58,   60,   63,   65,
+      67,   69,   71,   73,   75,   77,   79,   81,   83,   85,   87,   90,   92,   94,   96,   98,
+     100,  102,  104,  106,  108,  110,  112,  115,  117,  119,  121,  122,  124,  125,  126,  127,
+     127,  127,  126,  125,  124,  122,  121,  119,  117,  115,  112,  110,  108,  106,  104,  102,
+     100,   98,   96,   94,   92,   90,   87,   85,   83,   81,   79,   77,   75,   73,   71,   69,
+      67,   65,   63,   60,   58,   56,   54,   52,   50,   48,   46,   44,   42,   40,   38,   35,
+      33,   31,   29,   27,   25,   23,   21,   19,   17,   15,   13,   10,    8,    6,    4,    2,
+       0,   -2,   -4,   -6,   -8,  -10,  -13,  -15,  -17,  -19,  -21,  -23,  -25,  -27,  -29,  -31,
+     -33,  -35,  -38,  -40,  -42,  -44,  -46,  -48,  -50,  -52,  -54,  -56,  -58,  -60,  -63,  -65,
+     -67,  -69,  -71,  -73,  -75,  -77,  -79,  -81,  -83,  -85,  -87,  -90,  -92,  -94,  -96,  -98,
+    -100, -102, -104, -106, -108, -110, -112, -115, -117, -119, -121, -122, -124, -125, -126, -127,
+    -127, -127, -126, -125, -124, -122, -121, -119, -117, -115, -112, -110, -108, -106, -104, -102,
+    -100,  -98,  -96,  -94,  -92,  -90,  -87,  -85,  -83,  -81,  -79,  -77,  -75,  -73,  -71,  -69,
+     -67,  -65,  -63,  -60,  -58,  -56,  -54,  -52,  -50,  -48,  -46,  -44,  -42,  -40,  -38,  -35,
+     -33,  -31,  -29,  -27,  -25,  -23,  -21,  -19,  -17,  -15,  -13,  -10,   -8,   -6,   -4,   -2,
+};
+
+// triangular, banda 2: 10 armónicos
+static const int8_t forma_triangular_2[256] = {
+       0,    2,    4,    7,    9,   11,   13,   15,   18,   20,   22,   24,   26,   28,   31,   33,
+      35,   37,   39,   42,   44,   46,   48,   50,   53,   55,   57,   59,   61,   63,   66,   68,
+      70,   72,   74,   76,   79,   81,   83,   85,   87,   89,   92,   94,   96,   98,  101,  103,
+     105,  107,  109,  111,  113,  115,  117,  119,  120,  122,  123,  124,  125,  126,  127,  127,
+     127,  127,  127,  126,  125,  124,  123,  122,  120,  119,  117,  115,  113,  111,  109,  107,
+     105,  103,  101,   98,   96,   94,   92,   89,   87,   85,   83,   81,   79,   76,   74,   72,
+      70,   68,   66,   63,   61,   59,   57,   55,   53,   50,   48,   46,   44,   42,   39,   37,
+      35,   33,   31,   28,   26,   24,   22,   20,   18,   15,   13,   11,    9,    7,    4,    2,
+       0,   -2,   -4,   -7,   -9,  -11,  -13,  -15,  -18,  -20,  -22,  -24,  -26,  -28,  -31,  -33,
+     -35,  -37,  -39,  -42,  -44,  -46,  -48,  -50,  -53,  -55,  -57,  -59,  -61,  -63,  -66,  -68,
+     -70,  -72,  -74,  -76,  -79,  -81,  -83,  -85,  -87,  -89,  -92,  -94,  -96,  -98, -101, -103,
+    -105, -107, -109, -111, -113, -115, -117, -119, -120, -122, -123, -124, -125, -126, -127, -127,
+    -127, -127, -127, -126, -125, -124, -123, -122, -120, -119, -117, -115, -113, -111, -109, -107,
+    -105, -103, -101,  -98,  -96,  -94,  -92,  -89,  -87,  -85,  -83,  -81,  -79,  -76,  -74,  -72,
+     -70,  -68,  -66,  -63,  -61,  -59,  -57,  -55,  -53,  -50,  -48,  -46,  -44,  -42,  -39,  -37,
+     -35,  -33,  -31,  -28,  -26,  -24,  -22,  -20,  -18,  -15,  -13,  -11,   -9,   -7,   -4,   -2,
+};
+
+// seno
+static const int8_t forma_seno[256] = {
+       0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+      49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+      90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+     117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+     127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+     117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+      90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+      49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+       0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+     -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+     -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+    -117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+    -127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+    -117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+     -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+     -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3,
+};
+
+// sierra, banda 0: 40 armónicos
+static const int8_t forma_sierra_0[256] = {
+       0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,   15,
+      16,   17,   18,   19,   20,   21,   22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
+      32,   33,   34,   35,   36,   37,   38,   39,   40,   41,   42,   43,   44,   45,   46,   47,
+      48,   49,   50,   51,   52,   53,   55,   56,   57,   58,   59,   60,   61,   62,   63,   64,
+      65,   66,   67,   68,   69,   70,   71,   72,   73,   74,   75,   76,   77,   78,   79,   80,
+      81,   82,   83,   84,   85,   86,   87,   88,   89,   90,   91,   92,   93,   94,   95,   96,
+      97,   98,   99,  100,  101,  102,  103,  104,  105,  106,  107,  108,  109,  110,  111,  112,
+     113,  114,  115,  116,  117,  119,  119,  119,  120,  122,  125,  127,  124,  111,   85,   46,
+       0,  -46,  -85, -111, -124, -127, -125, -122, -120, -119, -119, -119, -117, -116, -115, -114,
+    -113, -112, -111, -110, -109, -108, -107, -106, -105, -104, -103, -102, -101, -100,  -99,  -98,
+     -97,  -96,  -95,  -94,  -93,  -92,  -91,  -90,  -89,  -88,  -87,  -86,  -85,  -84,  -83,  -82,
+     -81,  -80,  -79,  -78,  -77,  -76,  -75,  -74,  -73,  -72,  -71,  -70,  -69,  -68,  -67,  -66,
+     -65,  -64,  -63,  -62,  -61,  -60,  -59,  -58,  -57,  -56,  -55,  -53,  -52,  -51,  -50,  -49,
+     -48,  -47,  -46,  -45,  -44,  -43,  -42,  -41,  -40,  -39,  -38,  -37,  -36,  -35,  -34,  -33,
+     -32,  -31,  -30,  -29,  -28,  -27,  -26,  -25,  -24,  -23,  -22,  -21,  -20,  -19,  -18,  -17,
+     -16,  -15,  -14,  -13,  -12,  -11,  -10,   -9,   -8,   -7,   -6,   -5,   -4,   -3,   -2,   -1,
+};
+
+// sierra, banda 1: 20 armónicos
+static const int8_t forma_sierra_1[256] = {
+       0,    1,    2,    3,    4,    5,    6,    7,    8,   10,   11,   12,   13,   14,   15,   16,
+      17,   18,   19,   20,   21,   22,   23,   24,   25,   26,   27,   28,   29,   30,   32,   33,
+      34,   35,   36,   37,   38,   39,   40,   41,   42,   43,   44,   45,   46,   47,   48,   49,
+      51,   52,   53,   54,   55,   56,   57,   58,   59,   60,   61,   62,   63,   64,   65,   66,
+      67,   68,   69,   70,   71,   73,   74,   75,   76,   77,   78,   79,   80,   81,   82,   83,
+      84,   85,   86,   87,   88,   89,   90,   91,   92,   93,   94,   95,   97,   98,   99,  100,
+     101,  102,  103,  103,  104,  105,  107,  108,  109,  111,  112,  113,  113,  114,  115,  115,
+     116,  117,  119,  121,  123,  125,  127,  127,  125,  121,  114,  103,   88,   69,   48,   25,
+       0,  -25,  -48,  -69,  -88, -103, -114, -121, -125, -127, -127, -125, -123, -121, -119, -117,
+    -116, -115, -115, -114, -113, -113, -112, -111, -109, -108, -107, -105, -104, -103, -103, -102,
+    -101, -100,  -99,  -98,  -97,  -95,  -94,  -93,  -92,  -91,  -90,  -89,  -88,  -87,  -86,  -85,
+     -84,  -83,  -82,  -81,  -80,  -79,  -78,  -77,  -76,  -75,  -74,  -73,  -71,  -70,  -69,  -68,
+     -67,  -66,  -65,  -64,  -63,  -62,  -61,  -60,  -59,  -58,  -57,  -56,  -55,  -54,  -53,  -52,
+     -51,  -49,  -48,  -47,  -46,  -45,  -44,  -43,  -42,  -41,  -40,  -39,  -38,  -37,  -36,  -35,
+     -34,  -33,  -32,  -30,  -29,  -28,  -27,  -26,  -25,  -24,  -23,  -22,  -21,  -20,  -19,  -18,
+     -17,  -16,  -15,  -14,  -13,  -12,  -11,  -10,   -8,   -7,   -6,   -5,   -4,   -3,   -2,   -1,
+};
+
+// sierra, banda 2: 10 armónicos
+static const int8_t forma_sierra_2[256] = {
+       0,    1,    2,    3,    4,    6,    7,    8,    9,   10,   11,   13,   14,   15,   16,   17,
+      19,   20,   21,   22,   23,   24,   25,   26,   27,   29,   30,   31,   32,   33,   34,   35,
+      36,   38,   39,   40,   41,   42,   44,   45,   46,   47,   48,   49,   50,   51,   52,   54,
+      55,   56,   57,   58,   59,   60,   61,   62,   64,   65,   66,   67,   68,   70,   71,   72,
+      73,   74,   75,   76,   77,   78,   79,   80,   81,   82,   83,   84,   86,   87,   88,   89,
+      90,   92,   93,   94,   95,   97,   98,   99,  100,  101,  102,  103,  104,  104,  105,  106,
+     107,  108,  109,  110,  111,  113,  114,  116,  118,  120,  121,  123,  125,  126,  127,  127,
+     127,  126,  124,  122,  118,  113,  108,  101,   93,   84,   74,   63,   52,   39,   27,   13,
+       0,  -13,  -27,  -39,  -52,  -63,  -74,  -84,  -93, -101, -108, -113, -118, -122, -124, -126,
+    -127, -127, -127, -126, -125, -123, -121, -120, -118, -116, -114, -113, -111, -110, -109, -108,
+    -107, -106, -105, -104, -104, -103, -102, -101, -100,  -99,  -98,  -97,  -95,  -94,  -93,  -92,
+     -90,  -89,  -88,  -87,  -86,  -84,  -83,  -82,  -81,  -80,  -79,  -78,  -77,  -76,  -75,  -74,
+     -73,  -72,  -71,  -70,  -68,  -67,  -66,  -65,  -64,  -62,  -61,  -60,  -59,  -58,  -57,  -56,
+     -55,  -54,  -52,  -51,  -50,  -49,  -48,  -47,  -46,  -45,  -44,  -42,  -41,  -40,  -39,  -38,
+     -36,  -35,  -34,  -33,  -32,  -31,  -30,  -29,  -27,  -26,  -25,  -24,  -23,  -22,  -21,  -20,
+     -19,  -17,  -16,  -15,  -14,  -13,  -11,  -10,   -9,   -8,   -7,   -6,   -4,   -3,   -2,   -1,
+};
+
+// cuadrada_50, banda 0: 40 armónicos
+static const int8_t forma_cuadrada_50_0[256] = {
+       0,   46,   84,  110,  123,  127,  126,  124,  123,  123,  124,  125,  125,  124,  124,  124,
+     124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+     124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+     124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+     124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+     124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+     124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+     124,  124,  124,  124,  125,  125,  124,  123,  123,  124,  126,  127,  123,  110,   84,   46,
+       0,  -46,  -84, -110, -123, -127, -126, -124, -123, -123, -124, -125, -125, -124, -124, -124,
+    -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124,
+    -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124,
+    -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124,
+    -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124,
+    -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124,
+    -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124,
+    -124, -124, -124, -124, -125, -125, -124, -123, -123, -124, -126, -127, -123, -110,  -84,  -46,
+};
+
+// cuadrada_50, banda 1: 20 armónicos
+static const int8_t forma_cuadrada_50_1[256] = {
+       0,   24,   46,   67,   85,  100,  111,  119,  124,  126,  127,  127,  125,  124,  123,  123,
+     123,  123,  124,  124,  125,  125,  125,  125,  124,  124,  124,  124,  124,  124,  124,  124,
+     124,  125,  125,  125,  124,  124,  124,  124,  124,  124,  124,  124,  125,  125,  125,  125,
+     125,  124,  124,  124,  124,  124,  124,  124,  125,  125,  125,  125,  125,  124,  124,  124,
+     124,  124,  124,  124,  125,  125,  125,  125,  125,  124,  124,  124,  124,  124,  124,  124,
+     125,  125,  125,  125,  125,  124,  124,  124,  124,  124,  124,  124,  124,  125,  125,  125,
+     124,  124,  124,  124,  124,  124,  124,  124,  124,  125,  125,  125,  125,  124,  124,  123,
+     123,  123,  123,  124,  125,  127,  127,  126,  124,  119,  111,  100,   85,   67,   46,   24,
+       0,  -24,  -46,  -67,  -85, -100, -111, -119, -124, -126, -127, -127, -125, -124, -123, -123,
+    -123, -123, -124, -124, -125, -125, -125, -125, -124, -124, -124, -124, -124, -124, -124, -124,
+    -124, -125, -125, -125, -124, -124, -124, -124, -124, -124, -124, -124, -125, -125, -125, -125,
+    -125, -124, -124, -124, -124, -124, -124, -124, -125, -125, -125, -125, -125, -124, -124, -124,
+    -124, -124, -124, -124, -125, -125, -125, -125, -125, -124, -124, -124, -124, -124, -124, -124,
+    -125, -125, -125, -125, -125, -124, -124, -124, -124, -124, -124, -124, -124, -125, -125, -125,
+    -124, -124, -124, -124, -124, -124, -124, -124, -124, -125, -125, -125, -125, -124, -124, -123,
+    -123, -123, -123, -124, -125, -127, -127, -126, -124, -119, -111, -100,  -85,  -67,  -46,  -24,
+};
+
+// cuadrada_50, banda 2: 10 armónicos
+static const int8_t forma_cuadrada_50_2[256] = {
+       0,   12,   25,   37,   48,   59,   69,   79,   88,   96,  102,  108,  113,  117,  121,  123,
+     125,  126,  127,  127,  127,  127,  126,  125,  125,  124,  124,  123,  123,  123,  123,  123,
+     123,  124,  124,  124,  125,  125,  125,  125,  126,  126,  126,  126,  125,  125,  125,  125,
+     125,  125,  124,  124,  124,  124,  124,  124,  125,  125,  125,  125,  125,  125,  126,  126,
+     126,  126,  126,  125,  125,  125,  125,  125,  125,  124,  124,  124,  124,  124,  124,  125,
+     125,  125,  125,  125,  125,  126,  126,  126,  126,  125,  125,  125,  125,  124,  124,  124,
+     123,  123,  123,  123,  123,  123,  124,  124,  125,  125,  126,  127,  127,  127,  127,  126,
+     125,  123,  121,  117,  113,  108,  102,   96,   88,   79,   69,   59,   48,   37,   25,   12,
+       0,  -12,  -25,  -37,  -48,  -59,  -69,  -79,  -88,  -96, -102, -108, -113, -117, -121, -123,
+    -125, -126, -127, -127, -127, -127, -126, -125, -125, -124, -124, -123, -123, -123, -123, -123,
+    -123, -124, -124, -124, -125, -125, -125, -125, -126, -126, -126, -126, -125, -125, -125, -125,
+    -125, -125, -124, -124, -124, -124, -124, -124, -125, -125, -125, -125, -125, -125, -126, -126,
+    -126, -126, -126, -125, -125, -125, -125, -125, -125, -124, -124, -124, -124, -124, -124, -125,
+    -125, -125, -125, -125, -125, -126, -126, -126, -126, -125, -125, -125, -125, -124, -124, -124,
+    -123, -123, -123, -123, -123, -123, -124, -124, -125, -125, -126, -127, -127, -127, -127, -126,
+    -125, -123, -121, -117, -113, -108, -102,  -96,  -88,  -79,  -69,  -59,  -48,  -37,  -25,  -12,
+};
+
+// cuadrada_25, banda 0: 40 armónicos
+static const int8_t forma_cuadrada_25_0[256] = {
+      42,   72,   98,  115,  124,  127,  126,  125,  124,  125,  125,  125,  125,  125,  125,  125,
+     125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+     125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+     125,  125,  125,  125,  125,  125,  125,  125,  124,  125,  126,  127,  124,  115,   98,   72,
+      42,   11,  -14,  -32,  -41,  -44,  -43,  -41,  -41,  -41,  -42,  -42,  -42,  -42,  -41,  -41,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -41,  -41,  -42,  -42,  -42,  -42,  -41,  -41,  -41,  -43,  -44,  -41,  -32,  -14,   11,
+};
+
+// cuadrada_25, banda 1: 20 armónicos
+static const int8_t forma_cuadrada_25_1[256] = {
+      42,   58,   73,   87,   99,  109,  116,  122,  125,  127,  127,  127,  126,  125,  125,  124,
+     124,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+     125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+     124,  124,  125,  125,  126,  127,  127,  127,  125,  122,  116,  109,   99,   87,   73,   58,
+      42,   26,   11,   -3,  -15,  -25,  -33,  -38,  -41,  -43,  -43,  -43,  -42,  -42,  -41,  -41,
+     -41,  -41,  -41,  -41,  -42,  -42,  -42,  -42,  -42,  -42,  -41,  -41,  -41,  -41,  -41,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -41,  -41,  -41,  -41,  -41,  -42,  -42,  -42,  -42,  -42,  -42,  -41,  -41,  -41,
+     -41,  -41,  -41,  -42,  -42,  -43,  -43,  -43,  -41,  -38,  -33,  -25,  -15,   -3,   11,   26,
+};
+
+// cuadrada_25, banda 2: 10 armónicos
+static const int8_t forma_cuadrada_25_2[256] = {
+      42,   51,   59,   67,   74,   82,   89,   95,  101,  106,  110,  114,  117,  120,  122,  124,
+     125,  126,  127,  127,  127,  127,  127,  126,  126,  125,  125,  124,  124,  124,  124,  123,
+     123,  123,  124,  124,  124,  124,  125,  125,  126,  126,  127,  127,  127,  127,  127,  126,
+     125,  124,  122,  120,  117,  114,  110,  106,  101,   95,   89,   82,   74,   67,   59,   51,
+      42,   34,   26,   17,   10,    2,   -5,  -11,  -17,  -22,  -27,  -31,  -34,  -37,  -39,  -41,
+     -42,  -42,  -43,  -43,  -43,  -43,  -42,  -42,  -41,  -41,  -41,  -41,  -40,  -40,  -40,  -41,
+     -41,  -41,  -41,  -41,  -41,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -41,  -41,  -41,  -41,  -41,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -41,  -41,  -41,  -41,  -41,
+     -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -42,  -41,  -41,  -41,  -41,
+     -41,  -41,  -40,  -40,  -40,  -41,  -41,  -41,  -41,  -42,  -42,  -43,  -43,  -43,  -43,  -42,
+     -42,  -41,  -39,  -37,  -34,  -31,  -27,  -22,  -17,  -11,   -5,    2,   10,   17,   26,   34,
+};
+
+// cuadrada_12, banda 0: 40 armónicos
+static const int8_t forma_cuadrada_12_0[256] = {
+      54,   80,  102,  117,  125,  127,  126,  125,  125,  125,  125,  126,  126,  125,  125,  125,
+     125,  125,  125,  125,  126,  126,  125,  125,  125,  125,  126,  127,  125,  117,  102,   80,
+      54,   27,    5,  -10,  -17,  -20,  -19,  -18,  -17,  -17,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -17,  -17,  -18,  -19,  -20,  -17,  -10,    5,   27,
+};
+
+// cuadrada_12, banda 1: 20 armónicos
+static const int8_t forma_cuadrada_12_1[256] = {
+      54,   67,   80,   92,  102,  111,  117,  122,  125,  127,  127,  127,  126,  125,  124,  124,
+     124,  124,  124,  125,  126,  127,  127,  127,  125,  122,  117,  111,  102,   92,   80,   67,
+      54,   40,   27,   15,    5,   -4,  -10,  -15,  -18,  -19,  -19,  -19,  -19,  -18,  -17,  -17,
+     -17,  -17,  -17,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -17,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -17,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -17,  -17,
+     -17,  -17,  -17,  -18,  -19,  -19,  -19,  -19,  -18,  -15,  -10,   -4,    5,   15,   27,   40,
+};
+
+// cuadrada_12, banda 2: 10 armónicos
+static const int8_t forma_cuadrada_12_2[256] = {
+      54,   61,   68,   75,   82,   88,   94,  100,  106,  110,  115,  118,  121,  124,  126,  127,
+     127,  127,  126,  124,  121,  118,  115,  110,  106,  100,   94,   88,   82,   75,   68,   61,
+      54,   46,   39,   33,   26,   20,   14,    8,    4,   -1,   -5,   -8,  -11,  -14,  -16,  -17,
+     -18,  -19,  -19,  -20,  -20,  -19,  -19,  -19,  -18,  -18,  -18,  -17,  -17,  -17,  -17,  -17,
+     -17,  -17,  -17,  -17,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -19,  -19,
+     -19,  -19,  -19,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,
+     -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -18,  -17,  -17,  -17,
+     -17,  -17,  -17,  -17,  -17,  -17,  -18,  -18,  -18,  -19,  -19,  -19,  -20,  -20,  -19,  -19,
+     -18,  -17,  -16,  -14,  -11,   -8,   -5,   -1,    4,    8,   14,   20,   26,   33,   39,   46,
+};
+
+// ruido
+static const int8_t forma_ruido[256] = {
+      69,  -27,  -66, -111,   60,   -7,  -93,   64,   68,  -67,  125,  -67,   75,   36,  -70, -121,
+       7,   76,  -53,   40,  -91,  118,   93,   51,   40,  125,   24,  -82,  -71,  -17,   96,   35,
+      31,   18,  -79,  -82,   51,  -10,   46,  108,   -8,  -64,  -15, -120,   92,   -1,  120,   47,
+     110,   39, -117,    7,   79,    2,   99,  -25,  -28,  -98,  -23,  -14,  -84,  -67,  -70,   67,
+     108, -112,  -79,    8,  -43,   99,  118,  -76,  -43,  -18,   55,   17,   81,  -68,  -45,   50,
+      38,  -78,   45,   66,  127,  -70,  -61,  -64,  -43,  -25,  110,  -59,  -93,    2,  -97,   77,
+     126,  -45,  -36,  100,  102,   55,  -72,   42,    0,  -90,   62,  -85,   26,  107,  -44,  -89,
+     117,  -23,   35, -100,  -37,   94,  -46,   48, -109,   77,  109,  -21,   14,   30,   91,   61,
+      19,  -20,   13,    7,  -10,   18,  100, -122, -102,  114,  -60,   64,    5,  -67,   41,  -82,
+    -109,   -2,  -16,  103,  -29,   70,   64,  -74,   83,  -20,   83,  -79,  -12,  -12,  -73,  -34,
+     -61,  -57,  122,  -46,    6,  119,  -83,  123,  -30, -119,   11,  -80,  -31,   21,   -6,  -28,
+    -122,   40,  -12,   79,  -42,   91,  -30,  -83,  -20, -109,  -87,   70,   98,    4, -106,  102,
+     -25,  -25,   83,  -90,  -82,   64,  124,   99, -113,  -68,   34,  -75,  -13,   83,  -76,   -4,
+     -81,   18,   39,  -19, -111,  118,  127, -114,  -53,  -52,   -5,  120,   44,  -86,   98,  -59,
+    -106, -116,  -41,  -81,   50,   78, -118,   19,  111,  123,   55,  -79, -124,  -90,   81,   48,
+      34,   22,   58, -109,   94, -119,  -62,   93,  -39, -118,  -66,    1,  107,   22,  107,  -30,
+};
+
+// 4352 bytes de tablas
+const int8_t *const formas_onda[MELODIAS_FORMAS][MELODIAS_BANDAS_FORMA] = {
+    { forma_triangular_0, forma_triangular_1, forma_triangular_2 },
+    { forma_seno, forma_seno, forma_seno },
+    { forma_sierra_0, forma_sierra_1, forma_sierra_2 },
+    { forma_cuadrada_50_0, forma_cuadrada_50_1, forma_cuadrada_50_2 },
+    { forma_cuadrada_25_0, forma_cuadrada_25_1, forma_cuadrada_25_2 },
+    { forma_cuadrada_12_0, forma_cuadrada_12_1, forma_cuadrada_12_2 },
+    { forma_ruido, forma_ruido, forma_ruido },
+};
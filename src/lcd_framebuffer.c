@@ -0,0 +1,197 @@
+/**
+ * @file lcd_framebuffer.c
+ * @brief Implementación del framebuffer sombra con volcado por diferencias.
+ *
+ * Cada carácter enviado al LCD cuesta 6 bytes I2C (dos nibbles con su pulso
+ * de enable), y reposicionar el cursor cuesta lo mismo que un carácter. Por
+ * eso el volcado recorre cada fila buscando tramos de celdas modificadas y
+ * solo mueve el cursor cuando el siguiente tramo no continúa donde quedó.
+ *
+ * Los 8 caracteres CGRAM se administran como una caché: cada glifo se
+ * identifica con una clave, y el slot a reemplazar es el usado hace más
+ * tiempo entre los que no aparecen en pantalla ni en el buffer.
+ *
+ * @date Noviembre 2025
+ */
+
+#include "lcd_framebuffer.h"
+#include "lcd_i2c.h"
+#include <string.h>
+
+/* === ESTADO === */
+static uint8_t contenido[LCD_FB_FILAS][LCD_FB_COLUMNAS];  // Lo que se quiere mostrar
+static uint8_t en_lcd[LCD_FB_FILAS][LCD_FB_COLUMNAS];     // Lo que el LCD muestra ahora
+static uint32_t celdas_sucias[LCD_FB_FILAS];              // Bit c = columna c distinta del LCD
+
+#define CURSOR_DESCONOCIDO 0xFF
+#define CELDA_DESCONOCIDA  0x00   // Código CGRAM 0: el resto del código usa los alias 0x08-0x0F
+static uint8_t cursor_fila = CURSOR_DESCONOCIDO;          // Posición real del cursor del LCD
+static uint8_t cursor_columna = 0;
+
+static uint32_t bytes_ultimo_volcado = 0;
+
+/* === CACHÉ DE GLIFOS CGRAM === */
+#define GLIFOS_CGRAM   8
+#define GLIFO_PRIMERO  0x08       // Alias de CGRAM 0..7 (0x00 es CELDA_DESCONOCIDA)
+#define GLIFO_SIN_CLAVE 0xFFFF
+static uint16_t glifo_clave[GLIFOS_CGRAM];      // Qué patrón tiene cada slot
+static uint8_t glifo_usos[GLIFOS_CGRAM];        // Celdas de contenido + en_lcd que lo usan
+static uint32_t glifo_ultimo_uso[GLIFOS_CGRAM]; // Para elegir el menos usado recientemente
+static uint32_t reloj_glifos = 0;
+static uint32_t cargas_cgram = 0;
+
+/* === FUNCIONES AUXILIARES === */
+
+static inline void contar_glifo(uint8_t caracter, int8_t delta) {
+    if ((caracter & 0xF8) == GLIFO_PRIMERO) {
+        glifo_usos[caracter & 0x07] += delta;
+    }
+}
+
+/**
+ * @brief Recalcula los usos de cada slot recorriendo ambos buffers.
+ */
+static void recontar_glifos(void) {
+    memset(glifo_usos, 0, sizeof(glifo_usos));
+    for (uint8_t fila = 0; fila < LCD_FB_FILAS; fila++) {
+        for (uint8_t col = 0; col < LCD_FB_COLUMNAS; col++) {
+            contar_glifo(contenido[fila][col], 1);
+            contar_glifo(en_lcd[fila][col], 1);
+        }
+    }
+}
+
+/* === FUNCIONES PÚBLICAS === */
+
+void lcd_fb_inicializar(void) {
+    for (uint8_t i = 0; i < GLIFOS_CGRAM; i++) {
+        glifo_clave[i] = GLIFO_SIN_CLAVE;
+        glifo_ultimo_uso[i] = 0;
+    }
+    lcd_fb_borrar_pantalla();
+}
+
+void lcd_fb_escribir_caracter(uint8_t fila, uint8_t columna, uint8_t caracter) {
+    if (fila >= LCD_FB_FILAS || columna >= LCD_FB_COLUMNAS) return;
+
+    contar_glifo(contenido[fila][columna], -1);
+    contar_glifo(caracter, 1);
+    contenido[fila][columna] = caracter;
+    if (caracter != en_lcd[fila][columna]) {
+        celdas_sucias[fila] |= (1u << columna);
+    } else {
+        celdas_sucias[fila] &= ~(1u << columna);  // Volvió a lo que ya se muestra
+    }
+}
+
+void lcd_fb_escribir(uint8_t fila, uint8_t columna, const char *texto) {
+    while (*texto && columna < LCD_FB_COLUMNAS) {
+        lcd_fb_escribir_caracter(fila, columna++, (uint8_t)*texto++);
+    }
+}
+
+void lcd_fb_limpiar(void) {
+    for (uint8_t fila = 0; fila < LCD_FB_FILAS; fila++) {
+        for (uint8_t col = 0; col < LCD_FB_COLUMNAS; col++) {
+            lcd_fb_escribir_caracter(fila, col, ' ');
+        }
+    }
+}
+
+void lcd_fb_borrar_pantalla(void) {
+    uint32_t bytes_inicio = lcd_obtener_bytes_enviados();
+
+    lcd_borrarPantalla();  // Deja el cursor en (0,0)
+    memset(contenido, ' ', sizeof(contenido));
+    memset(en_lcd, ' ', sizeof(en_lcd));
+    memset(celdas_sucias, 0, sizeof(celdas_sucias));
+    memset(glifo_usos, 0, sizeof(glifo_usos));
+    cursor_fila = 0;
+    cursor_columna = 0;
+
+    bytes_ultimo_volcado = lcd_obtener_bytes_enviados() - bytes_inicio;
+}
+
+void lcd_fb_volcar(void) {
+    uint32_t bytes_inicio = lcd_obtener_bytes_enviados();
+
+    for (uint8_t fila = 0; fila < LCD_FB_FILAS; fila++) {
+        uint32_t sucias = celdas_sucias[fila];
+        uint8_t col = 0;
+        if (!sucias) continue;
+
+        lcd_iniciar_lote();  // Toda la fila (cursores + tramos) en una transacción I2C
+        while (sucias) {
+            // Saltar hasta el comienzo del siguiente tramo modificado
+            while (!(sucias & (1u << col))) col++;
+
+            if (cursor_fila != fila || cursor_columna != col) {
+                lcd_establecer_cursor(fila, col);
+            }
+
+            // Enviar el tramo completo; el LCD autoincrementa la dirección
+            while (col < LCD_FB_COLUMNAS && (sucias & (1u << col))) {
+                lcd_escribir_byte(contenido[fila][col]);
+                contar_glifo(en_lcd[fila][col], -1);
+                contar_glifo(contenido[fila][col], 1);
+                en_lcd[fila][col] = contenido[fila][col];
+                sucias &= ~(1u << col);
+                col++;
+            }
+
+            cursor_fila = fila;
+            cursor_columna = col;
+        }
+        lcd_terminar_lote();
+        celdas_sucias[fila] = 0;
+
+        // Al final de la fila la DDRAM no continúa en la fila siguiente
+        if (cursor_fila == fila && cursor_columna >= LCD_FB_COLUMNAS) {
+            cursor_fila = CURSOR_DESCONOCIDO;
+        }
+    }
+
+    bytes_ultimo_volcado = lcd_obtener_bytes_enviados() - bytes_inicio;
+}
+
+void lcd_fb_invalidar(void) {
+    // Olvidar lo que muestra el LCD: cualquier escritura posterior lo difiere
+    memset(en_lcd, CELDA_DESCONOCIDA, sizeof(en_lcd));
+    recontar_glifos();
+    for (uint8_t fila = 0; fila < LCD_FB_FILAS; fila++) {
+        celdas_sucias[fila] = (1u << LCD_FB_COLUMNAS) - 1;
+    }
+    cursor_fila = CURSOR_DESCONOCIDO;
+}
+
+uint32_t lcd_fb_bytes_ultimo_volcado(void) {
+    return bytes_ultimo_volcado;
+}
+
+uint8_t lcd_fb_glifo(uint16_t clave, const uint8_t patron[8]) {
+    uint8_t victima = GLIFOS_CGRAM;
+
+    for (uint8_t i = 0; i < GLIFOS_CGRAM; i++) {
+        if (glifo_clave[i] == clave) {
+            glifo_ultimo_uso[i] = ++reloj_glifos;
+            return GLIFO_PRIMERO + i;
+        }
+        // Solo se puede pisar un slot que no se ve ni se quiere mostrar
+        if (glifo_usos[i] == 0 &&
+            (victima == GLIFOS_CGRAM || glifo_ultimo_uso[i] < glifo_ultimo_uso[victima])) {
+            victima = i;
+        }
+    }
+    if (victima == GLIFOS_CGRAM) return 0;  // Los 8 slots están en pantalla
+
+    lcd_crear_caracter(victima, patron);
+    cursor_fila = CURSOR_DESCONOCIDO;  // El contador de direcciones quedó en CGRAM
+    glifo_clave[victima] = clave;
+    glifo_ultimo_uso[victima] = ++reloj_glifos;
+    cargas_cgram++;
+    return GLIFO_PRIMERO + victima;
+}
+
+uint32_t lcd_fb_cargas_cgram(void) {
+    return cargas_cgram;
+}
@@ -4,46 +4,168 @@
  *
  * Este archivo contiene las funciones para inicializar y manipular el LCD usando
  * un modulo I2C y una LPC1769.
+ *
+ * La transmisión es asíncrona: los bytes PCF8574 ya codificados se encolan
+ * en un buffer circular y los envía I2C0_IRQHandler mediante
+ * I2C_MasterHandler(), de modo que el bucle principal no espera al bus.
  */
 
 #include "lcd_i2c.h"
+#include "perfil_isr.h"
 #include "LPC17xx.h"
 #include "lpc17xx_i2c.h"
 #include "lpc17xx_pinsel.h"
 
 // Dirección I2C del LCD y definición de bits de control
 #define LCD_DIRECCION        0x27
+#define LCD_BUS_I2C         LPC_I2C0 // Periférico I2C donde está el PCF8574 (P0.27/P0.28)
 #define LONG_COLUMNA_LCD         20      //  LCD de 20 columnas
 #define LONG_FILA_LCD       4       //  LCD de 4 filas
 #define LCD_LUZ_FONDO       0x08    // Bit para luz de fondo
 #define LCD_ENABLE      0x04    // Bit para pulso de habilitación
 #define MODO_COMANDO    0x00
 #define MODO_DATOS      0x01    // Bit para seleccionar registro de datos
-// Buffer de un byte para transferencias I2C
-static uint8_t i2c_buffer[1];
+#define TAM_LOTE_I2C    128     // Bytes por transacción: alcanza para cursor + 20 caracteres (126)
+#define ESPERA_COMANDO_LENTO_US 2000 // Clear/Home tardan 1.52 ms en el HD44780
+#define TAM_COLA_I2C    1024    // Bytes encolados (potencia de 2): ~2 pantallas completas
+#define MASCARA_COLA_I2C (TAM_COLA_I2C - 1)
+#define PRIORIDAD_IRQ_I2C 3     // Por debajo del audio (DMA) y los timers
+
+// Lote de bytes PCF8574 pendientes de enviar en una sola transacción I2C
+static uint8_t lote_i2c[TAM_LOTE_I2C];
+static uint16_t largo_lote = 0;
+static uint8_t lotes_abiertos = 0;  // > 0 mientras un llamador agrupa varias operaciones
+// Bytes PCF8574 enviados al LCD desde el arranque (para medir costo por frame)
+static volatile uint32_t bytes_enviados = 0;
+static volatile uint32_t transacciones_i2c = 0;
+
+// Cola circular de bytes codificados: escribe el main, consume la ISR
+static uint8_t cola_i2c[TAM_COLA_I2C];
+static volatile uint16_t cabeza_cola = 0;      // Próxima posición a escribir (main)
+static volatile uint16_t cola_cola = 0;        // Próximo byte a transmitir (ISR)
+static volatile uint8_t transferencia_activa = 0;
+static uint16_t largo_transferencia = 0;       // Bytes de la transferencia en curso
+static uint16_t maximo_ocupado = 0;            // High-water mark de la cola
+static I2C_M_SETUP_Type cfg_transferencia;     // Debe vivir mientras dure la transferencia
 
 /**
- * @brief Envía un byte por I2C al LCD. Bloquea hasta que la transferencia termina.
- * @param dato Byte a enviar
+ * @brief Lanza una transferencia por interrupción con el tramo contiguo más
+ * largo disponible en la cola (un START, una dirección y un STOP).
+ *
+ * Se llama desde el main cuando el bus está libre, o desde la ISR al terminar
+ * la transferencia anterior.
+ */
+static void i2c_iniciarTransferencia(void) {
+    uint16_t cola = cola_cola;
+    uint16_t pendientes = (uint16_t)(cabeza_cola - cola) & MASCARA_COLA_I2C;
+    uint16_t hasta_fin = TAM_COLA_I2C - (cola & MASCARA_COLA_I2C);
+
+    if (pendientes == 0) {
+        transferencia_activa = 0;
+        return;
+    }
+    largo_transferencia = (pendientes < hasta_fin) ? pendientes : hasta_fin;
+
+    cfg_transferencia.sl_addr7bit = LCD_DIRECCION;//DIRECCION DEL ESCLAVO
+    cfg_transferencia.tx_data = &cola_i2c[cola & MASCARA_COLA_I2C];//PUNTERO DE LOS DATOS A TRANSMITIR
+    cfg_transferencia.tx_length = largo_transferencia;//LONGITUD DE LOS DATOS A TRANSMITIR
+    cfg_transferencia.rx_data = NULL;//como no recibo es null
+    cfg_transferencia.rx_length = 0;
+    cfg_transferencia.retransmissions_max = 3;//nro maximo de reintentos
+    cfg_transferencia.retransmissions_count = 0;
+    cfg_transferencia.callback = NULL;
+    transferencia_activa = 1;
+    I2C_MasterTransferData(LCD_BUS_I2C, &cfg_transferencia, I2C_TRANSFER_INTERRUPT);
+}
+
+/**
+ * @brief Manejador de interrupción de I2C0: avanza la máquina de estados del
+ * driver y, al completar una transferencia, lanza la siguiente de la cola.
+ */
+void I2C0_IRQHandler(void) {
+    PerfilMarca marca;
+    perfil_isr_entrar(&marca);
+
+    I2C_MasterHandler(LCD_BUS_I2C);
+
+    if (I2C_MasterTransferComplete(LCD_BUS_I2C)) {
+        cola_cola = (uint16_t)(cola_cola + largo_transferencia) & MASCARA_COLA_I2C;
+        transacciones_i2c++;
+        i2c_iniciarTransferencia();
+    }
+
+    perfil_isr_salir(PERFIL_ISR_I2C0, &marca);
+}
+
+/**
+ * @brief Pasa el lote acumulado a la cola de transmisión y arranca el bus si
+ * estaba libre. Solo bloquea si la cola no tiene lugar para el lote.
+ */
+static void i2c_enviarLote(void) {
+    if (largo_lote == 0) return;
+
+    // Esperar lugar (la ISR sigue vaciando la cola mientras tanto)
+    while (((uint16_t)(cabeza_cola - cola_cola) & MASCARA_COLA_I2C) + largo_lote > TAM_COLA_I2C - 1) {
+    }
+
+    uint16_t cabeza = cabeza_cola;
+    for (uint16_t i = 0; i < largo_lote; i++) {
+        cola_i2c[(cabeza + i) & MASCARA_COLA_I2C] = lote_i2c[i];
+    }
+    cabeza_cola = (uint16_t)(cabeza + largo_lote) & MASCARA_COLA_I2C;  // Publicar después de copiar
+
+    uint16_t ocupado = (uint16_t)(cabeza_cola - cola_cola) & MASCARA_COLA_I2C;
+    if (ocupado > maximo_ocupado) {
+        maximo_ocupado = ocupado;
+    }
+    bytes_enviados += largo_lote;
+    largo_lote = 0;
+
+    // Si la ISR está transmitiendo, tomará los bytes nuevos al terminar
+    if (!transferencia_activa) {
+        i2c_iniciarTransferencia();
+    }
+}
+
+/**
+ * @brief Envía lo pendiente y espera a que la cola se vacíe por completo.
+ */
+static void i2c_vaciarCola(void) {
+    i2c_enviarLote();
+    while (transferencia_activa) {
+    }
+}
+
+/**
+ * @brief Agrega un byte al lote I2C. Si el lote se llena se envía.
+ * @param dato Byte a enviar al PCF8574
  */
 static void i2c_enviarByte(uint8_t dato) {
-    I2C_M_SETUP_Type cfgMaestro;
-    cfgMaestro.sl_addr7bit = LCD_DIRECCION;
-    cfgMaestro.tx_data = i2c_buffer;
-    cfgMaestro.tx_length = 1;
-    cfgMaestro.rx_data = NULL;
-    cfgMaestro.rx_length = 0;
-    cfgMaestro.retransmissions_max = 3;
-    i2c_buffer[0] = dato;
-    I2C_MasterTransferData(LPC_I2C0, &cfgMaestro, I2C_TRANSFER_POLLING);
-    cfgMaestro.sl_addr7bit = LCD_DIRECCION;//DIRECCION DEL ESCLAVO
-    cfgMaestro.tx_data = i2c_buffer;//PUNTERO DE LOS DATOS A TRANSMITIR
-    cfgMaestro.tx_length = 1;//LONGITUD DE LOS DATOS A TRANSMITIR 
-    cfgMaestro.rx_data = NULL;//punteros de los datos a recibir. como no reibo es null
-    cfgMaestro.rx_length = 0;//longitud de datos recibidos. es 0 porque no se usa
-    cfgMaestro.retransmissions_max = 3;//nro maximo de reintentos retransmisiones
-    i2c_buffer[0] = dato;//cargo en el buffer el dato na enviar
-    I2C_MasterTransferData(LPC_I2C1, &cfgMaestro, I2C_TRANSFER_POLLING);
+    if (largo_lote >= TAM_LOTE_I2C) {
+        i2c_enviarLote();
+    }
+    lote_i2c[largo_lote++] = dato;
+}
+
+/**
+ * @brief Cierra una operación pública: si nadie está agrupando, envía el lote.
+ */
+static void lcd_finOperacion(void) {
+    if (lotes_abiertos == 0) {
+        i2c_enviarLote();
+    }
+}
+
+/**
+ * @brief Espera activa para los comandos lentos del HD44780 (clear/home).
+ *
+ * Con las transferencias agrupadas los bytes llegan mucho más seguidos que
+ * antes, así que después de un clear hay que respetar su tiempo de ejecución.
+ */
+static void lcd_esperarComandoLento(void) {
+    volatile uint32_t ciclos = (SystemCoreClock / 1000000) * ESPERA_COMANDO_LENTO_US / 4;
+    while (ciclos--) {
+    }
 }
 
 /**
@@ -83,15 +205,23 @@ static void lcd_enviarNibble(uint8_t dato) {
  * @brief Inicializa el LCD en modo 4 bits, limpia pantalla y configura parámetros básicos.
  */
 void lcd_inicializar(void) {
-    lcd_enviarNibble(0x30);
-    lcd_enviarNibble(0x30);
-    lcd_enviarNibble(0x30);
+    NVIC_SetPriority(I2C0_IRQn, PRIORIDAD_IRQ_I2C);
+
+    // Secuencia de reset a 8 bits: cada nibble en su propia transacción y con espera
+    for (uint8_t i = 0; i < 3; i++) {
+        lcd_enviarNibble(0x30);
+        i2c_vaciarCola();
+        lcd_esperarComandoLento();
+    }
     lcd_enviarNibble(0x20);
     lcd_enviarByte(0x28, MODO_COMANDO);
     lcd_enviarByte(0x08, MODO_COMANDO);
     lcd_enviarByte(0x01, MODO_COMANDO);
+    i2c_vaciarCola();
+    lcd_esperarComandoLento();
     lcd_enviarByte(0x06, MODO_COMANDO);
     lcd_enviarByte(0x0C, MODO_COMANDO);
+    i2c_enviarLote();
 }
 
 /**
@@ -100,8 +230,11 @@ void lcd_inicializar(void) {
  * @param columna Columna (0 a 19)
  */
 void lcd_establecer_cursor(uint8_t fila, uint8_t columna) {
-    uint8_t posicion[] = {0x00, 0x40, 0x14, 0x54};
+    // En el 20x4 la fila 2 continúa a la 0 y la 3 a la 1 dentro de la DDRAM
+    static const uint8_t posicion[LONG_FILA_LCD] = {0x00, 0x40, 0x14, 0x54};
+    if (fila >= LONG_FILA_LCD || columna >= LONG_COLUMNA_LCD) return;
     lcd_enviarByte(0x80 | (posicion[fila] + columna), MODO_COMANDO);
+    lcd_finOperacion();
 }
 
 /**
@@ -112,6 +245,7 @@ void lcd_escribir(const char *string) {
     while (*string){
         lcd_enviarByte(*string++, MODO_DATOS);
     }
+    lcd_finOperacion();
 }
 
 /**
@@ -119,6 +253,8 @@ void lcd_escribir(const char *string) {
  */
 void lcd_borrarPantalla(void) {
     lcd_enviarByte(0x01, MODO_COMANDO);
+    i2c_vaciarCola();  // El clear no puede ir seguido de otro comando sin esperar
+    lcd_esperarComandoLento();
     lcd_establecer_cursor(0, 0);
 }
 
@@ -127,14 +263,13 @@ void lcd_borrarPantalla(void) {
  * @param fila Fila a borrar (0 a 3)
  */
 void lcd_borrarFila(uint8_t fila) {
+    lcd_iniciar_lote();
     lcd_establecer_cursor(fila, 0);
-    for (uint8_t i = 0; i < 20; i++) lcd_enviarByte(' ', MODO_DATOS);
-    lcd_establecer_cursor(fila, 0);
-    lcd_setCursor(fila, 0);
     for (uint8_t i = 0; i < LONG_COLUMNA_LCD; i++){
         lcd_enviarByte(' ', MODO_DATOS);
     }
-    lcd_setCursor(fila, 0);
+    lcd_establecer_cursor(fila, 0);
+    lcd_terminar_lote();
 }
 
 /**
@@ -142,6 +277,7 @@ void lcd_borrarFila(uint8_t fila) {
  */
 void lcd_borrarCaracter(void) {
     lcd_enviarByte(' ', MODO_DATOS);
+    lcd_finOperacion();
 }
 
 /**
@@ -150,6 +286,7 @@ void lcd_borrarCaracter(void) {
 void lcd_desplazarIzquierda(void) {
     lcd_enviarByte(0x18, MODO_COMANDO);
     //0X18 COMANDO PARA DESPLAZAR A LA IZQUIERDA
+    lcd_finOperacion();
 }
 
 /**
@@ -157,6 +294,7 @@ void lcd_desplazarIzquierda(void) {
  */
 void lcd_desplazarDerecha(void) {
     lcd_enviarByte(0x1C, MODO_COMANDO);
+    lcd_finOperacion();
 }
 
 /**
@@ -164,6 +302,7 @@ void lcd_desplazarDerecha(void) {
  */
 void lcd_activar_parpadeo_cursor(void) {
     lcd_enviarByte(0x0F, MODO_COMANDO);
+    lcd_finOperacion();
 }
 
 /**
@@ -171,6 +310,7 @@ void lcd_activar_parpadeo_cursor(void) {
  */
 void lcd_desactivar_parpadeo_cursor(void) {
     lcd_enviarByte(0x0C, MODO_COMANDO);
+    lcd_finOperacion();
 }
 
 /**
@@ -183,6 +323,7 @@ void lcd_crear_caracter(uint8_t indice, const uint8_t patron[8]) {
     for (int i = 0; i < 8; i++) {
         lcd_enviarByte(patron[i] & 0x1F, MODO_DATOS);
     }
+    lcd_finOperacion();
 }
 
 /**
@@ -190,4 +331,57 @@ void lcd_crear_caracter(uint8_t indice, const uint8_t patron[8]) {
  */
 void lcd_escribir_byte(uint8_t ch) {
     lcd_enviarByte(ch, MODO_DATOS);
+    lcd_finOperacion();
+}
+
+/**
+ * @brief Abre un lote: las operaciones siguientes se acumulan sin enviarse.
+ */
+void lcd_iniciar_lote(void) {
+    lotes_abiertos++;
+}
+
+/**
+ * @brief Cierra un lote; al cerrar el más externo se envía todo lo acumulado.
+ */
+void lcd_terminar_lote(void) {
+    if (lotes_abiertos > 0) {
+        lotes_abiertos--;
+    }
+    lcd_finOperacion();
+}
+
+/**
+ * @brief Indica si la cola quedó vacía y no hay transferencia en curso.
+ */
+uint8_t lcd_transmision_completa(void) {
+    return (largo_lote == 0 && !transferencia_activa);
+}
+
+/**
+ * @brief Bloquea hasta que todo lo encolado haya salido por el bus.
+ */
+void lcd_esperar_transmision(void) {
+    i2c_vaciarCola();
+}
+
+/**
+ * @brief Máxima ocupación que alcanzó la cola de transmisión (bytes).
+ */
+uint16_t lcd_cola_maximo_ocupado(void) {
+    return maximo_ocupado;
+}
+
+/**
+ * @brief Devuelve la cantidad de bytes I2C enviados al LCD desde el arranque.
+ */
+uint32_t lcd_obtener_bytes_enviados(void) {
+    return bytes_enviados;
+}
+
+/**
+ * @brief Devuelve la cantidad de transacciones I2C (START..STOP) realizadas.
+ */
+uint32_t lcd_obtener_transacciones_i2c(void) {
+    return transacciones_i2c;
 }
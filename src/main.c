@@ -12,36 +12,63 @@
 #include "lpc17xx_i2c.h"
 #include "lpc17xx_pinsel.h"
 #include "lcd_i2c.h"
+#include "lcd_framebuffer.h" // Framebuffer con volcado por diferencias
 #include "dino_game.h"
 #include "snake_game.h"     // Juego Snake
 #include "menu_juegos.h"    // Sistema de menú
 #include "melodias_dac.h"   // Sistema de melodías
 #include "joystick_adc.h"   // Control de joystick con ADC
 #include "bluetooth_uart.h" // Comunicación Bluetooth (UART0)
-#include "lpc17xx_uart.h"
-#include "lpc17xx_timer.h"
+#include "planificador.h"   // Tareas periódicas sobre SysTick
+#include "perfil_isr.h"     // Ciclos por interrupción (comando 'I')
 #define DIRECCION_LCD 0x27
+#define PERIODO_SALUDO_MS 1000  // Mensaje periódico por UART0
 
 /**
  * @brief Configura los pines necesarios para la comunicación I2C1.
  * Utiliza P0.0 (SDA1) y P0.1 (SCL1) en modo función 3.
  */
 void cfgPin(void);
-void cfgtimer(void);
-void cfguart(void);
 /**
  * @brief Inicializa el periférico I2C1 a 100kHz.
  */
 void cfgI2c(void);
+/**
+ * @brief Configura todo el hardware, saluda por Bluetooth y muestra los créditos.
+ */
+void arcade_inicializar(void);
+/**
+ * @brief Una vuelta del bucle principal (música, menú o juego, Bluetooth, joystick).
+ *
+ * No bloquea: main() la llama sin parar y el simulador de tools/simulador/
+ * la intercala con su reloj virtual.
+ */
+void arcade_ejecutar_ciclo(void);
+
+/* === ESTADO DEL BUCLE PRINCIPAL === */
+static int8_t juego_actual = -1;  // -1 = en menú, 0 = Dino, 1 = Snake
+static uint8_t juego_inicializado = 0;
+static int8_t musica_estado_anterior = -2;  // Para detectar cambios de estado
+static uint8_t tarea_saludo = PLANIFICADOR_SIN_TAREA;
 
 int main(void) {
+    arcade_inicializar();
+    while (1) {
+        arcade_ejecutar_ciclo();
+    }
+}
+
+void arcade_inicializar(void) {
     SystemInit();    // Inicializa el sistema y los relojes
+    planificador_inicializar(); // SysTick de 1ms: ticks de los juegos y tareas periódicas
+    perfil_isr_inicializar();   // Contador DWT para medir cada ISR
     cfgPin();        // Configura los pines
     cfgI2c();        // Inicializa el periférico I2C
     joystick_inicializar(); // Inicializa joystick ADC y LEDs indicadores PRIMERO (antes de DMA)
-    bt_inicializar();       // Inicializa Bluetooth UART0 (P0.2 TX, P0.3 RX, 9600 bps) + DMA
-    melodias_inicializar(); // Inicializa sistema de melodías (DAC + Timer0/Timer1 + DMA)
+    bt_inicializar();       // Única configuración de UART0 (P0.2 TX, P0.3 RX, BT_VELOCIDAD_UART0), RX por interrupción
+    melodias_inicializar(); // Inicializa sistema de melodías (DAC + Timer1 + DMA)
     lcd_inicializar();      // Inicializa el LCD
+    lcd_fb_inicializar();   // Framebuffer sombra (todo el dibujo pasa por aquí)
     
     // Re-habilitar ADC después de que DMA haya sido inicializado
     // GPDMA_Init() puede haber alterado registros del ADC
@@ -49,101 +76,107 @@ int main(void) {
 
     /* Enviar mensaje de bienvenida por Bluetooth */
     bt_escribir_cadena("\r\n=== DINOCHROME ARCADE ===\r\n");
-    bt_escribir_cadena("Comandos: W(arriba) S(abajo) A(izq) D(der) B(boton)\r\n");
+    bt_escribir_cadena("Comandos: W(arriba) S(abajo) A(izq) D(der) B(boton) I(carga ISR)\r\n");
     bt_escribir_cadena("¡Conectado!\r\n\r\n");
 
-    lcd_borrarPantalla();
+    lcd_fb_borrar_pantalla();
     
     // Inicializar el menú de selección
     menu_inicializar();
     
-    // Estado del sistema
-    int8_t juego_actual = -1;  // -1 = en menú, 0 = Dino, 1 = Snake
-    uint8_t juego_inicializado = 0;
-    int8_t musica_estado_anterior = -2;  // Para detectar cambios de estado
-    cfgtimer();
-    cfguart();
-    lcd_init();      // Inicializa el LCD
-
-    lcd_borrarPantalla();     // Limpia la pantalla
-    lcd_setCursor(0, 0); lcd_escribir("  dariio castillo ");
-    lcd_setCursor(1, 0); lcd_escribir(" enzo laura");
-    lcd_setCursor(2, 0); lcd_escribir("jose acevedo   ");
-    lcd_setCursor(3, 0); lcd_escribir("Digital 3 --");
+    planificador_crear_tarea(&tarea_saludo, PERIODO_SALUDO_MS, 0);
+
+    // Créditos (por el framebuffer, como cualquier otra pantalla)
+    lcd_fb_borrar_pantalla();
+    lcd_fb_escribir(0, 0, "  dariio castillo ");
+    lcd_fb_escribir(1, 0, " enzo laura");
+    lcd_fb_escribir(2, 0, "jose acevedo   ");
+    lcd_fb_escribir(3, 0, "Digital 3 --");
+    lcd_fb_volcar();
+}
 
-    while (1) {
-        // Gestionar música de fondo según el estado
-        if (juego_actual != musica_estado_anterior) {
-            if (juego_actual == -1) {
-                // Música de menú: Nokia
-                melodias_iniciar_loop(melodia_nokia);
-            } else if (juego_actual == 0) {
-                // Música de Dino: Mario completo (melodia_fondo)
-                melodias_iniciar_loop(melodia_fondo);
+void arcade_ejecutar_ciclo(void) {
+    // Gestionar música de fondo según el estado
+    if (juego_actual != musica_estado_anterior) {
+        if (juego_actual == -1) {
+            // Música de menú: Nokia
+            melodias_iniciar_loop(melodia_nokia);
+        } else if (juego_actual == 0) {
+            // Música de Dino: Mario completo (melodia_fondo)
+            melodias_iniciar_loop(melodia_fondo);
+        } else if (juego_actual == 1) {
+            // Música de Snake: Tetris
+            melodias_iniciar_loop(melodia_tetris);
+        }
+        musica_estado_anterior = juego_actual;
+    }
+    
+    if (juego_actual == -1) {
+        /* === MODO MENÚ === */
+        int8_t seleccion = menu_ejecutar();
+        
+        if (seleccion >= 0) {
+            // Usuario seleccionó un juego
+            juego_actual = seleccion;
+            juego_inicializado = 0;  // Marcar para inicializar
+        }
+    } else {
+        /* === MODO JUEGO === */
+        
+        // Inicializar juego si es necesario
+        if (!juego_inicializado) {
+            if (juego_actual == 0) {
+                juego_dinosaurio_inicializar();
             } else if (juego_actual == 1) {
-                // Música de Snake: Tetris
-                melodias_iniciar_loop(melodia_tetris);
+                juego_serpiente_inicializar();
             }
-            musica_estado_anterior = juego_actual;
+            juego_inicializado = 1;
         }
         
-        if (juego_actual == -1) {
-            /* === MODO MENÚ === */
-            int8_t seleccion = menu_ejecutar();
+        // Ejecutar juego activo
+        if (juego_actual == 0) {
+            juego_dinosaurio_ejecutar();
             
-            if (seleccion >= 0) {
-                // Usuario seleccionó un juego
-                juego_actual = seleccion;
-                juego_inicializado = 0;  // Marcar para inicializar
+            // Si Dino terminó y usuario presionó botón, volver al menú
+            if (juego_dinosaurio_ha_terminado() == 2) {
+                lcd_fb_borrar_pantalla(); // Primero borrar la pantalla
+                juego_dinosaurio_reiniciar();      // Reiniciar juego para próxima partida
+                juego_actual = -1;        // Volver al menú
+                juego_inicializado = 0;   // Marcar para re-inicializar
+                menu_reiniciar();             // Dibujar menú (DESPUÉS de borrar)
             }
-        } else {
-            /* === MODO JUEGO === */
             
-            // Inicializar juego si es necesario
-            if (!juego_inicializado) {
-                if (juego_actual == 0) {
-                    juego_dinosaurio_inicializar();
-                } else if (juego_actual == 1) {
-                    juego_serpiente_inicializar();
-                }
-                juego_inicializado = 1;
-            }
+        } else if (juego_actual == 1) {
+            juego_serpiente_ejecutar();
             
-            // Ejecutar juego activo
-            if (juego_actual == 0) {
-                juego_dinosaurio_ejecutar();
-                
-                // Si Dino terminó y usuario presionó botón, volver al menú
-                if (juego_dinosaurio_ha_terminado() == 2) {
-                    lcd_borrarPantalla();     // Primero borrar la pantalla
-                    juego_dinosaurio_reiniciar();      // Reiniciar juego para próxima partida
-                    juego_actual = -1;        // Volver al menú
-                    juego_inicializado = 0;   // Marcar para re-inicializar
-                    menu_reiniciar();             // Dibujar menú (DESPUÉS de borrar)
-                }
-                
-            } else if (juego_actual == 1) {
-                juego_serpiente_ejecutar();
-                
-                // Si Snake terminó y usuario presionó botón, volver al menú
-                if (juego_serpiente_ha_terminado() == 2) {
-                    lcd_borrarPantalla();     // Primero borrar la pantalla
-                    juego_serpiente_reiniciar();     // Reiniciar juego para próxima partida
-                    juego_actual = -1;        // Volver al menú
-                    juego_inicializado = 0;   // Marcar para re-inicializar
-                    menu_reiniciar();             // Dibujar menú (DESPUÉS de borrar)
-                }
+            // Si Snake terminó y usuario presionó botón, volver al menú
+            if (juego_serpiente_ha_terminado() == 2) {
+                lcd_fb_borrar_pantalla(); // Primero borrar la pantalla
+                juego_serpiente_reiniciar();     // Reiniciar juego para próxima partida
+                juego_actual = -1;        // Volver al menú
+                juego_inicializado = 0;   // Marcar para re-inicializar
+                menu_reiniciar();             // Dibujar menú (DESPUÉS de borrar)
             }
         }
+    }
+
+    /* LED de melodías (las notas avanzan solas en TIMER1) */
+    melodias_actualizar();
+
+    /* Procesar lo que recibió UART0_IRQHandler */
+    bt_actualizar_buffer();
 
-        /* Actualizar sistema de melodías (no bloqueante) */
-        melodias_actualizar();
+    /* Tabla de carga de las interrupciones pedida por Bluetooth */
+    if (bt_obtener_pedido_perfil()) {
+        perfil_isr_volcar(bt_escribir_cadena);
+    }
 
-        /* Actualizar buffer Bluetooth (lectura UART polling) */
-        bt_actualizar_buffer();
+    /* Actualizar joystick y LEDs indicadores (no bloqueante) */
+    joystick_actualizar();
 
-        /* Actualizar joystick y LEDs indicadores (no bloqueante) */
-        joystick_actualizar();
+    /* Mensaje periódico por UART0 (antes lo enviaba la ISR de TIMER0) */
+    if (planificador_tarea_lista(tarea_saludo)) {
+        bt_escribir_cadena("hola");
     }
 }
 
@@ -168,15 +201,9 @@ void cfgPin(void) {
     PinCfg.pinNum = 1; // SCL1
     PINSEL_ConfigPin(&PinCfg);
 
-     //pin transmisor usart. p0.2
+    // P0.2/P0.3 (UART0) los configura bt_inicializar()
     PINSEL_CFG_Type pin_configuration;
-    pin_configuration.portNum   = PINSEL_PORT_0;
-    pin_configuration.pinNum    = PINSEL_PIN_2;
-    pin_configuration.pinMode   = PINSEL_TRISTATE;
-    pin_configuration.funcNum   = PINSEL_FUNC_1;  // USART0
-    pin_configuration.openDrain = PINSEL_OD_NORMAL;
-    PINSEL_ConfigPin(&pin_configuration);
-    
+
     // Configurar P0.4 como entrada con PULL-UP para botón del joystick
     // El botón conecta a GND (sin resistencia externa), necesitamos pull-up
     pin_configuration.portNum   = PINSEL_PORT_0;
@@ -188,58 +215,6 @@ void cfgPin(void) {
     
     // Asegurar que P0.4 sea entrada
     LPC_GPIO0->FIODIR &= ~(1 << 4);
-}
-void cfgtimer(void){
-	TIM_TIMERCFG_Type timer_config;
-	TIM_MATCHCFG_Type match_config;
-
-    timer_config.prescaleOption = TIM_USVAL;
-    timer_config.prescaleValue = 1000; //1ms
-
-    TIM_Init(LPC_TIM0, TIM_TIMER_MODE, &timer_config);
-
-    //Configuracion del match
-    match_config.matchChannel = TIM_MATCH_0;
-    match_config.intOnMatch = ENABLE;
-    match_config.resetOnMatch = ENABLE;
-    match_config.stopOnMatch = DISABLE;
-    match_config.extMatchOutputType = TIM_NOTHING;
-    match_config.matchValue = 1000; // 1s quiero transmitir
-
-    TIM_ConfigMatch(LPC_TIM0, &match_config);
-
-    //Habilitar interrupcion?
-    NVIC_EnableIRQ(TIMER0_IRQn);
-
-    //Iniciar timer
-    TIM_Cmd(LPC_TIM0, ENABLE);
-}
-
-void cfguart(void){
-    UART_CFG_Type uart_config;
-
-    uart_config.Baud_rate = 9600;
-    uart_config.Databits = UART_DATABIT_8;
-    uart_config.Parity = UART_PARITY_NONE;//sin paridad
-    uart_config.Stopbits = UART_STOPBIT_1;//1 bit de stop
-    UART_Init((LPC_UART_TypeDef *)LPC_UART0, &uart_config);
-//CARGO ESTRUCTURA
-
-    UART_FIFO_CFG_Type fifo_config;
-
-    fifo_config.FIFO_DMAMode = DISABLE;
-    fifo_config.FIFO_Level = UART_FIFO_TRGLEV1;//4 caracteres
-    fifo_config.FIFO_ResetRxBuf = ENABLE;//no lo uso
-    fifo_config.FIFO_ResetTxBuf = ENABLE;
-    UART_FIFOConfig((LPC_UART_TypeDef *)LPC_UART0, &fifo_config);
-//CARGO ESTRUCTURA
-
-
-
-    //Habilitar transmisor
-    UART_TxCmd((LPC_UART_TypeDef *)LPC_UART0, ENABLE);
-
-
 }
 /**
  * @brief Inicializa el periférico I2C0 a 100kHz y lo habilita.
@@ -268,13 +243,3 @@ void cfgI2c(void) {
     I2C_Init(I2CDEV, 100000);
     I2C_Cmd(I2CDEV, ENABLE);
 }
-
-void TIMER0_IRQHandler(void){
-    static const char mensaje[] = "hola";
-
-    if (TIM_GetIntStatus(LPC_TIM0, TIM_MR0_INT)){
-        UART_Send((LPC_UART_TypeDef *)LPC_UART0, (uint8_t *)mensaje, sizeof(mensaje) - 1, BLOCKING);
-        TIM_ClearIntPending(LPC_TIM0, TIM_MR0_INT);
-    }
-}
-
@@ -1,28 +1,59 @@
 /**
  * @file melodias_dac.c
  * @brief Implementación del sistema de reproducción de melodías con DAC + DMA
- * @details Genera señales triangulares usando el DAC con DMA y Timer0 para reproducir
+ * @details Genera señales con el DAC alimentado por DMA para reproducir
  *          melodías musicales en segundo plano sin bloquear el programa.
+ *          Cada voz elige su forma de onda (MELODIAS_FORMA_*).
+ *
+ *          El oscilador es un DDS: un acumulador de fase de 32 bits avanza a
+ *          frecuencia de muestreo fija y sus 8 bits altos indexan una tabla de
+ *          256 muestras. La afinación ya no depende de la nota y cambiar de
+ *          nota es solo cambiar el incremento de fase.
+ *
+ *          Hay MELODIAS_VOCES voces: la 0 es la música (loop o una vez) y las
+ *          demás tocan efectos encima sin interrumpirla. Acá vive el
+ *          secuenciador, que lee canciones compiladas (un byte por evento,
+ *          ver melodias_dac.h) y dispara cada nota con su envolvente; la
+ *          síntesis y la mezcla están en mezclador_audio.c (C puro, medible
+ *          en la PC). El costo por bloque está acotado y se mide con el
+ *          contador de ciclos (DWT).
+ *
+ *          Las muestras se calculan por bloques en dos buffers (ping-pong) que
+ *          el DMA recorre con dos LLI enlazados entre sí; el ritmo lo da el
+ *          contador del DAC (DACCNTVAL) y la interrupción de fin de bloque
+ *          rellena el buffer que se acaba de vaciar.
+ *
+ *          El secuenciador corre en la ISR de Timer1 (1 ms), por debajo del
+ *          DMA y por encima de SysTick e I2C: cada voz guarda el instante
+ *          programado de su próximo evento, así que el ritmo no depende de
+ *          cuánto tarde el loop principal. La diferencia entre el instante
+ *          programado y el disparo real se mide en µs (jitter).
  *
  * @date Noviembre 2025
  */
 
 #include "melodias_dac.h"
+#include "mezclador_audio.h"
+#include "perfil_isr.h"
 #include "LPC17xx.h"
 #include "lpc17xx_timer.h"
 #include "lpc17xx_gpio.h"
 #include "lpc17xx_pinsel.h"
 #include "lpc17xx_dac.h"
 #include "lpc17xx_gpdma.h"
+#include "lpc17xx_clkpwr.h"
 #include "dino_game.h"
+#include <stdint.h>
 
 /* ==================== CONFIGURACIÓN INTERNA =============================== */
 
-#define NUMERO_MUESTRAS            16    // Doble de rápido (16 muestras)
-#define MAXIMO_VALOR_DAC           1023
-#define MICROSEGUNDOS_POR_SEGUNDO  1000000
-#define PAUSA_ARTICULACION_MS      30
-#define LED_ALTERNAR_INTERRUPCIONES  500
+#define MUESTRAS_BLOQUE            MELODIAS_MUESTRAS_BLOQUE
+#define MS_SEMICORCHEA_X_TEMPO     15000 // Una negra son 60000 / tempo ms
+
+/* Orden de prioridades del audio: muestras > secuenciador > resto */
+#define PRIORIDAD_IRQ_DMA          1
+#define PRIORIDAD_IRQ_SECUENCIADOR 2
+#define US_POR_TICK                1000  // Timer1: 1 cuenta = 1 µs, match cada 1 ms
 
 #define PORT_CERO                  0
 #define PIN_22                     ((uint32_t)(1<<22))
@@ -31,127 +62,304 @@
 #define MELODIAS_DMA_CH       1  // Canal DMA 1
 #define MELODIAS_CONEXION_DMA    GPDMA_DAC
 
-/* ========================== TABLA DE ONDA ================================= */
+/* Control del LLI: un bloque, palabras de 32 bits, fuente incremental,
+   destino fijo (DACR) e interrupción al terminar el bloque */
+#define CONTROL_LLI_MELODIAS  (GPDMA_DMACCxControl_TransferSize(MUESTRAS_BLOQUE) | \
+                               GPDMA_DMACCxControl_SWidth(GPDMA_WORD) | \
+                               GPDMA_DMACCxControl_DWidth(GPDMA_WORD) | \
+                               GPDMA_DMACCxControl_SI | \
+                               GPDMA_DMACCxControl_I)
+
+/* === CLIPS PCM === */
+#define CLIP_MUESTRAS_TRAMO        1000  // 50 ms por LLI: melodias_clip_detener() corta en <= 2 tramos
+#define CLIP_LLI_MAXIMO            40    // Hasta 2 s de clips encadenados
+#define CLIP_COLA                  4
+#define TRAMOS_CLIP(c)             (((c)->cantidad + CLIP_MUESTRAS_TRAMO - 1) / CLIP_MUESTRAS_TRAMO)
+
+
+/* ===================== DECODIFICACIÓN DE CANCIONES ======================= */
+
+/* Cada código de evento (nota + duración) es una palabra: incremento DDS en
+   los bits 27..0 (SI_5 = 988 Hz necesita 28) y semicorcheas en 31..28 */
+#define EVENTO_BITS_INCREMENTO     28
+#define EVENTO_MASCARA_INCREMENTO  ((1UL << EVENTO_BITS_INCREMENTO) - 1)
+
+#define INCREMENTO_DDS(hz)  ((uint32_t)((((uint64_t)(hz) << 32) + MELODIAS_FRECUENCIA_MUESTREO_HZ / 2) / \
+                                        MELODIAS_FRECUENCIA_MUESTREO_HZ))
+#define EVENTO_TABLA(nota, codigo) \
+    (((uint32_t)CANCION_SEMICORCHEAS(codigo) << EVENTO_BITS_INCREMENTO) | INCREMENTO_DDS(nota)),
+
+static const uint32_t TABLA_EVENTOS[CANCION_EVENTOS] = {
+    CANCION_LISTA_NOTAS(EVENTO_TABLA, 0)
+    CANCION_LISTA_NOTAS(EVENTO_TABLA, 1)
+    CANCION_LISTA_NOTAS(EVENTO_TABLA, 2)
+    CANCION_LISTA_NOTAS(EVENTO_TABLA, 3)
+    CANCION_LISTA_NOTAS(EVENTO_TABLA, 4)
+    CANCION_LISTA_NOTAS(EVENTO_TABLA, 5)
+};
+
+/* Banda de formas_onda[] para un incremento: una por octava de las notas */
+static uint8_t banda_forma(uint32_t incremento) {
+    if (incremento < INCREMENTO_DDS(DO_4)) return 0;
+    if (incremento < INCREMENTO_DDS(DO_5)) return 1;
+    return 2;
+}
 
-const uint16_t TABLA_TRIANGULAR[NUMERO_MUESTRAS] = {
-    0,    128,  256,  384,  512,  640,  768,  896,
-    1023, 896,  768,  640,  512,  384,  256,  128
+/* Envolventes MELODIAS_ENV_*: ataque, decaimiento (ms), sostenido (%), liberación (ms) */
+static const EnvolventeADSR ENVOLVENTES[MELODIAS_ENVOLVENTES] = {
+    {  5,   0, 100,  30 },   // LEGATO: la pausa de 30 ms entre notas de antes
+    {  2, 120,  40,  40 },   // PERCUSIVA
+    { 40, 150,  70, 120 },   // SUAVE
+    {  0,   0, 100,  10 },   // EFECTO
 };
 
 /* === VARIABLES DMA === */
-static volatile uint8_t dma_melodias_enabled = 0;  // Flag de DMA activo
-static volatile uint16_t dma_melodias_index = 0;   // Índice para LLI
+static uint32_t buffer_audio[2][MUESTRAS_BLOQUE];   // Ping-pong en formato DACR
+static GPDMA_LLI_Type lli_melodias[2];              // Cada LLI apunta al otro
+static uint8_t bloque_libre = 0;                    // Bloque que el DMA terminó de enviar
+
+/* === VARIABLES CLIPS PCM === */
+typedef enum {
+    CLIP_LIBRE = 0,     // El DMA solo recorre el anillo
+    CLIP_PROGRAMADO,    // Cadena enganchada detrás de bloque_entrada
+    CLIP_ARMADO,        // El DMA ya cargó bloque_entrada con el enganche
+    CLIP_SONANDO        // El DMA está en la cadena; vuelve solo al anillo
+} EstadoClip;
+
+static GPDMA_LLI_Type lli_clips[CLIP_LLI_MAXIMO];
+static uint8_t lli_clips_usados = 0;
+static GPDMA_LLI_Type *cola_cadena = NULL;          // Último tramo armado (NULL = no se puede extender)
+static volatile uint8_t estado_clip = CLIP_LIBRE;
+static uint8_t bloque_entrada = 0;                  // Bloque detrás del cual se enganchó la cadena
+static const ClipPCM *clips_pendientes[CLIP_COLA];  // Esperan al próximo fin de bloque
+static uint8_t cantidad_pendientes = 0;
+static volatile uint32_t clips_reproducidos = 0;
+static volatile uint32_t clips_huecos = 0;
+static volatile uint32_t clips_rechazados = 0;
 
-/* ============================= MELODÍAS =================================== */
+/* ========================== VARIABLES INTERNAS ============================ */
 
-const Nota melodia_happy_birthday[] = {
-    {DO_4, NEGRA}, {DO_4, CORCHEA}, {RE_4, BLANCA},
-    {DO_4, BLANCA}, {FA_4, BLANCA}, {MI_4, REDONDA},
-    {DO_4, NEGRA}, {DO_4, CORCHEA}, {RE_4, BLANCA},
-    {DO_4, BLANCA}, {SOL_4, BLANCA}, {FA_4, REDONDA},
-    {SILENCIO, 0}
-};
+/**
+ * @brief Secuenciador de una voz (el oscilador está en mezclador_audio.c)
+ */
+typedef struct {
+    const uint8_t *cancion;             // NULL = voz libre
+    const uint8_t *cursor;              // Próximo byte de evento
+    const uint8_t *marca_loop;          // Adonde vuelve el loop
+    const EnvolventeADSR *envolvente;
+    uint8_t forma;                      // MELODIAS_FORMA_*
+    uint16_t ms_semicorchea;            // Del tempo de la cabecera
+    uint32_t inicio_nota_ms;            // Instante programado de la nota actual
+    uint32_t liberacion_ms;             // Instante programado de la liberación
+    uint32_t proximo_evento_ms;         // Instante programado de la nota siguiente
+    uint8_t liberada;
+    uint32_t iniciada_en_ms;            // Para elegir qué efecto reemplazar
+    uint8_t loop;                       // 1 = repetir al terminar
+} Voz;
+
+static Voz voces[MELODIAS_VOCES];
+static uint8_t forma_inicial[MELODIAS_VOCES];       // melodias_establecer_forma_voz()
+static volatile uint32_t tiempo_transcurrido_ms = 0;
+static volatile uint8_t volumen_porcentaje = 100;
 
-const Nota melodia_mario[] = {
-    {MI_5, CORCHEA}, {MI_5, CORCHEA}, {SILENCIO, CORCHEA}, {MI_5, CORCHEA},
-    {SILENCIO, CORCHEA}, {DO_5, CORCHEA}, {MI_5, CORCHEA}, {SILENCIO, CORCHEA},
-    {SOL_5, NEGRA}, {SILENCIO, NEGRA}, {SOL_4, NEGRA}, {SILENCIO, NEGRA},
-    {SILENCIO, 0}
-};
+/* === ESTADÍSTICAS DEL MEZCLADOR === */
+static volatile uint32_t bloques_mezclados = 0;
+static volatile uint32_t ciclos_ultimo_bloque = 0;
+static volatile uint32_t ciclos_peor_bloque = 0;
+static volatile uint32_t bloques_tarde = 0;         // El DMA ya estaba leyendo el bloque a rellenar
 
-const Nota melodia_tetris[] = {
-    {MI_4, NEGRA}, {SI_3, CORCHEA}, {DO_4, CORCHEA}, {RE_4, NEGRA},
-    {DO_4, CORCHEA}, {SI_3, CORCHEA}, {LA_3, NEGRA}, {LA_3, CORCHEA},
-    {DO_4, CORCHEA}, {MI_4, NEGRA}, {RE_4, CORCHEA}, {DO_4, CORCHEA},
-    {SI_3, NEGRA+CORCHEA}, {DO_4, CORCHEA}, {RE_4, NEGRA}, {MI_4, NEGRA},
-    {SILENCIO, 0}
-};
+/* === ESTADÍSTICAS DEL SECUENCIADOR (las escribe solo la ISR de Timer1) === */
+static uint32_t notas_secuenciadas = 0;
+static uint64_t error_total_us = 0;
+static uint32_t error_maximo_us = 0;
+static uint32_t notas_tarde = 0;                    // Disparadas uno o más ticks después de lo programado
 
-const Nota melodia_nokia[] = {
-    {MI_5, CORCHEA}, {RE_5, CORCHEA}, {FA_S4, NEGRA}, {SOL_S4, NEGRA},
-    {DO_S5, CORCHEA}, {SI_4, CORCHEA}, {RE_4, NEGRA}, {MI_4, NEGRA},
-    {SI_4, CORCHEA}, {LA_4, CORCHEA}, {DO_S4, NEGRA}, {MI_4, NEGRA},
-    {LA_4, BLANCA},
-    {SILENCIO, 0}
-};
+/**
+ * @brief Mezcla un bloque y mide cuántos ciclos costó
+ *
+ * Se llama solo desde la ISR de DMA (y antes de arrancar el canal).
+ */
+static void renderizar_bloque(uint32_t *destino) {
+    uint32_t inicio = PERFIL_DWT_CYCCNT;
 
-// Melodía corta para game over
-const Nota melodia_game_over[] = {
-    {DO_4, CORCHEA}, {SOL_3, CORCHEA}, {MI_3, NEGRA},
-    {LA_3, CORCHEA}, {SI_3, CORCHEA}, {LA_3, CORCHEA}, {SOL_S3, CORCHEA},
-    {LA_S3, BLANCA}, {SOL_S3, BLANCA},
-    {SILENCIO, 0}
-};
+    mezclador_renderizar(destino);
 
-// Efecto de sonido corto para salto
-const Nota melodia_salto[] = {
-    {DO_5, SEMICORCHEA}, {MI_5, SEMICORCHEA}, {SOL_5, SEMICORCHEA},
-    {SILENCIO, 0}
-};
+    uint32_t ciclos = PERFIL_DWT_CYCCNT - inicio;
+    ciclos_ultimo_bloque = ciclos;
+    if (ciclos > ciclos_peor_bloque) {
+        ciclos_peor_bloque = ciclos;
+    }
+    bloques_mezclados++;
+}
 
-// Melodía de fondo tipo Mario Bros (música ambiente del juego)
-const Nota melodia_fondo[] = {
-    // Intro
-    {MI_5, CORCHEA}, {MI_5, CORCHEA}, {SILENCIO, CORCHEA}, {MI_5, CORCHEA},
-    {SILENCIO, CORCHEA}, {DO_5, CORCHEA}, {MI_5, CORCHEA}, {SILENCIO, CORCHEA},
-    {SOL_5, NEGRA}, {SILENCIO, NEGRA},
-    {SOL_4, NEGRA}, {SILENCIO, NEGRA},
-
-    // Sección principal
-    {DO_5, NEGRA}, {SILENCIO, CORCHEA}, {SOL_4, NEGRA}, {SILENCIO, CORCHEA},
-    {MI_4, NEGRA}, {SILENCIO, CORCHEA}, {LA_4, CORCHEA}, {SILENCIO, CORCHEA},
-    {SI_4, CORCHEA}, {SILENCIO, CORCHEA}, {LA_S4, CORCHEA}, {LA_4, CORCHEA},
-
-    {SOL_4, NEGRA}, {MI_5, NEGRA}, {SOL_5, NEGRA},
-    {LA_5, CORCHEA}, {SILENCIO, CORCHEA}, {FA_5, CORCHEA}, {SOL_5, CORCHEA},
-    {SILENCIO, CORCHEA}, {MI_5, CORCHEA}, {SILENCIO, CORCHEA}, {DO_5, CORCHEA},
-    {RE_5, CORCHEA}, {SI_4, CORCHEA}, {SILENCIO, NEGRA},
-
-    // Repetir variación
-    {DO_5, NEGRA}, {SILENCIO, CORCHEA}, {SOL_4, NEGRA}, {SILENCIO, CORCHEA},
-    {MI_4, NEGRA}, {SILENCIO, CORCHEA}, {LA_4, CORCHEA}, {SILENCIO, CORCHEA},
-    {SI_4, CORCHEA}, {SILENCIO, CORCHEA}, {LA_S4, CORCHEA}, {LA_4, CORCHEA},
-
-    {SOL_4, NEGRA}, {MI_5, NEGRA}, {SOL_5, NEGRA},
-    {LA_5, CORCHEA}, {SILENCIO, CORCHEA}, {FA_5, CORCHEA}, {SOL_5, CORCHEA},
-    {SILENCIO, CORCHEA}, {MI_5, CORCHEA}, {SILENCIO, CORCHEA}, {DO_5, CORCHEA},
-    {RE_5, CORCHEA}, {SI_4, CORCHEA}, {SILENCIO, NEGRA},
-
-    {SILENCIO, 0}
-};
+/* ============================ CLIPS PCM =================================== */
 
-/* ========================== VARIABLES INTERNAS ============================ */
+/*
+ * Un clip se reproduce enganchando una cadena de LLI (tramos de flash a
+ * DACR, sin interrupción) detrás de un bloque del anillo; el último tramo
+ * vuelve al otro bloque. Como los tramos no interrumpen, cada fin de
+ * bloque es un punto conocido de la secuencia (ver avanzar_clips()).
+ */
 
-static volatile uint8_t indice_tabla_onda = 0;
-static volatile uint16_t frecuencia_actual = 0;
-static volatile uint8_t reproduciendo = 0;
-static volatile uint32_t tiempo_transcurrido_ms = 0;
-static volatile uint8_t volumen_porcentaje = 100;
+/**
+ * @brief Arma los LLI de un clip en lli_clips[] a partir de lli_clips_usados
+ * @param retorno LLI del anillo al que vuelve el último tramo
+ * @param ultimo Devuelve el último tramo armado
+ * @return Primer tramo, o NULL si no hay descriptores libres
+ */
+static GPDMA_LLI_Type *armar_tramos(const ClipPCM *clip, uint32_t retorno, GPDMA_LLI_Type **ultimo) {
+    uint32_t tramos = TRAMOS_CLIP(clip);
+    if (lli_clips_usados + tramos > CLIP_LLI_MAXIMO) return NULL;
+
+    uint8_t ocho_bits = (clip->formato == CLIP_PCM_8);
+    uint32_t ancho = ocho_bits ? GPDMA_BYTE : GPDMA_HALFWORD;
+    /* 8 bits: el byte 1 de DACR son los bits 9..2 del valor. 10 bits: la
+       mitad baja de DACR trae el valor en 15..6 */
+    uint32_t destino = (uint32_t)(uintptr_t)&LPC_DAC->DACR + (ocho_bits ? 1 : 0);
+    uint32_t origen = (uint32_t)(uintptr_t)clip->muestras;
+    uint32_t restantes = clip->cantidad;
+    GPDMA_LLI_Type *primero = &lli_clips[lli_clips_usados];
+
+    for (uint32_t t = 0; t < tramos; t++) {
+        GPDMA_LLI_Type *lli = &lli_clips[lli_clips_usados++];
+        uint32_t muestras = (restantes > CLIP_MUESTRAS_TRAMO) ? CLIP_MUESTRAS_TRAMO : restantes;
+
+        lli->srcAddr = origen;
+        lli->dstAddr = destino;
+        lli->nextLLI = (t + 1 < tramos) ? (uint32_t)(uintptr_t)(lli + 1) : retorno;
+        lli->control = GPDMA_DMACCxControl_TransferSize(muestras) |
+                       GPDMA_DMACCxControl_SWidth(ancho) |
+                       GPDMA_DMACCxControl_DWidth(ancho) |
+                       GPDMA_DMACCxControl_SI;
+        origen += muestras << (ocho_bits ? 0 : 1);
+        restantes -= muestras;
+        *ultimo = lli;
+    }
+    return primero;
+}
 
-static const Nota *melodia_actual = NULL;
-static volatile uint16_t indice_nota_actual = 0;
-static volatile uint32_t tiempo_inicio_nota = 0;
-static volatile uint8_t modo_loop = 0;  // 1 = loop continuo, 0 = una sola vez
+/**
+ * @brief Con el anillo solo, engancha los clips de la cola detrás de "bloque"
+ *
+ * Se llama desde la ISR justo después de rellenar "bloque": el DMA está en
+ * el otro y todavía no cargó el LLI de este.
+ */
+static void enganchar_pendientes(uint8_t bloque) {
+    if (cantidad_pendientes == 0) return;
 
-// Sistema de prioridades para melodías
-static const Nota *melodia_fondo_guardada = NULL;  // Melodía de fondo pausada
-static volatile uint16_t indice_fondo_guardado = 0;
-static volatile uint32_t tiempo_fondo_guardado = 0;
+    uint32_t retorno = (uint32_t)(uintptr_t)&lli_melodias[bloque ^ 1];
+    GPDMA_LLI_Type *primero = NULL, *ultimo = NULL;
+    uint8_t enganchados = 0;
 
-/* Forward declaration for static function */
-static void melodias_dma_restart_transfer(void);
+    lli_clips_usados = 0;
+    while (enganchados < cantidad_pendientes) {
+        GPDMA_LLI_Type *fin_clip;
+        GPDMA_LLI_Type *inicio_clip = armar_tramos(clips_pendientes[enganchados], retorno, &fin_clip);
+        if (inicio_clip == NULL) break;     // No entra: va en la próxima cadena
+
+        if (ultimo == NULL) {
+            primero = inicio_clip;
+        } else {
+            ultimo->nextLLI = (uint32_t)(uintptr_t)inicio_clip;
+        }
+        ultimo = fin_clip;
+        enganchados++;
+    }
+
+    for (uint8_t i = enganchados; i < cantidad_pendientes; i++) {
+        clips_pendientes[i - enganchados] = clips_pendientes[i];
+    }
+    cantidad_pendientes -= enganchados;
+
+    cola_cadena = ultimo;
+    bloque_entrada = bloque;
+    lli_melodias[bloque].nextLLI = (uint32_t)(uintptr_t)primero;
+    estado_clip = CLIP_PROGRAMADO;
+}
+
+/**
+ * @brief Agrega un clip al final de la cadena que ya está armada
+ *
+ * Carrera con el DMA: si ya cargó el último tramo viejo, el enganche nuevo
+ * no se ve. DMACCLLI dice qué LLI va a cargar después; si apunta a un
+ * tramo de clip (o la cadena todavía no empezó), llegamos a tiempo.
+ * @return 0 si no hay lugar o si el DMA ya pasó (el clip espera en la cola)
+ */
+static uint8_t extender_cadena(const ClipPCM *clip) {
+    if (cola_cadena == NULL) return 0;  // Cadena cortada por melodias_clip_detener()
+
+    uint32_t retorno = (uint32_t)(uintptr_t)&lli_melodias[bloque_entrada ^ 1];
+    uint8_t usados_antes = lli_clips_usados;
+    GPDMA_LLI_Type *ultimo;
+    GPDMA_LLI_Type *primero = armar_tramos(clip, retorno, &ultimo);
+    if (primero == NULL) return 0;
+
+    cola_cadena->nextLLI = (uint32_t)(uintptr_t)primero;
+
+    uint32_t siguiente = LPC_GPDMACH1->DMACCLLI & ~0x3UL;
+    uint8_t a_tiempo =
+        (siguiente >= (uint32_t)(uintptr_t)&lli_clips[0] && siguiente < (uint32_t)(uintptr_t)&lli_clips[CLIP_LLI_MAXIMO]) ||
+        (estado_clip != CLIP_SONANDO && siguiente == (uint32_t)(uintptr_t)&lli_melodias[bloque_entrada]);
+
+    if (!a_tiempo) {
+        cola_cadena->nextLLI = retorno;     // Ya lo cargó: se deja como estaba
+        lli_clips_usados = usados_antes;
+        return 0;
+    }
+    cola_cadena = ultimo;
+    return 1;
+}
+
+/**
+ * @brief Avanza el estado de los clips; una vez por fin de bloque (ISR)
+ *
+ * Después de enganchar detrás de bloque_entrada, el primer fin de bloque
+ * es el del otro bloque (el DMA ya cargó bloque_entrada y se restaura el
+ * anillo), el segundo es el de bloque_entrada (el DMA entra a la cadena) y
+ * el tercero llega recién cuando la cadena terminó.
+ */
+static void avanzar_clips(uint8_t bloque) {
+    switch (estado_clip) {
+    case CLIP_PROGRAMADO:
+        lli_melodias[bloque_entrada].nextLLI = (uint32_t)(uintptr_t)&lli_melodias[bloque_entrada ^ 1];
+        estado_clip = CLIP_ARMADO;
+        break;
+
+    case CLIP_ARMADO:
+        estado_clip = CLIP_SONANDO;
+        clips_reproducidos++;
+        break;
+
+    case CLIP_SONANDO:
+        estado_clip = CLIP_LIBRE;
+        cola_cadena = NULL;
+        enganchar_pendientes(bloque);
+        break;
+
+    default:
+        enganchar_pendientes(bloque);
+        break;
+    }
+}
 
 /**
  * @brief Callback de DMA para Melodías - llamado desde dma_handlers.c
- * 
- * Se dispara cuando una transferencia DMA completa (terminal count).
- * Reinicia la transferencia para la siguiente muestra.
+ *
+ * Se dispara al terminar cada bloque; el DMA ya pasó al otro buffer (o a
+ * una cadena de clips) por el LLI, así que se rellena el que quedó libre.
  */
 void melodias_dma_on_transfer_complete(void) {
-    if (reproduciendo && frecuencia_actual > 0) {
-        dma_melodias_index = (dma_melodias_index + 1) % NUMERO_MUESTRAS;
-        melodias_dma_restart_transfer();
+    /* Si el DMA ya está leyendo el bloque que toca rellenar, la ISR llegó
+       tarde (se repitió un bloque viejo): se cuenta y se sigue */
+    uint32_t leyendo = LPC_GPDMACH1->DMACCSrcAddr;
+    uint32_t libre = (uint32_t)(uintptr_t)&buffer_audio[bloque_libre][0];
+    if (leyendo >= libre && leyendo < libre + sizeof(buffer_audio[0])) {
+        bloques_tarde++;
     }
+
+    renderizar_bloque(buffer_audio[bloque_libre]);
+    avanzar_clips(bloque_libre);
+    bloque_libre ^= 1;
 }
 
 /**
@@ -160,144 +368,217 @@ void melodias_dma_on_transfer_complete(void) {
 static void melodias_dma_init(void) {
     GPDMA_Init();
     NVIC_EnableIRQ(DMA_IRQn);
-    NVIC_SetPriority(DMA_IRQn, 1);
+    NVIC_SetPriority(DMA_IRQn, PRIORIDAD_IRQ_DMA);
 }
 
 /**
- * @brief Configura y lanza la primera transferencia DMA para DAC
+ * @brief Arma el canal DMA con dos LLI enlazados en anillo (ping-pong)
+ *
+ * Cada pedido del DAC (vencimiento de DACCNTVAL) copia una palabra del
+ * buffer activo a DACR. El canal no se detiene nunca: sin voces activas
+ * se renderiza el punto medio.
  */
 static void melodias_dma_start_transfer(void) {
     GPDMA_Channel_CFG_Type dma_cfg;
-    
+
+    renderizar_bloque(buffer_audio[0]);
+    renderizar_bloque(buffer_audio[1]);
+    bloque_libre = 0;
+
+    for (uint8_t i = 0; i < 2; i++) {
+        lli_melodias[i].srcAddr = (uint32_t)(uintptr_t)&buffer_audio[i][0];
+        lli_melodias[i].dstAddr = (uint32_t)(uintptr_t)&LPC_DAC->DACR;
+        lli_melodias[i].nextLLI = (uint32_t)(uintptr_t)&lli_melodias[i ^ 1];
+        lli_melodias[i].control = CONTROL_LLI_MELODIAS;
+    }
+
     dma_cfg.channelNum = MELODIAS_DMA_CH;
-    dma_cfg.transferSize = 1;                              // 1 muestra por transferencia
-    dma_cfg.transferWidth = GPDMA_HALFWORD;                // 16 bits (uint16_t)
-    dma_cfg.srcMemAddr = (uint32_t)&TABLA_TRIANGULAR[0];  // Fuente: tabla en RAM
+    dma_cfg.transferSize = MUESTRAS_BLOQUE;                // Un bloque por LLI
+    dma_cfg.transferWidth = GPDMA_WORD;                    // DACR es de 32 bits
+    dma_cfg.srcMemAddr = (uint32_t)(uintptr_t)&buffer_audio[0][0];  // Fuente: primer bloque
     dma_cfg.dstMemAddr = 0;                                // No aplica (destino es DAC)
     dma_cfg.transferType = GPDMA_M2P;                      // Memoria a Periférico
     dma_cfg.srcConn = 0;                                   // No aplica
-    dma_cfg.dstConn = MELODIAS_CONEXION_DMA;             // GPDMA_DAC
-    dma_cfg.linkedList = 0;                                // Sin linked list
-    
+    dma_cfg.dstConn = MELODIAS_CONEXION_DMA;               // GPDMA_DAC
+    dma_cfg.linkedList = (uint32_t)(uintptr_t)&lli_melodias[1];  // Después del bloque 0 viene el 1
+
     GPDMA_Setup(&dma_cfg);
+    /* El primer bloque usa el mismo control que los LLI: GPDMA_Setup toma
+       el ancho del DAC de la tabla de periféricos (byte) */
+    LPC_GPDMACH1->DMACCControl = CONTROL_LLI_MELODIAS;
     GPDMA_ChannelCmd(MELODIAS_DMA_CH, ENABLE);
-    
-    dma_melodias_enabled = 1;
+}
+
+/* ==================== FUNCIONES PRIVADAS ================================== */
+
+static uint8_t indice_voz(const Voz *voz) {
+    return (uint8_t)(voz - voces);
 }
 
 /**
- * @brief Reinicia la transferencia DMA (llamada desde ISR DMA)
+ * @brief Entra a una sección que toca el mezclador o la cadena de clips
+ *
+ * La usan el main y la ISR de Timer1. Enmascarar solo DMA_IRQn no alcanza:
+ * Timer1 puede interrumpir al main y su NVIC_EnableIRQ() reabriría la
+ * sección a medias. Se guarda PRIMASK y se restaura tal cual estaba.
+ * @return Estado anterior de PRIMASK, para salir_seccion_audio()
  */
-static void melodias_dma_restart_transfer(void) {
-    GPDMA_ChannelCmd(MELODIAS_DMA_CH, DISABLE);
-    
-    GPDMA_Channel_CFG_Type dma_cfg;
-    
-    dma_cfg.channelNum = MELODIAS_DMA_CH;
-    dma_cfg.transferSize = 1;
-    dma_cfg.transferWidth = GPDMA_HALFWORD;
-    dma_cfg.srcMemAddr = (uint32_t)&TABLA_TRIANGULAR[dma_melodias_index];
-    dma_cfg.dstMemAddr = 0;
-    dma_cfg.transferType = GPDMA_M2P;
-    dma_cfg.srcConn = 0;
-    dma_cfg.dstConn = MELODIAS_CONEXION_DMA;
-    dma_cfg.linkedList = 0;
-    
-    GPDMA_Setup(&dma_cfg);
-    GPDMA_ChannelCmd(MELODIAS_DMA_CH, ENABLE);
+static inline uint32_t entrar_seccion_audio(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void salir_seccion_audio(uint32_t primask) {
+    __set_PRIMASK(primask);
 }
 
 /**
- * @brief ISR del Timer0 - Generación de audio con DMA
- * Match 0: Genera la forma de onda triangular punto por punto
+ * @brief Libera una voz y la silencia
  */
-void TIMER0_IRQHandler(void) {
-    if(TIM_GetIntStatus(LPC_TIM0, TIM_MR0_INT)) {
-        TIM_ClearIntPending(LPC_TIM0, TIM_MR0_INT);
+static void detener_voz(Voz *voz) {
+    voz->cancion = NULL;
+    voz->loop = 0;
+    mezclador_establecer_incremento(indice_voz(voz), 0);
+}
 
-        if (reproduciendo && frecuencia_actual > 0) {
-            uint16_t valor_dac = TABLA_TRIANGULAR[indice_tabla_onda];
+/**
+ * @brief Dispara una nota (o un silencio) y programa su liberación y la siguiente
+ *
+ * Los instantes salen de inicio_nota_ms, no del reloj actual: un disparo
+ * tardío no corre el resto de la canción. La liberación entra dentro de
+ * la duración de la nota, así que el tempo no se estira con la articulación.
+ */
+static void tocar_nota(Voz *voz, uint32_t incremento, uint32_t duracion_ms) {
+    uint16_t liberacion_ms = voz->envolvente->liberacion_ms;
+    uint32_t compuerta_ms = (duracion_ms > liberacion_ms) ? duracion_ms - liberacion_ms : duracion_ms / 2;
+
+    voz->liberacion_ms = voz->inicio_nota_ms + compuerta_ms;
+    voz->proximo_evento_ms = voz->inicio_nota_ms + duracion_ms;
+    voz->liberada = (incremento == 0);
+
+    /* El mezclador no debe ver una nota a medio cargar */
+    uint32_t primask = entrar_seccion_audio();
+    if (incremento == 0) {
+        mezclador_liberar(indice_voz(voz));
+    } else {
+        mezclador_establecer_forma(indice_voz(voz), formas_onda[voz->forma][banda_forma(incremento)]);
+        mezclador_disparar(indice_voz(voz), incremento, voz->envolvente);
+    }
+    salir_seccion_audio(primask);
+}
 
-            // Aplicar volumen
-            if (volumen_porcentaje < 100) {
-                valor_dac = (valor_dac * volumen_porcentaje) / 100;
-            }
+/**
+ * @brief Lee bytes hasta el próximo evento de nota y lo hace sonar
+ *
+ * Cada nota es una lectura de TABLA_EVENTOS; los bytes de control
+ * (envolvente, forma, marca, fin) no producen sonido y se consumen acá.
+ * @return 0 si la canción terminó y la voz quedó libre
+ */
+static uint8_t siguiente_nota(Voz *voz) {
+    uint8_t vueltas = 0;    // Un loop sin notas no debe colgar el secuenciador
 
-            DAC_UpdateValue(valor_dac);
+    for (;;) {
+        uint8_t codigo = *voz->cursor++;
 
-            indice_tabla_onda++;
-            if(indice_tabla_onda >= NUMERO_MUESTRAS) {
-                indice_tabla_onda = 0;
+        if (codigo < CANCION_EVENTOS) {
+            uint32_t evento = TABLA_EVENTOS[codigo];
+            uint32_t semicorcheas = evento >> EVENTO_BITS_INCREMENTO;
+
+            while ((*voz->cursor & 0xF0) == CANCION_LIGAR) {
+                semicorcheas += (*voz->cursor++ & 0x0F) + 1;
             }
-        } else {
-            DAC_UpdateValue(0);
+            tocar_nota(voz, evento & EVENTO_MASCARA_INCREMENTO, semicorcheas * voz->ms_semicorchea);
+            return 1;
         }
 
-        // LED indicador de actividad
-        static uint16_t led_counter = 0;
-        led_counter++;
-        if(led_counter >= LED_ALTERNAR_INTERRUPCIONES) {
-            led_counter = 0;
-            if(GPIO_ReadValue(PORT_CERO) & PIN_22) {
-                GPIO_ClearPins(PORT_CERO, PIN_22);
-            } else {
-                GPIO_SetPins(PORT_CERO, PIN_22);
-            }
+        if ((codigo & 0xF0) == CANCION_ENVOLVENTE && (codigo & 0x0F) < MELODIAS_ENVOLVENTES) {
+            voz->envolvente = &ENVOLVENTES[codigo & 0x0F];
+        } else if (codigo >= CANCION_FORMA && codigo < CANCION_FORMA + MELODIAS_FORMAS) {
+            voz->forma = (uint8_t)(codigo - CANCION_FORMA);
+        } else if (codigo == CANCION_MARCA_LOOP) {
+            voz->marca_loop = voz->cursor;
+        } else if (codigo == CANCION_FIN && voz->loop && vueltas++ == 0) {
+            voz->cursor = voz->marca_loop;
+        } else {
+            detener_voz(voz);   // Fin de la canción o código inválido
+            return 0;
         }
     }
 }
 
 /**
- * @brief ISR del Timer1 - Contador de tiempo (1ms)
+ * @brief Carga una canción en una voz desde el primer evento
  */
-void TIMER1_IRQHandler(void) {
-    if(TIM_GetIntStatus(LPC_TIM1, TIM_MR0_INT)) {
-        TIM_ClearIntPending(LPC_TIM1, TIM_MR0_INT);
-        tiempo_transcurrido_ms++;
-    }
+static void iniciar_voz(Voz *voz, const uint8_t *cancion, uint8_t loop) {
+    if (cancion[0] == 0) return;    // Tempo 0: no es una canción compilada
+
+    voz->cancion = cancion;
+    voz->cursor = cancion + CANCION_BYTES_CABECERA;
+    voz->marca_loop = voz->cursor;
+    voz->envolvente = &ENVOLVENTES[cancion[1] < MELODIAS_ENVOLVENTES ? cancion[1] : MELODIAS_ENV_LEGATO];
+    voz->forma = forma_inicial[indice_voz(voz)];
+    voz->ms_semicorchea = (uint16_t)(MS_SEMICORCHEA_X_TEMPO / cancion[0]);
+    voz->inicio_nota_ms = tiempo_transcurrido_ms;
+    voz->iniciada_en_ms = tiempo_transcurrido_ms;
+    voz->loop = loop;
+    siguiente_nota(voz);
 }
 
-/* ==================== FUNCIONES PRIVADAS ================================== */
-
 /**
- * @brief Configura la frecuencia de reproducción
+ * @brief Registra cuánto después de lo programado se disparó una nota
+ * @param atraso_ms Ticks enteros de atraso (0 si llegó en su tick)
  */
-static void set_frecuencia(uint16_t frecuencia_hz) {
-    if (frecuencia_hz == 0 || frecuencia_hz == SILENCIO) {
-        reproduciendo = 0;
-        DAC_UpdateValue(0);
-        frecuencia_actual = 0;
-        indice_tabla_onda = 0;
-        dma_melodias_index = 0;
-        return;
-    }
+static void registrar_jitter(uint32_t atraso_ms) {
+    uint32_t error_us = atraso_ms * US_POR_TICK + LPC_TIM1->TC;  // TC: µs desde el tick
 
-    if (frecuencia_hz < 50 || frecuencia_hz > 5000) {
-        return;
+    notas_secuenciadas++;
+    error_total_us += error_us;
+    if (error_us > error_maximo_us) {
+        error_maximo_us = error_us;
     }
+    if (atraso_ms > 0) {
+        notas_tarde++;
+    }
+}
 
-    uint32_t periodo_completo_us = MICROSEGUNDOS_POR_SEGUNDO / frecuencia_hz;
-    uint32_t tiempo_entre_muestras_us = periodo_completo_us / NUMERO_MUESTRAS;
+/**
+ * @brief Avanza el secuenciador de una voz: suelta la nota y pasa a la siguiente
+ *
+ * Se llama solo desde la ISR de Timer1.
+ */
+static void actualizar_voz(Voz *voz, uint32_t tiempo_actual) {
+    if (voz->cancion == NULL) return;
 
-    if (tiempo_entre_muestras_us < 5) {
-        tiempo_entre_muestras_us = 5;  // Reducido de 10 para más velocidad
+    if (!voz->liberada && (int32_t)(tiempo_actual - voz->liberacion_ms) >= 0) {
+        mezclador_liberar(indice_voz(voz));
+        voz->liberada = 1;
     }
 
-    TIM_Cmd(LPC_TIM0, DISABLE);
-    TIM_ResetCounter(LPC_TIM0);
-    TIM_UpdateMatchValue(LPC_TIM0, TIM_MATCH_CHANNEL_0, tiempo_entre_muestras_us);
-
-    indice_tabla_onda = 0;
-    dma_melodias_index = 0;
-    frecuencia_actual = frecuencia_hz;
-    reproduciendo = 1;
-    
-    /* Iniciar DMA si no está activo */
-    if (!dma_melodias_enabled) {
-        melodias_dma_start_transfer();
+    if ((int32_t)(tiempo_actual - voz->proximo_evento_ms) < 0) return;
+
+    registrar_jitter(tiempo_actual - voz->proximo_evento_ms);
+    voz->inicio_nota_ms = voz->proximo_evento_ms;
+    siguiente_nota(voz);
+}
+
+/**
+ * @brief ISR del Timer1 - Base de tiempo (1 ms) y secuenciador de notas
+ */
+void TIMER1_IRQHandler(void) {
+    PerfilMarca marca;
+    perfil_isr_entrar(&marca);
+
+    if(TIM_GetIntStatus(LPC_TIM1, TIM_MR0_INT)) {
+        TIM_ClearIntPending(LPC_TIM1, TIM_MR0_INT);
+        uint32_t tiempo_actual = ++tiempo_transcurrido_ms;
+
+        for (uint8_t v = 0; v < MELODIAS_VOCES; v++) {
+            actualizar_voz(&voces[v], tiempo_actual);
+        }
     }
 
-    TIM_Cmd(LPC_TIM0, ENABLE);
+    perfil_isr_salir(PERFIL_ISR_TIMER1, &marca);
 }
 
 /**
@@ -317,7 +598,11 @@ static void config_gpio(void) {
 }
 
 /**
- * @brief Configura DAC (P0.26)
+ * @brief Configura DAC (P0.26) con contador y pedidos de DMA
+ *
+ * Con doble buffer, cada vencimiento de DACCNTVAL pasa la muestra cargada
+ * a la salida y pide la siguiente al DMA. DACCNTVAL fija la frecuencia de
+ * muestreo (PCLK_DAC / MELODIAS_FRECUENCIA_MUESTREO_HZ) y no cambia más.
  */
 static void config_dac(void) {
     PINSEL_CFG_Type pin_cfg;
@@ -329,36 +614,27 @@ static void config_dac(void) {
     pin_cfg.openDrain = PINSEL_OD_NORMAL;
     PINSEL_ConfigPin(&pin_cfg);
 
+    DAC_CONVERTER_CFG_Type dac_ctrl;
+
     DAC_Init();
     DAC_SetBias(0);
-    DAC_UpdateValue(0);
+    DAC_UpdateValue(MEZCLADOR_MEDIO_DAC);
+
+    dac_ctrl.doubleBufferEnable = ENABLE;
+    dac_ctrl.counterEnable = ENABLE;
+    dac_ctrl.dmaEnable = ENABLE;
+    DAC_SetDMATimeOut(CLKPWR_GetPCLK(CLKPWR_PCLKSEL_DAC) / MELODIAS_FRECUENCIA_MUESTREO_HZ);
+    DAC_ConfigDAConverterControl(&dac_ctrl);
 }
 
 /**
- * @brief Configura Timer0 (audio) y Timer1 (tiempo)
+ * @brief Configura Timer1 (tiempo y secuenciador)
  */
 static void config_timer(void) {
     TIM_TIMERCFG_Type cfgtimer;
     TIM_MATCHCFG_Type cfgmatch;
 
-    // Timer0 - Audio
-    cfgtimer.prescaleOption = TIM_USVAL;
-    cfgtimer.prescaleValue = 1;
-    TIM_Init(LPC_TIM0, TIM_TIMER_MODE, &cfgtimer);
-
-    cfgmatch.matchChannel = 0;
-    cfgmatch.intOnMatch = ENABLE;
-    cfgmatch.resetOnMatch = ENABLE;
-    cfgmatch.stopOnMatch = DISABLE;
-    cfgmatch.extMatchOutputType = TIM_NOTHING;
-    cfgmatch.matchValue = 100;
-    TIM_ConfigMatch(LPC_TIM0, &cfgmatch);
-
-    NVIC_EnableIRQ(TIMER0_IRQn);
-    NVIC_SetPriority(TIMER0_IRQn, 1);
-    TIM_Cmd(LPC_TIM0, ENABLE);
-
-    // Timer1 - Tiempo (1ms)
+    // Timer1 - Tiempo (1ms), prescaler de 1 µs: TC sirve para medir el jitter
     cfgtimer.prescaleOption = TIM_USVAL;
     cfgtimer.prescaleValue = 1;
     TIM_Init(LPC_TIM1, TIM_TIMER_MODE, &cfgtimer);
@@ -372,7 +648,7 @@ static void config_timer(void) {
     TIM_ConfigMatch(LPC_TIM1, &cfgmatch);
 
     NVIC_EnableIRQ(TIMER1_IRQn);
-    NVIC_SetPriority(TIMER1_IRQn, 2);
+    NVIC_SetPriority(TIMER1_IRQn, PRIORIDAD_IRQ_SECUENCIADOR);
     TIM_Cmd(LPC_TIM1, ENABLE);
 }
 
@@ -382,106 +658,224 @@ void melodias_inicializar(void) {
     config_gpio();
     config_dac();
     config_timer();
+
+    mezclador_inicializar(formas_onda[MELODIAS_FORMA_TRIANGULAR][0]);
+    mezclador_establecer_volumen_maestro(volumen_porcentaje);
+    for (uint8_t v = 0; v < MELODIAS_VOCES; v++) {
+        detener_voz(&voces[v]);
+    }
+
+    /* Contador de ciclos para medir el costo de cada bloque */
+    PERFIL_HABILITAR_DWT();
+
     melodias_dma_init();  /* Inicializar DMA */
-    GPIO_SetPins(PORT_CERO, PIN_22);
+    melodias_dma_start_transfer();
+    GPIO_ClearPins(PORT_CERO, PIN_22);
 }
 
-void melodias_iniciar(const Nota *melodia) {
-    if (melodia == NULL) return;
-
-    // Si hay música de fondo en loop, guardarla para reanudarla después
-    if (modo_loop && melodia_actual != NULL) {
-        melodia_fondo_guardada = melodia_actual;
-        indice_fondo_guardado = indice_nota_actual;
-        tiempo_fondo_guardado = tiempo_inicio_nota;
-    }
+/* Las voces las recorre la ISR de Timer1: el main las toca con ella enmascarada */
 
-    melodia_actual = melodia;
-    indice_nota_actual = 0;
-    tiempo_inicio_nota = tiempo_transcurrido_ms;
-    modo_loop = 0;  // Modo normal (una sola reproducción)
-    set_frecuencia(melodia[0].frecuencia);
+void melodias_iniciar(const uint8_t *melodia) {
+    if (melodia == NULL) return;
+    NVIC_DisableIRQ(TIMER1_IRQn);
+    iniciar_voz(&voces[MELODIAS_VOZ_MUSICA], melodia, 0);  // Modo normal (una sola reproducción)
+    NVIC_EnableIRQ(TIMER1_IRQn);
 }
 
-void melodias_iniciar_loop(const Nota *melodia) {
+void melodias_iniciar_loop(const uint8_t *melodia) {
     if (melodia == NULL) return;
+    NVIC_DisableIRQ(TIMER1_IRQn);
+    iniciar_voz(&voces[MELODIAS_VOZ_MUSICA], melodia, 1);  // Modo loop (repetir al terminar)
+    NVIC_EnableIRQ(TIMER1_IRQn);
+}
 
-    // No guardar nada si iniciamos un loop nuevo
-    melodia_fondo_guardada = NULL;
+void melodias_efecto(const uint8_t *efecto) {
+    if (efecto == NULL) return;
 
-    melodia_actual = melodia;
-    indice_nota_actual = 0;
-    tiempo_inicio_nota = tiempo_transcurrido_ms;
-    modo_loop = 1;  // Modo loop (repetir al terminar)
-    set_frecuencia(melodia[0].frecuencia);
+    NVIC_DisableIRQ(TIMER1_IRQn);
+    // Una voz de efectos libre o, si no hay, la que empezó hace más tiempo
+    Voz *elegida = &voces[MELODIAS_VOZ_MUSICA + 1];
+    for (uint8_t v = MELODIAS_VOZ_MUSICA + 1; v < MELODIAS_VOCES; v++) {
+        if (voces[v].cancion == NULL) {
+            elegida = &voces[v];
+            break;
+        }
+        if (voces[v].iniciada_en_ms < elegida->iniciada_en_ms) {
+            elegida = &voces[v];
+        }
+    }
+    iniciar_voz(elegida, efecto, 0);
+    NVIC_EnableIRQ(TIMER1_IRQn);
 }
 
 void melodias_detener(void) {
-    melodia_actual = NULL;
-    melodia_fondo_guardada = NULL;
-    indice_nota_actual = 0;
-    modo_loop = 0;
-    set_frecuencia(0);
-    DAC_UpdateValue(0);
+    NVIC_DisableIRQ(TIMER1_IRQn);
+    for (uint8_t v = 0; v < MELODIAS_VOCES; v++) {
+        detener_voz(&voces[v]);
+    }
+    NVIC_EnableIRQ(TIMER1_IRQn);
+    GPIO_ClearPins(PORT_CERO, PIN_22);
 }
 
 void melodias_actualizar(void) {
-    if (melodia_actual == NULL) return;
+    uint8_t sonando = 0;
+
+    // Las notas avanzan en TIMER1_IRQHandler; acá solo queda el LED
+    for (uint8_t v = 0; v < MELODIAS_VOCES; v++) {
+        if (mezclador_voz_activa(v)) {
+            sonando = 1;
+        }
+    }
 
-    uint32_t tiempo_actual = tiempo_transcurrido_ms;
-    uint32_t duracion_nota = melodia_actual[indice_nota_actual].duracion;
-    uint32_t tiempo_transcurrido_nota = tiempo_actual - tiempo_inicio_nota;
+    // LED indicador: encendido mientras alguna voz tiene una nota o suena un clip
+    if (sonando || melodias_clip_sonando()) {
+        GPIO_SetPins(PORT_CERO, PIN_22);
+    } else {
+        GPIO_ClearPins(PORT_CERO, PIN_22);
+    }
+}
 
-    if (tiempo_transcurrido_nota >= duracion_nota) {
-        uint32_t tiempo_total_con_pausa = duracion_nota + PAUSA_ARTICULACION_MS;
+uint8_t melodias_esta_sonando(void) {
+    for (uint8_t v = 0; v < MELODIAS_VOCES; v++) {
+        if (voces[v].cancion != NULL) return 1;
+    }
+    return 0;
+}
 
-        if (tiempo_transcurrido_nota < tiempo_total_con_pausa) {
-            set_frecuencia(0);
-            return;
+uint32_t melodias_obtener_tiempo_ms(void) {
+    return tiempo_transcurrido_ms;
+}
+
+void melodias_establecer_volumen(uint8_t volumen) {
+    if (volumen > 100) volumen = 100;
+    volumen_porcentaje = volumen;
+
+    /* Reescala las tablas de las voces una sola vez; la ISR de DMA no debe
+       leer una tabla a medio reconstruir ni Timer1 disparar una nota encima */
+    uint32_t primask = entrar_seccion_audio();
+    mezclador_establecer_volumen_maestro(volumen);
+    salir_seccion_audio(primask);
+}
+
+void melodias_establecer_volumen_voz(uint8_t voz, uint8_t volumen) {
+    uint32_t primask = entrar_seccion_audio();
+    mezclador_establecer_volumen_voz(voz, volumen);
+    salir_seccion_audio(primask);
+}
+
+void melodias_establecer_forma_voz(uint8_t voz, uint8_t forma) {
+    if (voz >= MELODIAS_VOCES || forma >= MELODIAS_FORMAS) return;
+    forma_inicial[voz] = forma;
+}
+
+void melodias_obtener_estadisticas_mezcla(MelodiasEstadisticasMezcla *estadisticas) {
+    if (estadisticas == NULL) return;
+
+    estadisticas->bloques = bloques_mezclados;
+    estadisticas->ciclos_ultimo_bloque = ciclos_ultimo_bloque;
+    estadisticas->ciclos_peor_bloque = ciclos_peor_bloque;
+    estadisticas->ciclos_presupuesto = (uint32_t)(((uint64_t)SystemCoreClock * MUESTRAS_BLOQUE) /
+                                                  MELODIAS_FRECUENCIA_MUESTREO_HZ);
+    estadisticas->muestras_saturadas = mezclador_obtener_saturadas();
+    estadisticas->bloques_tarde = bloques_tarde;
+    estadisticas->voces_activas = 0;
+    for (uint8_t v = 0; v < MELODIAS_VOCES; v++) {
+        if (mezclador_voz_activa(v)) {
+            estadisticas->voces_activas++;
         }
+    }
+}
 
-        indice_nota_actual++;
-
-        // Verificar si llegamos al final de la melodía
-        if (melodia_actual[indice_nota_actual].frecuencia == SILENCIO &&
-            melodia_actual[indice_nota_actual].duracion == 0) {
-
-            // Si está en modo loop, reiniciar desde el principio
-            if (modo_loop) {
-                indice_nota_actual = 0;
-                set_frecuencia(melodia_actual[0].frecuencia);
-                tiempo_inicio_nota = tiempo_actual;
-            } else {
-                // Si hay música de fondo guardada, reanudarla
-                if (melodia_fondo_guardada != NULL) {
-                    melodia_actual = melodia_fondo_guardada;
-                    indice_nota_actual = indice_fondo_guardado;
-                    tiempo_inicio_nota = tiempo_actual - (tiempo_fondo_guardado - tiempo_actual);
-                    modo_loop = 1;  // Restaurar modo loop
-                    melodia_fondo_guardada = NULL;
-                    set_frecuencia(melodia_actual[indice_nota_actual].frecuencia);
-                } else {
-                    // Si no hay música guardada, detener
-                    melodias_detener();
-                }
-            }
-            return;
+void melodias_obtener_estadisticas_secuenciador(MelodiasEstadisticasSecuenciador *estadisticas) {
+    if (estadisticas == NULL) return;
+
+    NVIC_DisableIRQ(TIMER1_IRQn);
+    estadisticas->notas = notas_secuenciadas;
+    estadisticas->error_maximo_us = error_maximo_us;
+    estadisticas->error_promedio_us = notas_secuenciadas ?
+        (uint32_t)(error_total_us / notas_secuenciadas) : 0;
+    estadisticas->notas_tarde = notas_tarde;
+    NVIC_EnableIRQ(TIMER1_IRQn);
+}
+
+void melodias_reiniciar_estadisticas_secuenciador(void) {
+    NVIC_DisableIRQ(TIMER1_IRQn);
+    notas_secuenciadas = 0;
+    error_total_us = 0;
+    error_maximo_us = 0;
+    notas_tarde = 0;
+    NVIC_EnableIRQ(TIMER1_IRQn);
+}
+
+static uint8_t clip_valido(const ClipPCM *clip) {
+    return clip != NULL && clip->muestras != NULL && clip->cantidad > 0 &&
+           (clip->formato == CLIP_PCM_8 || clip->formato == CLIP_PCM_10) &&
+           TRAMOS_CLIP(clip) <= CLIP_LLI_MAXIMO;
+}
+
+uint8_t melodias_clip_encolar(const ClipPCM *clip) {
+    uint8_t aceptado = 1;
+
+    if (!clip_valido(clip)) {
+        clips_rechazados++;
+        return 0;
+    }
+
+    uint32_t primask = entrar_seccion_audio();
+    if (estado_clip != CLIP_LIBRE && cantidad_pendientes == 0 && extender_cadena(clip)) {
+        // Sigue al clip anterior sin pausa
+    } else if (cantidad_pendientes < CLIP_COLA) {
+        if (estado_clip != CLIP_LIBRE && cola_cadena != NULL && cantidad_pendientes == 0) {
+            clips_huecos++;     // Llegó tarde al último tramo: suena un bloque de música en el medio
         }
+        clips_pendientes[cantidad_pendientes++] = clip;
+    } else {
+        clips_rechazados++;
+        aceptado = 0;
+    }
+    salir_seccion_audio(primask);
+    return aceptado;
+}
 
-        set_frecuencia(melodia_actual[indice_nota_actual].frecuencia);
-        tiempo_inicio_nota = tiempo_actual;
+void melodias_clip_detener(void) {
+    uint32_t primask = entrar_seccion_audio();
+    cantidad_pendientes = 0;
+    if (estado_clip != CLIP_LIBRE) {
+        /* Cada tramo vuelve al anillo. El que el DMA ya cargó en DMACCLLI
+           no se puede redirigir (el PL080 no admite escribir los registros
+           del canal habilitado), así que suenan el tramo en curso y ese:
+           <= 100 ms. En CLIP_ARMADO el primer tramo ya está cargado y suena
+           entero */
+        uint32_t retorno = (uint32_t)(uintptr_t)&lli_melodias[bloque_entrada ^ 1];
+        for (uint8_t i = 0; i < lli_clips_usados; i++) {
+            lli_clips[i].nextLLI = retorno;
+        }
+        if (estado_clip == CLIP_PROGRAMADO) {
+            lli_melodias[bloque_entrada].nextLLI = retorno;
+        }
+        cola_cadena = NULL;
     }
+    salir_seccion_audio(primask);
 }
 
-uint8_t melodias_esta_sonando(void) {
-    return (melodia_actual != NULL);
+uint8_t melodias_clip_reproducir(const ClipPCM *clip) {
+    if (!clip_valido(clip)) {
+        clips_rechazados++;
+        return 0;
+    }
+    melodias_clip_detener();
+    return melodias_clip_encolar(clip);
 }
 
-uint32_t melodias_obtener_tiempo_ms(void) {
-    return tiempo_transcurrido_ms;
+uint8_t melodias_clip_sonando(void) {
+    return estado_clip != CLIP_LIBRE || cantidad_pendientes > 0;
 }
 
-void melodias_establecer_volumen(uint8_t volumen_porcentaje) {
-    if (volumen_porcentaje > 100) volumen_porcentaje = 100;
-    volumen_porcentaje = volumen_porcentaje;
+void melodias_obtener_estadisticas_clips(MelodiasEstadisticasClips *estadisticas) {
+    if (estadisticas == NULL) return;
+
+    estadisticas->reproducidos = clips_reproducidos;
+    estadisticas->huecos = clips_huecos;
+    estadisticas->rechazados = clips_rechazados;
+    estadisticas->en_cola = cantidad_pendientes;
 }
@@ -11,7 +11,7 @@
  */
 
 #include "menu_juegos.h"
-#include "lcd_i2c.h"
+#include "lcd_framebuffer.h"
 #include "joystick_adc.h"
 #include "bluetooth_uart.h"  // Comandos Bluetooth
 #include "LPC17xx.h"
@@ -37,30 +37,31 @@ static uint16_t last_ejeY = 2048;        // Último valor del eje Y (centro)
 
 /**
  * @brief Dibuja el menú en el LCD
+ *
+ * Arma la pantalla completa en el framebuffer; al navegar solo cambia la
+ * posición del puntero, así que el volcado envía apenas esas celdas.
  */
 static void dibujar_menu(void) {
-    lcd_borrarPantalla();
+    lcd_fb_limpiar();
     
     // Título en la primera línea
-    lcd_establecer_cursor(0, 0);
-    lcd_escribir("  SELECCIONA JUEGO");
+    lcd_fb_escribir(0, 0, "  SELECCIONA JUEGO");
     
     // Mostrar opciones con puntero ">"
     for (uint8_t i = 0; i < NUM_JUEGOS; i++) {
-        lcd_establecer_cursor(i + 1, 0);  // Opciones en líneas 1 y 2
-        
+        // Opciones en líneas 1 y 2
         if (i == opcion_actual) {
-            lcd_escribir("> ");  // Puntero en opción actual
+            lcd_fb_escribir(i + 1, 0, "> ");  // Puntero en opción actual
         } else {
-            lcd_escribir("  ");  // Sin puntero
+            lcd_fb_escribir(i + 1, 0, "  ");  // Sin puntero
         }
         
-        lcd_escribir(nombres_juegos[i]);
+        lcd_fb_escribir(i + 1, 2, nombres_juegos[i]);
     }
     
     // Instrucciones en la última línea
-    lcd_establecer_cursor(3, 0);
-    lcd_escribir("Arriba/Abajo/Boton");
+    lcd_fb_escribir(3, 0, "Arriba/Abajo/Boton");
+    lcd_fb_volcar();
 }
 
 /**
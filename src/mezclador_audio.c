@@ -0,0 +1,261 @@
+/**
+ * @file mezclador_audio.c
+ * @brief Implementación del mezclador de voces DDS (C puro, sin periféricos).
+ *
+ * Un bloque pasa por tres etapas:
+ * - Control: avanza la envolvente ADSR de cada voz activa y, si su forma
+ *   de onda cambió, reescala la tabla de esa voz.
+ * - Síntesis y mezcla: por cada voz activa,
+ *   mezcla[i] += (tabla_voz[fase >> 24] * nivel_q8) >> 8.
+ * - Salida: punto medio, saturación a 0..1023 y formato DACR.
+ *
+ * Los volúmenes están dentro de cada tabla_voz y solo cambian por pedido
+ * del main. La envolvente cambia todos los bloques durante ataque,
+ * decaimiento y liberación: va como un producto por muestra (un ciclo en
+ * el Cortex-M3) en lugar de 256 productos por bloque rehaciendo la tabla.
+ *
+ * @date Noviembre 2025
+ */
+
+#include "mezclador_audio.h"
+#include <stddef.h>
+
+/* === CONFIGURACIÓN INTERNA === */
+#define VOLUMEN_Q8_MAXIMO   256   // 100% en punto fijo Q8
+#define NIVEL_MAXIMO        65536 // 100% de la envolvente en Q16
+#define US_POR_BLOQUE       ((MELODIAS_MUESTRAS_BLOQUE * 1000000UL) / MELODIAS_FRECUENCIA_MUESTREO_HZ)
+#define ESCALA_FORMA        1031  // ±127 -> ±511.5 en Q8: una voz plena cubre 0..1023
+
+/* === ETAPAS DE LA ENVOLVENTE === */
+typedef enum {
+    ETAPA_ATAQUE = 0,
+    ETAPA_DECAIMIENTO,
+    ETAPA_SOSTENIDO,
+    ETAPA_LIBERACION
+} EtapaEnvolvente;
+
+/* === ESTRUCTURAS === */
+typedef struct {
+    volatile uint32_t fase;               // Solo la escribe mezclador_renderizar()
+    volatile uint32_t incremento;         // 0 = silencio
+    uint16_t volumen_q8;                  // Volumen propio de la voz
+    uint8_t muda;                         // Volumen 0: no se lee la tabla
+    uint8_t forma_nueva;                  // Rehacer la tabla en el próximo bloque
+    const int8_t *forma;                  // 256 muestras en flash, ±127
+    uint8_t etapa;                        // EtapaEnvolvente
+    uint32_t nivel;                       // Envolvente en Q16 (0..NIVEL_MAXIMO)
+    uint16_t nivel_q8;                    // Ganancia de la envolvente en este bloque
+    uint32_t nivel_sostenido;
+    uint32_t paso_ataque;                 // Cambios de nivel por bloque
+    uint32_t paso_decaimiento;
+    uint32_t paso_liberacion;
+    int16_t tabla[MEZCLADOR_TAMANO_TABLA]; // Forma x volumen_voz x volumen_maestro (sin envolvente)
+} VozMezclador;
+
+/* === ESTADO === */
+static VozMezclador voces_mezclador[MELODIAS_VOCES];
+static uint16_t volumen_maestro_q8 = VOLUMEN_Q8_MAXIMO;
+static volatile uint32_t saturadas = 0;
+
+/* === FUNCIONES PRIVADAS === */
+
+static uint16_t porcentaje_a_q8(uint8_t volumen_porcentaje) {
+    if (volumen_porcentaje > 100) volumen_porcentaje = 100;
+    return (uint16_t)((volumen_porcentaje * VOLUMEN_Q8_MAXIMO + 50) / 100);  // Redondeado
+}
+
+/**
+ * @brief Etapa de control: reescala la tabla de una voz con sus volúmenes.
+ *
+ * 256 multiplicaciones por cambio de volumen o de forma, nunca por bloque.
+ */
+static void reconstruir_tabla(VozMezclador *voz) {
+    int32_t ganancia = ((int32_t)voz->volumen_q8 * volumen_maestro_q8) >> 8;
+
+    voz->muda = (ganancia == 0);
+    voz->forma_nueva = 0;
+    for (uint16_t i = 0; i < MEZCLADOR_TAMANO_TABLA; i++) {
+        voz->tabla[i] = (int16_t)((voz->forma[i] * ganancia * ESCALA_FORMA) >> 16);
+    }
+}
+
+/**
+ * @brief Paso por bloque para recorrer todo el rango en tiempo_ms.
+ */
+static uint32_t paso_por_bloque(uint16_t tiempo_ms) {
+    uint32_t bloques = ((uint32_t)tiempo_ms * 1000) / US_POR_BLOQUE;
+    if (bloques == 0) bloques = 1;
+    return (NIVEL_MAXIMO + bloques - 1) / bloques;   // Llega al extremo en "bloques" pasos
+}
+
+/**
+ * @brief Etapa de control: un paso de la envolvente de una voz activa.
+ */
+static void avanzar_envolvente(VozMezclador *voz) {
+    switch (voz->etapa) {
+    case ETAPA_ATAQUE:
+        voz->nivel += voz->paso_ataque;
+        if (voz->nivel >= NIVEL_MAXIMO) {
+            voz->nivel = NIVEL_MAXIMO;
+            voz->etapa = ETAPA_DECAIMIENTO;
+        }
+        break;
+
+    case ETAPA_DECAIMIENTO:
+        if (voz->nivel > voz->nivel_sostenido + voz->paso_decaimiento) {
+            voz->nivel -= voz->paso_decaimiento;
+        } else {
+            voz->nivel = voz->nivel_sostenido;
+            voz->etapa = ETAPA_SOSTENIDO;
+        }
+        break;
+
+    case ETAPA_LIBERACION:
+        if (voz->nivel > voz->paso_liberacion) {
+            voz->nivel -= voz->paso_liberacion;
+        } else {
+            voz->nivel = 0;
+            voz->incremento = 0;    // Fin de la cola: la voz queda libre
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    voz->nivel_q8 = (uint16_t)(voz->nivel >> 8);
+    if (voz->forma_nueva) {
+        reconstruir_tabla(voz);
+    }
+}
+
+/* === FUNCIONES PÚBLICAS === */
+
+void mezclador_inicializar(const int8_t *forma) {
+    volumen_maestro_q8 = VOLUMEN_Q8_MAXIMO;
+    for (uint8_t v = 0; v < MELODIAS_VOCES; v++) {
+        voces_mezclador[v].fase = 0;
+        voces_mezclador[v].incremento = 0;
+        voces_mezclador[v].volumen_q8 = VOLUMEN_Q8_MAXIMO;
+        voces_mezclador[v].etapa = ETAPA_SOSTENIDO;
+        voces_mezclador[v].nivel = NIVEL_MAXIMO;
+        voces_mezclador[v].nivel_q8 = VOLUMEN_Q8_MAXIMO;
+        voces_mezclador[v].nivel_sostenido = NIVEL_MAXIMO;
+        voces_mezclador[v].forma = forma;
+        reconstruir_tabla(&voces_mezclador[v]);
+    }
+    saturadas = 0;
+}
+
+uint32_t mezclador_incremento_fase(uint16_t frecuencia_hz) {
+    return (uint32_t)((((uint64_t)frecuencia_hz << 32) + MELODIAS_FRECUENCIA_MUESTREO_HZ / 2) /
+                      MELODIAS_FRECUENCIA_MUESTREO_HZ);
+}
+
+void mezclador_establecer_incremento(uint8_t voz, uint32_t incremento) {
+    if (voz >= MELODIAS_VOCES) return;
+    voces_mezclador[voz].incremento = incremento;
+}
+
+void mezclador_establecer_forma(uint8_t voz, const int8_t *forma) {
+    if (voz >= MELODIAS_VOCES || forma == NULL) return;
+    if (voces_mezclador[voz].forma != forma) {
+        voces_mezclador[voz].forma = forma;
+        voces_mezclador[voz].forma_nueva = 1;
+    }
+}
+
+void mezclador_disparar(uint8_t voz, uint32_t incremento, const EnvolventeADSR *envolvente) {
+    if (voz >= MELODIAS_VOCES || envolvente == NULL) return;
+    VozMezclador *v = &voces_mezclador[voz];
+
+    uint8_t sostenido = envolvente->sostenido_porcentaje;
+    if (sostenido > 100) sostenido = 100;
+
+    if (v->incremento == 0) {
+        v->nivel = 0;               // Desde silencio: ataque completo
+    }
+    v->nivel_sostenido = ((uint32_t)sostenido * NIVEL_MAXIMO) / 100;
+    v->paso_ataque = paso_por_bloque(envolvente->ataque_ms);
+    v->paso_decaimiento = paso_por_bloque(envolvente->decaimiento_ms);
+    v->paso_liberacion = paso_por_bloque(envolvente->liberacion_ms);
+    v->etapa = ETAPA_ATAQUE;
+    v->incremento = incremento;
+}
+
+void mezclador_liberar(uint8_t voz) {
+    if (voz >= MELODIAS_VOCES) return;
+    if (voces_mezclador[voz].incremento != 0) {
+        voces_mezclador[voz].etapa = ETAPA_LIBERACION;
+    }
+}
+
+uint8_t mezclador_voz_activa(uint8_t voz) {
+    if (voz >= MELODIAS_VOCES) return 0;
+    return voces_mezclador[voz].incremento != 0;
+}
+
+void mezclador_establecer_volumen_voz(uint8_t voz, uint8_t volumen_porcentaje) {
+    if (voz >= MELODIAS_VOCES) return;
+    voces_mezclador[voz].volumen_q8 = porcentaje_a_q8(volumen_porcentaje);
+    reconstruir_tabla(&voces_mezclador[voz]);
+}
+
+void mezclador_establecer_volumen_maestro(uint8_t volumen_porcentaje) {
+    volumen_maestro_q8 = porcentaje_a_q8(volumen_porcentaje);
+    for (uint8_t v = 0; v < MELODIAS_VOCES; v++) {
+        reconstruir_tabla(&voces_mezclador[v]);
+    }
+}
+
+void mezclador_renderizar(uint32_t *destino) {
+    int32_t mezcla[MELODIAS_MUESTRAS_BLOQUE] = {0};
+
+    for (uint8_t v = 0; v < MELODIAS_VOCES; v++) {
+        VozMezclador *voz = &voces_mezclador[v];
+        uint32_t incremento = voz->incremento;
+        uint32_t fase = voz->fase;
+
+        if (incremento == 0) {
+            voz->fase = 0;  // La próxima nota arranca desde cero, sin salto
+            continue;
+        }
+
+        avanzar_envolvente(voz);
+        incremento = voz->incremento;   // La liberación pudo terminar recién
+        if (incremento == 0) {
+            voz->fase = 0;
+            continue;
+        }
+        if (voz->muda || voz->nivel_q8 == 0) {
+            // Solo avanza la fase para no cortar la onda al volver
+            voz->fase = fase + incremento * MELODIAS_MUESTRAS_BLOQUE;
+            continue;
+        }
+
+        const int16_t *tabla = voz->tabla;
+        int32_t nivel_q8 = voz->nivel_q8;
+        for (uint8_t i = 0; i < MELODIAS_MUESTRAS_BLOQUE; i++) {
+            mezcla[i] += (tabla[fase >> (32 - MEZCLADOR_BITS_TABLA)] * nivel_q8) >> 8;
+            fase += incremento;
+        }
+        voz->fase = fase;
+    }
+
+    // Etapa de salida: punto medio, saturación y formato DACR
+    for (uint8_t i = 0; i < MELODIAS_MUESTRAS_BLOQUE; i++) {
+        int32_t muestra = MEZCLADOR_MEDIO_DAC + mezcla[i];
+        if (muestra < 0) {
+            muestra = 0;
+            saturadas++;
+        } else if (muestra > MEZCLADOR_MAXIMO_DAC) {
+            muestra = MEZCLADOR_MAXIMO_DAC;
+            saturadas++;
+        }
+        destino[i] = MEZCLADOR_VALOR_DACR(muestra);
+    }
+}
+
+uint32_t mezclador_obtener_saturadas(void) {
+    return saturadas;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file perfil_isr.c
+ * @brief Contabilidad de ciclos por interrupción (DWT).
+ *
+ * Para descontar el anidamiento se lleva un único acumulador con los
+ * ciclos exclusivos de todas las ISR terminadas. Una ISR anota su valor al
+ * entrar; al salir, lo que creció mientras tanto es el tiempo de las ISR
+ * que la interrumpieron y se resta de su duración. Las dos lecturas y la
+ * suma final se hacen con las interrupciones deshabilitadas (unos pocos
+ * ciclos) para que no se metan en el medio.
+ *
+ * @date Noviembre 2025
+ */
+
+#include "perfil_isr.h"
+#include "planificador.h"
+#include "LPC17xx.h"
+#include <stddef.h>
+
+/* === CONFIGURACIÓN INTERNA === */
+#define LARGO_LINEA      64
+
+/* === ESTADO === */
+static PerfilIsrEstadisticas perfiles[PERFIL_ISR_CANTIDAD];
+static volatile uint32_t ciclos_en_isr = 0;     // Exclusivos de todas las ISR terminadas
+static uint32_t ventana_inicio_ms = 0;
+
+static const char *const nombres[PERFIL_ISR_CANTIDAD] = {
+    "GPDMA", "TIMER1", "SYSTICK", "I2C0", "UART0"
+};
+
+/* === FUNCIONES PRIVADAS === */
+
+/**
+ * @brief Agrega un número alineado a la derecha en "ancho" columnas.
+ * @return Puntero al final de lo escrito
+ */
+static char *agregar_numero(char *p, uint32_t valor, uint8_t ancho) {
+    char cifras[10];
+    uint8_t n = 0;
+
+    do {
+        cifras[n++] = (char)('0' + valor % 10);
+        valor /= 10;
+    } while (valor > 0);
+
+    while (ancho > n) {
+        *p++ = ' ';
+        ancho--;
+    }
+    while (n > 0) {
+        *p++ = cifras[--n];
+    }
+    return p;
+}
+
+static char *agregar_texto(char *p, const char *texto, uint8_t ancho) {
+    while (*texto) {
+        *p++ = *texto++;
+        if (ancho > 0) ancho--;
+    }
+    while (ancho-- > 0) {
+        *p++ = ' ';
+    }
+    return p;
+}
+
+/**
+ * @brief Carga en décimas de porcentaje ("12.3%")
+ */
+static char *agregar_carga(char *p, uint64_t ciclos, uint64_t ventana) {
+    uint32_t decimas = ventana ? (uint32_t)((ciclos * 1000 + ventana / 2) / ventana) : 0;
+
+    p = agregar_numero(p, decimas / 10, 4);
+    *p++ = '.';
+    *p++ = (char)('0' + decimas % 10);
+    *p++ = '%';
+    return p;
+}
+
+static char *terminar_linea(char *p) {
+    *p++ = '\r';
+    *p++ = '\n';
+    *p = '\0';
+    return p;
+}
+
+/* === FUNCIONES PÚBLICAS === */
+
+void perfil_isr_inicializar(void) {
+    PERFIL_HABILITAR_DWT();
+    perfil_isr_reiniciar();
+}
+
+void perfil_isr_entrar(PerfilMarca *marca) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    marca->anidados = ciclos_en_isr;
+    marca->inicio = PERFIL_DWT_CYCCNT;
+    __set_PRIMASK(primask);
+}
+
+void perfil_isr_salir(PerfilIsr isr, const PerfilMarca *marca) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t ciclos = (PERFIL_DWT_CYCCNT - marca->inicio) - (ciclos_en_isr - marca->anidados);
+    ciclos_en_isr += ciclos;
+
+    PerfilIsrEstadisticas *p = &perfiles[isr];
+    p->entradas++;
+    p->ciclos_total += ciclos;
+    if (ciclos > p->ciclos_peor) {
+        p->ciclos_peor = ciclos;
+    }
+    __set_PRIMASK(primask);
+}
+
+void perfil_isr_obtener(PerfilIsr isr, PerfilIsrEstadisticas *estadisticas) {
+    if (isr >= PERFIL_ISR_CANTIDAD || estadisticas == NULL) return;
+
+    __disable_irq();
+    *estadisticas = perfiles[isr];
+    __enable_irq();
+}
+
+void perfil_isr_reiniciar(void) {
+    __disable_irq();
+    for (uint8_t i = 0; i < PERFIL_ISR_CANTIDAD; i++) {
+        perfiles[i].entradas = 0;
+        perfiles[i].ciclos_total = 0;
+        perfiles[i].ciclos_peor = 0;
+    }
+    ventana_inicio_ms = planificador_obtener_ms();
+    __enable_irq();
+}
+
+void perfil_isr_volcar(void (*escribir)(const char *cadena)) {
+    char linea[LARGO_LINEA];
+    PerfilIsrEstadisticas e;
+    uint64_t audio = 0, total = 0;
+
+    if (escribir == NULL) return;
+
+    uint32_t ventana_ms = planificador_obtener_ms() - ventana_inicio_ms;
+    uint64_t ventana = (uint64_t)ventana_ms * (SystemCoreClock / 1000);
+
+    escribir("ISR      entradas    prom    peor   carga\r\n");
+    for (uint8_t i = 0; i < PERFIL_ISR_CANTIDAD; i++) {
+        perfil_isr_obtener((PerfilIsr)i, &e);
+
+        char *p = agregar_texto(linea, nombres[i], 8);
+        p = agregar_numero(p, e.entradas, 9);
+        p = agregar_numero(p, e.entradas ? (uint32_t)(e.ciclos_total / e.entradas) : 0, 8);
+        p = agregar_numero(p, e.ciclos_peor, 8);
+        p = agregar_carga(p, e.ciclos_total, ventana);
+        terminar_linea(p);
+        escribir(linea);
+
+        total += e.ciclos_total;
+        if (i == PERFIL_ISR_GPDMA || i == PERFIL_ISR_TIMER1) {
+            audio += e.ciclos_total;
+        }
+    }
+
+    char *p = agregar_texto(linea, "Audio ", 0);
+    p = agregar_carga(p, audio, ventana);
+    p = agregar_texto(p, "  Total ", 0);
+    p = agregar_carga(p, total, ventana);
+    p = agregar_texto(p, "  en ", 0);
+    p = agregar_numero(p, ventana_ms, 0);
+    p = agregar_texto(p, " ms", 0);
+    terminar_linea(p);
+    escribir(linea);
+
+    // Tareas del planificador: contadores desde que se (re)crearon
+    PlanificadorEstadisticas t;
+    escribir("Tarea periodo    ejec perdid  tarde peor ms\r\n");
+    for (uint8_t id = 0; planificador_obtener_estadisticas(id, &t); id++) {
+        p = agregar_numero(linea, id, 5);
+        p = agregar_numero(p, t.periodo_ms, 8);
+        p = agregar_numero(p, t.ejecuciones, 8);
+        p = agregar_numero(p, t.perdidas, 7);
+        p = agregar_numero(p, t.plazos_incumplidos, 7);
+        p = agregar_numero(p, t.peor_latencia_ms, 8);
+        if (!t.activa) {
+            p = agregar_texto(p, " (detenida)", 0);
+        }
+        terminar_linea(p);
+        escribir(linea);
+    }
+}
@@ -0,0 +1,144 @@
+/**
+ * @file planificador.c
+ * @brief Implementación del planificador de tareas periódicas sobre SysTick.
+ *
+ * La ISR de SysTick corre cada 1 ms, descuenta el tiempo restante de cada
+ * tarea activa y, cuando llega a cero, la marca como pendiente y guarda el
+ * instante de liberación. Nada de la lógica de los juegos corre dentro de
+ * la interrupción.
+ *
+ * @date Noviembre 2025
+ */
+
+#include "planificador.h"
+#include "perfil_isr.h"
+#include "LPC17xx.h"
+#include "lpc17xx_systick.h"
+#include <stddef.h>
+
+/* === CONFIGURACIÓN INTERNA === */
+#define PERIODO_TICK_MS        1
+#define PRIORIDAD_IRQ_SYSTICK  3     // Por debajo del audio (DMA y secuenciador en TIMER1)
+
+/* === ESTRUCTURAS === */
+typedef struct {
+    uint16_t periodo_ms;
+    uint16_t plazo_ms;
+    volatile uint16_t restante_ms;      // Tiempo hasta la próxima liberación
+    volatile uint8_t activa;
+    volatile uint8_t pendiente;         // Liberada y todavía no atendida
+    volatile uint32_t liberada_en_ms;   // Instante de la liberación pendiente
+    volatile uint32_t perdidas;
+    uint32_t ejecuciones;
+    uint32_t plazos_incumplidos;
+    uint16_t peor_latencia_ms;
+} Tarea;
+
+/* === ESTADO === */
+static Tarea tareas[PLANIFICADOR_MAX_TAREAS];
+static uint8_t cantidad_tareas = 0;
+static volatile uint32_t tiempo_ms = 0;
+
+/* === MANEJADOR DE INTERRUPCIÓN === */
+
+/**
+ * @brief Handler de SysTick: avanza el reloj y libera las tareas que vencen.
+ */
+void SysTick_Handler(void) {
+    PerfilMarca marca;
+    perfil_isr_entrar(&marca);
+
+    tiempo_ms++;
+
+    for (uint8_t i = 0; i < cantidad_tareas; i++) {
+        Tarea *t = &tareas[i];
+        if (!t->activa) continue;
+
+        if (--t->restante_ms == 0) {
+            t->restante_ms = t->periodo_ms;
+            if (t->pendiente) {
+                t->perdidas++;          // El main no llegó a atender la anterior
+            } else {
+                t->liberada_en_ms = tiempo_ms;
+                t->pendiente = 1;
+            }
+        }
+    }
+
+    perfil_isr_salir(PERFIL_ISR_SYSTICK, &marca);
+}
+
+/* === FUNCIONES PÚBLICAS === */
+
+void planificador_inicializar(void) {
+    SYSTICK_InternalInit(PERIODO_TICK_MS);
+    NVIC_SetPriority(SysTick_IRQn, PRIORIDAD_IRQ_SYSTICK);
+    SYSTICK_IntCmd(ENABLE);
+    SYSTICK_Cmd(ENABLE);
+}
+
+uint8_t planificador_crear_tarea(uint8_t *id, uint16_t periodo_ms, uint16_t plazo_ms) {
+    if (periodo_ms == 0) return 0;
+
+    if (*id == PLANIFICADOR_SIN_TAREA) {
+        if (cantidad_tareas >= PLANIFICADOR_MAX_TAREAS) return 0;
+        *id = cantidad_tareas;
+        tareas[*id].activa = 0;
+        cantidad_tareas++;  // La ISR la ve recién ahora, todavía inactiva
+    }
+
+    Tarea *t = &tareas[*id];
+    t->activa = 0;          // Que la ISR no la toque mientras se reconfigura
+    t->periodo_ms = periodo_ms;
+    t->plazo_ms = plazo_ms ? plazo_ms : periodo_ms;
+    t->restante_ms = periodo_ms;
+    t->pendiente = 0;
+    t->perdidas = 0;        // Con la tarea inactiva la ISR no los toca
+    t->ejecuciones = 0;
+    t->plazos_incumplidos = 0;
+    t->peor_latencia_ms = 0;
+    t->activa = 1;
+    return 1;
+}
+
+void planificador_detener_tarea(uint8_t id) {
+    if (id >= cantidad_tareas) return;
+    tareas[id].activa = 0;
+    tareas[id].pendiente = 0;
+}
+
+uint8_t planificador_tarea_lista(uint8_t id) {
+    if (id >= cantidad_tareas) return 0;
+
+    Tarea *t = &tareas[id];
+    if (!t->pendiente) return 0;
+
+    uint32_t latencia = tiempo_ms - t->liberada_en_ms;
+    t->pendiente = 0;
+
+    t->ejecuciones++;
+    if (latencia > t->peor_latencia_ms) {
+        t->peor_latencia_ms = (latencia > 0xFFFF) ? 0xFFFF : (uint16_t)latencia;
+    }
+    if (latencia > t->plazo_ms) {
+        t->plazos_incumplidos++;
+    }
+    return 1;
+}
+
+uint8_t planificador_obtener_estadisticas(uint8_t id, PlanificadorEstadisticas *estadisticas) {
+    if (id >= cantidad_tareas || estadisticas == NULL) return 0;
+
+    Tarea *t = &tareas[id];
+    estadisticas->ejecuciones = t->ejecuciones;
+    estadisticas->perdidas = t->perdidas;
+    estadisticas->plazos_incumplidos = t->plazos_incumplidos;
+    estadisticas->peor_latencia_ms = t->peor_latencia_ms;
+    estadisticas->periodo_ms = t->periodo_ms;
+    estadisticas->activa = t->activa;
+    return 1;
+}
+
+uint32_t planificador_obtener_ms(void) {
+    return tiempo_ms;
+}
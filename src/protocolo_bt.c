@@ -0,0 +1,178 @@
+/**
+ * @file protocolo_bt.c
+ * @brief Tramas binarias del enlace Bluetooth (C puro).
+ *
+ * El receptor guarda los bytes desde el último 0xA5 y analiza en cuanto
+ * alcanzan para decidir: un byte que no es 0xA5 al principio sale como
+ * suelto, una trama completa con CRC correcto sale entera, y cualquier
+ * otra cosa descarta solo el primer byte. Nunca hay más de una trama
+ * guardada (53 bytes), así que los corrimientos son baratos.
+ *
+ * @date Noviembre 2025
+ */
+
+#include "protocolo_bt.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === FUNCIONES PRIVADAS === */
+
+static void descartar(ProtocoloReceptor *receptor, uint8_t n) {
+    memmove(receptor->crudo, receptor->crudo + n, receptor->cantidad - n);
+    receptor->cantidad -= n;
+}
+
+/**
+ * @brief Consume lo guardado mientras se pueda decidir algo
+ *
+ * Al volver, lo que queda empieza con 0xA5 y es más corto que la trama
+ * que anuncia (o no queda nada).
+ */
+static void analizar(ProtocoloReceptor *receptor) {
+    while (receptor->cantidad > 0) {
+        if (receptor->crudo[0] != PROTOCOLO_SINCRONISMO) {
+            uint8_t byte = receptor->crudo[0];
+            descartar(receptor, 1);
+            receptor->sueltos++;
+            if (receptor->al_recibir_suelto != NULL) {
+                receptor->al_recibir_suelto(byte);
+            }
+            continue;
+        }
+
+        if (receptor->cantidad < PROTOCOLO_CABECERA) return;
+
+        uint8_t largo = receptor->crudo[3];
+        if (largo > PROTOCOLO_CARGA_MAXIMA) {
+            receptor->errores++;
+            descartar(receptor, 1);
+            continue;
+        }
+
+        uint8_t total = PROTOCOLO_CABECERA + largo + 1;
+        if (receptor->cantidad < total) return;
+
+        uint8_t crc = protocolo_crc8(0, &receptor->crudo[1], PROTOCOLO_CABECERA - 1 + largo);
+        if (crc != receptor->crudo[total - 1]) {
+            receptor->errores++;
+            descartar(receptor, 1);
+            continue;
+        }
+
+        ProtocoloTrama trama;
+        trama.tipo = receptor->crudo[1];
+        trama.secuencia = receptor->crudo[2];
+        trama.largo = largo;
+        memcpy(trama.carga, &receptor->crudo[PROTOCOLO_CABECERA], largo);
+        descartar(receptor, total);
+
+        receptor->tramas++;
+        receptor->al_recibir_trama(&trama);
+    }
+}
+
+static void escribir_u16(uint8_t *p, uint16_t valor) {
+    p[0] = (uint8_t)valor;
+    p[1] = (uint8_t)(valor >> 8);
+}
+
+static uint16_t leer_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/* === FUNCIONES PÚBLICAS === */
+
+uint8_t protocolo_crc8(uint8_t crc, const uint8_t *datos, uint32_t n) {
+    while (n--) {
+        crc ^= *datos++;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+void protocolo_inicializar(ProtocoloReceptor *receptor,
+                           void (*al_recibir_trama)(const ProtocoloTrama *trama),
+                           void (*al_recibir_suelto)(uint8_t byte)) {
+    memset(receptor, 0, sizeof(*receptor));
+    receptor->al_recibir_trama = al_recibir_trama;
+    receptor->al_recibir_suelto = al_recibir_suelto;
+}
+
+void protocolo_recibir(ProtocoloReceptor *receptor, uint8_t byte) {
+    receptor->crudo[receptor->cantidad++] = byte;
+    analizar(receptor);
+}
+
+void protocolo_vaciar(ProtocoloReceptor *receptor) {
+    while (receptor->cantidad > 0) {
+        receptor->errores++;
+        descartar(receptor, 1);
+        analizar(receptor);
+    }
+}
+
+uint8_t protocolo_armar_trama(uint8_t tipo, uint8_t secuencia,
+                              const uint8_t *carga, uint8_t largo, uint8_t *salida) {
+    if (largo > PROTOCOLO_CARGA_MAXIMA) return 0;
+
+    salida[0] = PROTOCOLO_SINCRONISMO;
+    salida[1] = tipo;
+    salida[2] = secuencia;
+    salida[3] = largo;
+    if (largo > 0) {
+        memcpy(&salida[PROTOCOLO_CABECERA], carga, largo);     // carga puede ser NULL sin largo
+    }
+    salida[PROTOCOLO_CABECERA + largo] = protocolo_crc8(0, &salida[1], PROTOCOLO_CABECERA - 1 + largo);
+    return PROTOCOLO_CABECERA + largo + 1;
+}
+
+uint8_t protocolo_codificar_eventos(const ProtocoloEvento *eventos, uint8_t n, uint8_t *carga) {
+    if (n > PROTOCOLO_EVENTOS_MAXIMO) return 0;
+
+    for (uint8_t i = 0; i < n; i++) {
+        escribir_u16(&carga[i * PROTOCOLO_BYTES_EVENTO], eventos[i].tiempo_ms);
+        carga[i * PROTOCOLO_BYTES_EVENTO + 2] = eventos[i].codigo;
+    }
+    return n * PROTOCOLO_BYTES_EVENTO;
+}
+
+uint8_t protocolo_decodificar_eventos(const uint8_t *carga, uint8_t largo, ProtocoloEvento *eventos) {
+    uint8_t n = largo / PROTOCOLO_BYTES_EVENTO;
+
+    for (uint8_t i = 0; i < n; i++) {
+        eventos[i].tiempo_ms = leer_u16(&carga[i * PROTOCOLO_BYTES_EVENTO]);
+        eventos[i].codigo = carga[i * PROTOCOLO_BYTES_EVENTO + 2];
+    }
+    return n;
+}
+
+void protocolo_codificar_telemetria(const ProtocoloTelemetria *telemetria, uint8_t *carga) {
+    escribir_u16(&carga[0], (uint16_t)telemetria->tiempo_ms);
+    escribir_u16(&carga[2], (uint16_t)(telemetria->tiempo_ms >> 16));
+    carga[4] = telemetria->ultima_secuencia;
+    carga[5] = telemetria->eventos_pendientes;
+    escribir_u16(&carga[6], telemetria->tramas_aceptadas);
+    escribir_u16(&carga[8], telemetria->errores_crc);
+    escribir_u16(&carga[10], telemetria->tramas_perdidas);
+    escribir_u16(&carga[12], telemetria->rx_descartados);
+    escribir_u16(&carga[14], telemetria->tx_descartados);
+    escribir_u16(&carga[16], telemetria->latencia_peor_ms);
+}
+
+uint8_t protocolo_decodificar_telemetria(const uint8_t *carga, uint8_t largo,
+                                         ProtocoloTelemetria *telemetria) {
+    if (largo != PROTOCOLO_BYTES_TELEMETRIA) return 0;
+
+    telemetria->tiempo_ms = leer_u16(&carga[0]) | ((uint32_t)leer_u16(&carga[2]) << 16);
+    telemetria->ultima_secuencia = carga[4];
+    telemetria->eventos_pendientes = carga[5];
+    telemetria->tramas_aceptadas = leer_u16(&carga[6]);
+    telemetria->errores_crc = leer_u16(&carga[8]);
+    telemetria->tramas_perdidas = leer_u16(&carga[10]);
+    telemetria->rx_descartados = leer_u16(&carga[12]);
+    telemetria->tx_descartados = leer_u16(&carga[14]);
+    telemetria->latencia_peor_ms = leer_u16(&carga[16]);
+    return 1;
+}
@@ -8,26 +8,48 @@
  * - Detección de colisiones
  * - Sistema de puntuación
  * - Pantalla de Game Over con opción de volver al menú
+ * - Mundo configurable más grande que el LCD, con una vista que sigue a
+ *   la cabeza
+ * - Medios bloques en CGRAM: dos filas lógicas por carácter (vista de 20x8)
+ * - Aviso en el borde de la vista cuando la comida queda fuera
+ * - Espectador remoto: cada paso viaja como un registro de espectador.h
  *
  * @date Noviembre 2025
  */
 
 #include "snake_game.h"
-#include "lcd_i2c.h"
+#include "lcd_framebuffer.h"
 #include "joystick_adc.h"
 #include "melodias_dac.h"
 #include "bluetooth_uart.h"  // Comandos Bluetooth
+#include "espectador.h"      // Pasos para el espectador remoto
+#include "planificador.h"     // Tick del juego (SysTick)
 #include "LPC17xx.h"
-#include "lpc17xx_timer.h"
 #include <string.h>
 #include <stdlib.h>
 
 /* === CONFIGURACIÓN DEL JUEGO === */
-#define COLUMNAS_LCD_SERPIENTE 20        // Ancho del LCD
+#define COLUMNAS_LCD_SERPIENTE 20        // Ancho del LCD (vista)
 #define FILAS_LCD_SERPIENTE 4         // Alto del LCD
-#define LONGITUD_MAXIMA_SERPIENTE 50      // Longitud máxima de la serpiente
+#define FILAS_VISTA_SERPIENTE (FILAS_LCD_SERPIENTE * 2)  // Dos filas lógicas por carácter
+#ifndef COLUMNAS_MUNDO_SERPIENTE
+#define COLUMNAS_MUNDO_SERPIENTE 64      // Ancho del mundo (>= 20, máx. 255)
+#endif
+#ifndef FILAS_MUNDO_SERPIENTE
+#define FILAS_MUNDO_SERPIENTE 32         // Alto del mundo (>= 4, máx. 255)
+#endif
+#define CELDAS_SERPIENTE (COLUMNAS_MUNDO_SERPIENTE * FILAS_MUNDO_SERPIENTE)
+#define LONGITUD_MAXIMA_SERPIENTE CELDAS_SERPIENTE  // Puede llenar el mundo
 #define TICK_MS_SERPIENTE 50         // Período de tick (50ms)
 #define TICKS_VELOCIDAD_SERPIENTE 10      // Ticks entre movimientos (500ms inicial - más lento)
+#define POSICION_INVALIDA 0xFF            // Comida fuera del tablero (tablero lleno)
+#define PALABRAS_FILA_SERPIENTE ((COLUMNAS_MUNDO_SERPIENTE + 31) / 32)
+#define MARGEN_VISTA_X 3                  // Columnas de aviso antes del borde de la vista
+#define MARGEN_VISTA_Y 1                  // Filas lógicas de aviso
+
+#if COLUMNAS_MUNDO_SERPIENTE < COLUMNAS_LCD_SERPIENTE || FILAS_MUNDO_SERPIENTE < FILAS_VISTA_SERPIENTE
+#error "El mundo de la serpiente no puede ser más chico que el LCD"
+#endif
 
 /* === ESTRUCTURAS === */
 typedef struct {
@@ -43,8 +65,12 @@ typedef enum {
 } Direccion;
 
 /* === VARIABLES DE ESTADO === */
+// Cuerpo como cola circular: snake[indice_cabeza] es la cabeza y los
+// segmentos siguen hacia adelante en el arreglo (con vuelta al inicio).
+// Mover es O(1): se agrega una cabeza y, si no crece, se suelta la cola.
 static Posicion snake[LONGITUD_MAXIMA_SERPIENTE];  // Cuerpo de la serpiente
-static uint8_t snake_length = 3;          // Longitud actual
+static uint16_t indice_cabeza = 0;        // Posición de la cabeza en snake[]
+static uint16_t snake_length = 3;         // Longitud actual
 static Direccion direccion_actual = DIR_DERECHA;
 static Direccion direccion_siguiente = DIR_DERECHA;
 static Posicion comida;                   // Posición de la comida
@@ -52,10 +78,30 @@ static uint32_t score = 0;                // Puntuación
 static uint8_t game_over = 0;             // 1 = juego terminado
 static uint8_t game_started = 0;          // 1 = juego iniciado
 static uint8_t paused = 0;                // 1 = juego pausado
-static volatile uint8_t tick_flag = 0;    // Flag de tick del timer
+static uint8_t tarea_tick = PLANIFICADOR_SIN_TAREA;  // Tick de 50ms del planificador
 static uint8_t move_counter = 0;          // Contador para velocidad
 static uint8_t speed_ticks = TICKS_VELOCIDAD_SERPIENTE;
-static uint8_t buffer_lcd[FILAS_LCD_SERPIENTE][COLUMNAS_LCD_SERPIENTE + 1]; // Buffer para LCD
+
+// Mapa de ocupación del mundo: bit (x % 32) de ocupacion[y][x / 32] = celda
+// con un segmento. Se mantiene al agregar la cabeza y al soltar la cola, así
+// las colisiones, la búsqueda de celdas libres y el dibujo de la vista no
+// recorren el cuerpo.
+static uint32_t ocupacion[FILAS_MUNDO_SERPIENTE][PALABRAS_FILA_SERPIENTE];
+
+// Esquina superior izquierda de la vista (20x8 lógica) dentro del mundo
+static uint8_t vista_x = 0;
+static uint8_t vista_y = 0;
+static uint8_t vista_movida = 0;          // La vista saltó: redibujar completa
+
+// Celdas que cambió el último movimiento (para el dibujo incremental)
+static Posicion cabeza_anterior;          // Pasa de 'O' a 'o'
+static Posicion cola_soltada;             // Pasa a ' ' (si se soltó)
+static uint8_t hubo_cola_soltada = 0;
+static uint8_t comida_movida = 0;         // Hay que dibujar el '*' nuevo
+
+static uint8_t redibujar_completo = 0;    // "PAUSA" tapó el tablero: el próximo paso redibuja todo
+static uint8_t foto_pendiente = 0;        // El espectador espera el estado completo
+static EspectadorPaso paso_espectador;    // Lo que cambió en mover_serpiente()
 
 /* === FUNCIONES AUXILIARES === */
 
@@ -63,40 +109,358 @@ static uint8_t buffer_lcd[FILAS_LCD_SERPIENTE][COLUMNAS_LCD_SERPIENTE + 1]; // B
  * @brief Generador pseudo-aleatorio simple
  */
 static uint16_t prng_seed = 0xACE1u;
-static uint8_t rand_range(uint8_t min, uint8_t max) {
+static uint16_t rand_range(uint16_t min, uint16_t max) {
     prng_seed = (prng_seed >> 1) ^ (-(prng_seed & 1u) & 0xB400u);
     return min + (prng_seed % (max - min + 1));
 }
 
+/* === CUERPO (COLA CIRCULAR) === */
+
+/**
+ * @brief Devuelve el segmento i contando desde la cabeza (0 = cabeza).
+ */
+static inline Posicion segmento(uint16_t i) {
+    uint32_t indice = (uint32_t)indice_cabeza + i;
+    if (indice >= LONGITUD_MAXIMA_SERPIENTE) indice -= LONGITUD_MAXIMA_SERPIENTE;
+    return snake[indice];
+}
+
+/**
+ * @brief Agrega una cabeza nueva delante de la actual.
+ */
+static inline void agregar_cabeza(Posicion p) {
+    indice_cabeza = (indice_cabeza == 0) ? LONGITUD_MAXIMA_SERPIENTE - 1 : indice_cabeza - 1;
+    snake[indice_cabeza] = p;
+}
+
+/* === MAPA DE OCUPACIÓN === */
+
+static inline uint8_t celda_ocupada(Posicion p) {
+    return (ocupacion[p.y][p.x >> 5] >> (p.x & 31)) & 1u;
+}
+
+static inline void ocupar_celda(Posicion p) {
+    ocupacion[p.y][p.x >> 5] |= (1u << (p.x & 31));
+}
+
+static inline void liberar_celda(Posicion p) {
+    ocupacion[p.y][p.x >> 5] &= ~(1u << (p.x & 31));
+}
+
+/**
+ * @brief Celdas válidas de la palabra w de una fila (la última puede quedar incompleta).
+ */
+static inline uint32_t mascara_palabra(uint8_t w) {
+    uint16_t resto = COLUMNAS_MUNDO_SERPIENTE - w * 32;
+    return (resto >= 32) ? 0xFFFFFFFFu : ((1u << resto) - 1);
+}
+
+/**
+ * @brief Cuenta los bits en 1 de una palabra (sin depender de builtins).
+ */
+static uint8_t contar_bits(uint32_t valor) {
+    uint8_t cuenta = 0;
+    while (valor) {
+        valor &= valor - 1;
+        cuenta++;
+    }
+    return cuenta;
+}
+
 /**
  * @brief Genera nueva posición de comida (evitando la serpiente)
  * 
- * Genera coordenadas aleatorias dentro del área del LCD y verifica que
- * no coincidan con ningún segmento del cuerpo de la serpiente. Si hay
- * colisión, regenera hasta encontrar una posición válida.
+ * Elige al azar el k-ésimo casillero libre del mapa de ocupación, así
+ * todas las celdas libres tienen la misma probabilidad y el tiempo está
+ * acotado (una pasada por las palabras del mapa y otra por 32 bits),
+ * aunque el mundo esté casi lleno. Si no queda lugar, la comida queda
+ * fuera del tablero.
  */
 static void generar_comida(void) {
-    uint8_t valida;
-    do {
-        valida = 1;
-        comida.x = rand_range(0, COLUMNAS_LCD_SERPIENTE - 1);
-        comida.y = rand_range(0, FILAS_LCD_SERPIENTE - 1);
-        
-        // Verificar que no esté sobre la serpiente
-        for (uint8_t i = 0; i < snake_length; i++) {
-            if (snake[i].x == comida.x && snake[i].y == comida.y) {
-                valida = 0;
-                break;
+    uint16_t libres = CELDAS_SERPIENTE - snake_length;
+    if (libres == 0) {
+        comida.x = POSICION_INVALIDA;
+        comida.y = POSICION_INVALIDA;
+        return;
+    }
+
+    uint16_t k = rand_range(0, libres - 1);
+    for (uint8_t y = 0; y < FILAS_MUNDO_SERPIENTE; y++) {
+        for (uint8_t w = 0; w < PALABRAS_FILA_SERPIENTE; w++) {
+            uint32_t libres_palabra = ~ocupacion[y][w] & mascara_palabra(w);
+            uint8_t en_palabra = contar_bits(libres_palabra);
+            if (k >= en_palabra) {
+                k -= en_palabra;
+                continue;
+            }
+            for (uint8_t b = 0; b < 32; b++) {
+                if ((libres_palabra >> b) & 1u) {
+                    if (k == 0) {
+                        comida.x = w * 32 + b;
+                        comida.y = y;
+                        return;
+                    }
+                    k--;
+                }
+            }
+        }
+    }
+}
+
+/* === VISTA (VIEWPORT) === */
+
+/**
+ * @brief Ubica la vista para que la coordenada quede centrada, sin salir del mundo.
+ */
+static uint8_t centrar_vista(uint8_t cabeza, uint8_t tam_vista, uint8_t tam_mundo) {
+    int16_t origen = (int16_t)cabeza - tam_vista / 2;
+    if (origen < 0) origen = 0;
+    if (origen > tam_mundo - tam_vista) origen = tam_mundo - tam_vista;
+    return (uint8_t)origen;
+}
+
+/**
+ * @brief Hace que la vista siga a la cabeza.
+ *
+ * La vista no se mueve en cada paso: solo salta (recentrando la cabeza)
+ * cuando la cabeza entra en el margen del borde. Así la mayoría de los
+ * movimientos siguen costando 3 celdas y el desplazamiento, que reescribe
+ * las celdas visibles que cambian, ocurre pocas veces.
+ */
+static void actualizar_vista(Posicion cabeza) {
+    uint8_t x = vista_x;
+    uint8_t y = vista_y;
+
+    if (cabeza.x < vista_x + MARGEN_VISTA_X ||
+        cabeza.x >= vista_x + COLUMNAS_LCD_SERPIENTE - MARGEN_VISTA_X) {
+        x = centrar_vista(cabeza.x, COLUMNAS_LCD_SERPIENTE, COLUMNAS_MUNDO_SERPIENTE);
+    }
+    if (cabeza.y < vista_y + MARGEN_VISTA_Y ||
+        cabeza.y >= vista_y + FILAS_VISTA_SERPIENTE - MARGEN_VISTA_Y) {
+        y = centrar_vista(cabeza.y, FILAS_VISTA_SERPIENTE, FILAS_MUNDO_SERPIENTE);
+    }
+    if (x != vista_x || y != vista_y) {
+        vista_x = x;
+        vista_y = y;
+        vista_movida = 1;
+    }
+}
+
+/* === MEDIOS BLOQUES (CGRAM) === */
+
+// Cada carácter del LCD muestra dos celdas del mundo, una arriba de otra.
+// Cada mitad se dibuja con 4 de las 8 filas del glifo.
+typedef enum {
+    MITAD_VACIA = 0,
+    MITAD_CUERPO = 1,
+    MITAD_CABEZA = 2,
+    MITAD_COMIDA = 3,
+    MITAD_AVISO = 4,            // Borde de la vista del lado de la comida
+    CANTIDAD_MITADES
+} Mitad;
+
+static const uint8_t patron_mitad[CANTIDAD_MITADES][4] = {
+    {0x00, 0x00, 0x00, 0x00},   // Vacía
+    {0x0E, 0x1F, 0x1F, 0x0E},   // Cuerpo
+    {0x1F, 0x15, 0x1F, 0x1F},   // Cabeza (con ojos)
+    {0x04, 0x0E, 0x0E, 0x04},   // Comida
+    {0x04, 0x0A, 0x0A, 0x04}    // Aviso (comida hueca)
+};
+
+static const uint8_t caracter_respaldo[CANTIDAD_MITADES] = {' ', 'o', 'O', '*', '+'};
+
+/**
+ * @brief Celda de la vista que muestra la comida.
+ *
+ * Es la comida misma si está en la vista; si no, la celda del borde más
+ * cercana a ella, donde va el aviso. Con un mundo de 64x32 la vista cubre
+ * menos del 8 %, así que casi siempre la comida aparece primero como aviso.
+ */
+static Posicion celda_comida_en_vista(void) {
+    Posicion p = comida;
+    if (p.x < vista_x) p.x = vista_x;
+    if (p.x >= vista_x + COLUMNAS_LCD_SERPIENTE) p.x = vista_x + COLUMNAS_LCD_SERPIENTE - 1;
+    if (p.y < vista_y) p.y = vista_y;
+    if (p.y >= vista_y + FILAS_VISTA_SERPIENTE) p.y = vista_y + FILAS_VISTA_SERPIENTE - 1;
+    return p;
+}
+
+/**
+ * @brief Qué hay en una celda del mundo (consulta O(1)).
+ */
+static Mitad estado_celda(uint8_t x, uint8_t y) {
+    Posicion cabeza = segmento(0);
+    Posicion p = {x, y};
+    if (x == cabeza.x && y == cabeza.y) return MITAD_CABEZA;
+    if (celda_ocupada(p)) return MITAD_CUERPO;
+    if (x == comida.x && y == comida.y) return MITAD_COMIDA;
+    if (comida.x != POSICION_INVALIDA) {
+        Posicion aviso = celda_comida_en_vista();
+        if (x == aviso.x && y == aviso.y) return MITAD_AVISO;
+    }
+    return MITAD_VACIA;
+}
+
+/**
+ * @brief Arma el carácter de una celda del LCD a partir de sus dos mitades.
+ *
+ * Cada combinación (arriba, abajo) es una clave de la caché de glifos del
+ * framebuffer; solo se carga en CGRAM la primera vez que aparece. Si los 8
+ * slots están en pantalla se usa el carácter ASCII de la mitad más
+ * importante.
+ */
+static uint8_t caracter_celda(uint8_t fila, uint8_t col) {
+    uint8_t x = vista_x + col;
+    uint8_t y = vista_y + fila * 2;
+    Mitad arriba = estado_celda(x, y);
+    Mitad abajo = estado_celda(x, y + 1);
+    
+    if (arriba == MITAD_VACIA && abajo == MITAD_VACIA) return ' ';
+    
+    uint8_t patron[8];
+    for (uint8_t i = 0; i < 4; i++) {
+        patron[i] = patron_mitad[arriba][i];
+        patron[i + 4] = patron_mitad[abajo][i];
+    }
+    uint8_t caracter = lcd_fb_glifo((uint16_t)(arriba * CANTIDAD_MITADES + abajo), patron);
+    if (caracter) return caracter;
+    
+    // Sin slots libres: prioridad cabeza > comida > aviso > cuerpo
+    if (arriba == MITAD_CABEZA || abajo == MITAD_CABEZA) return caracter_respaldo[MITAD_CABEZA];
+    if (arriba == MITAD_COMIDA || abajo == MITAD_COMIDA) return caracter_respaldo[MITAD_COMIDA];
+    if (arriba == MITAD_AVISO || abajo == MITAD_AVISO) return caracter_respaldo[MITAD_AVISO];
+    return caracter_respaldo[MITAD_CUERPO];
+}
+
+/**
+ * @brief Redibuja el carácter del LCD que contiene una celda del mundo, si está en la vista.
+ */
+static void dibujar_celda(Posicion p) {
+    uint8_t col = p.x - vista_x;   // Con vuelta: fuera de la vista queda >= 20
+    uint8_t fila = p.y - vista_y;
+    if (p.x >= vista_x && p.y >= vista_y &&
+        col < COLUMNAS_LCD_SERPIENTE && fila < FILAS_VISTA_SERPIENTE) {
+        lcd_fb_escribir_caracter(fila / 2, col, caracter_celda(fila / 2, col));
+    }
+}
+
+/* === ESPECTADOR === */
+
+/**
+ * @brief Dirección de un segmento al siguiente (hacia la cola)
+ */
+static uint8_t direccion_entre(Posicion desde, Posicion hasta) {
+    if (hasta.y < desde.y) return ESPECTADOR_ARRIBA;
+    if (hasta.y > desde.y) return ESPECTADOR_ABAJO;
+    if (hasta.x < desde.x) return ESPECTADOR_IZQUIERDA;
+    return ESPECTADOR_DERECHA;
+}
+
+/**
+ * @brief Manda el paso que registró mover_serpiente(), ya dibujado en el LCD
+ */
+static void transmitir_paso(void) {
+    if (!bt_espectador_activo()) return;
+
+    EspectadorTrama trama;
+    paso_espectador.direccion = (uint8_t)direccion_actual;  // Mismo orden que ESPECTADOR_ARRIBA..DERECHA
+    paso_espectador.comida_movida = comida_movida;
+    paso_espectador.comida_x = comida.x;
+    paso_espectador.comida_y = comida.y;
+    paso_espectador.vista_x = vista_x;
+    paso_espectador.vista_y = vista_y;
+
+    espectador_iniciar_trama(&trama);
+    espectador_poner_paso(&trama, &paso_espectador);
+    bt_enviar_juego(trama.carga, trama.largo);
+}
+
+/**
+ * @brief Manda un cambio a pantalla de texto (ESPECTADOR_PAUSA o ESPECTADOR_FIN)
+ */
+static void transmitir_marca(uint8_t tipo) {
+    if (!bt_espectador_activo()) return;
+
+    EspectadorTrama trama;
+    espectador_iniciar_trama(&trama);
+    espectador_poner_marca(&trama, tipo);
+    bt_enviar_juego(trama.carga, trama.largo);
+}
+
+/**
+ * @brief Manda el estado completo: foto y el cuerpo de la cabeza a la cola
+ *
+ * Se arma solo si todas las tramas entran juntas en la cola TX, así una
+ * serpiente larga no queda a medias; si no, se reintenta en el próximo
+ * tick.
+ * @return 1 si se mandó
+ */
+static uint8_t transmitir_foto(void) {
+    if (bt_tx_libres() < espectador_bytes_foto_serpiente(snake_length)) return 0;
+
+    EspectadorTrama trama;
+    EspectadorFotoSerpiente foto;
+    uint8_t direcciones[ESPECTADOR_CUERPO_MAXIMO];
+    Posicion cabeza = segmento(0);
+
+    foto.ancho = COLUMNAS_MUNDO_SERPIENTE;
+    foto.alto = FILAS_MUNDO_SERPIENTE;
+    foto.cabeza_x = cabeza.x;
+    foto.cabeza_y = cabeza.y;
+    foto.comida_x = comida.x;
+    foto.comida_y = comida.y;
+    foto.vista_x = vista_x;
+    foto.vista_y = vista_y;
+    foto.puntuacion = (uint16_t)score;
+    foto.largo = snake_length;
+    foto.estado = game_over ? ESPECTADOR_TERMINADO :
+                  (redibujar_completo ? ESPECTADOR_EN_PAUSA : ESPECTADOR_JUGANDO);
+
+    espectador_iniciar_trama(&trama);
+    espectador_poner_foto_serpiente(&trama, &foto);
+
+    uint16_t siguiente = 0;     // Segmento del que sale la próxima dirección
+    for (;;) {
+        uint16_t faltan = snake_length - 1 - siguiente;
+        uint8_t n = espectador_lugar_cuerpo(&trama);
+        if (n > faltan) n = (uint8_t)faltan;
+
+        if (n > 0) {
+            for (uint8_t k = 0; k < n; k++) {
+                direcciones[k] = direccion_entre(segmento(siguiente + k), segmento(siguiente + k + 1));
             }
+            espectador_poner_cuerpo(&trama, siguiente, direcciones, n);
+            siguiente += n;
         }
-    } while (!valida);
+        if (siguiente == snake_length - 1 || n == 0) {
+            bt_enviar_juego(trama.carga, trama.largo);
+            if (siguiente == snake_length - 1) return 1;
+            espectador_iniciar_trama(&trama);
+        }
+    }
+}
+
+/**
+ * @brief Responde un pedido de foto del espectador
+ */
+static void atender_espectador(void) {
+    uint8_t pedido = bt_obtener_pedido_foto();
+
+    if (!bt_espectador_activo()) {
+        foto_pendiente = 0;
+        return;
+    }
+    if (pedido) foto_pendiente = 1;
+    if (foto_pendiente && transmitir_foto()) {
+        foto_pendiente = 0;
+    }
 }
 
 /**
  * @brief Inicializa el estado del juego
  * 
  * Resetea todas las variables a sus valores iniciales:
- * - Serpiente de 3 segmentos en el centro del LCD
+ * - Serpiente de 3 segmentos en el centro del mundo, con la vista centrada
  * - Dirección inicial hacia la derecha
  * - Puntuación en cero
  * - Velocidad inicial (TICKS_VELOCIDAD_SERPIENTE = 6)
@@ -104,20 +468,27 @@ static void generar_comida(void) {
  */
 static void inicializar_estado(void) {
     // Serpiente inicial en el centro
-    snake[0].x = 10;
-    snake[0].y = 2;
-    snake[1].x = 9;
-    snake[1].y = 2;
-    snake[2].x = 8;
-    snake[2].y = 2;
+    indice_cabeza = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        snake[i].x = COLUMNAS_MUNDO_SERPIENTE / 2 - i;
+        snake[i].y = FILAS_MUNDO_SERPIENTE / 2;
+    }
     
     snake_length = 3;
+    memset(ocupacion, 0, sizeof(ocupacion));
+    for (uint16_t i = 0; i < snake_length; i++) {
+        ocupar_celda(segmento(i));
+    }
+    vista_x = centrar_vista(snake[0].x, COLUMNAS_LCD_SERPIENTE, COLUMNAS_MUNDO_SERPIENTE);
+    vista_y = centrar_vista(snake[0].y, FILAS_VISTA_SERPIENTE, FILAS_MUNDO_SERPIENTE);
+    vista_movida = 0;
     direccion_actual = DIR_DERECHA;
     direccion_siguiente = DIR_DERECHA;
     score = 0;
     game_over = 0;
     game_started = 1;
     paused = 0;
+    redibujar_completo = 0;
     move_counter = 0;
     speed_ticks = TICKS_VELOCIDAD_SERPIENTE;
     
@@ -125,58 +496,64 @@ static void inicializar_estado(void) {
 }
 
 /**
- * @brief Limpia el buffer del LCD
+ * @brief Dibuja la vista completa en el framebuffer del LCD
  * 
- * Rellena todas las posiciones del buffer con espacios (' ') y
- * agrega terminadores nulos al final de cada fila. Esto prepara
- * el buffer para dibujar un nuevo frame del juego.
+ * Renderiza la porción visible del mundo (20x8 celdas, dos por carácter)
+ * en el framebuffer compartido con glifos de medio bloque para cabeza,
+ * cuerpo y comida.
+ * 
+ * Las 160 celdas se leen del mapa de ocupación, así que el costo no
+ * depende de la longitud de la serpiente. El buffer se limpia antes para
+ * liberar los slots CGRAM que el frame anterior ya no necesita; el
+ * framebuffer solo marca como modificadas las celdas que difieren de lo
+ * que ya muestra el LCD.
  */
-static void limpiar_buffer(void) {
-    for (uint8_t y = 0; y < FILAS_LCD_SERPIENTE; y++) {
-        memset(buffer_lcd[y], ' ', COLUMNAS_LCD_SERPIENTE);
-        buffer_lcd[y][COLUMNAS_LCD_SERPIENTE] = '\0';
+static void dibujar_en_buffer(void) {
+    lcd_fb_limpiar();
+    for (uint8_t fila = 0; fila < FILAS_LCD_SERPIENTE; fila++) {
+        for (uint8_t col = 0; col < COLUMNAS_LCD_SERPIENTE; col++) {
+            lcd_fb_escribir_caracter(fila, col, caracter_celda(fila, col));
+        }
     }
+    vista_movida = 0;
 }
 
 /**
- * @brief Dibuja el juego en el buffer
+ * @brief Dibuja solo las celdas que cambió el último movimiento
  * 
- * Renderiza el estado actual del juego en el buffer de memoria:
- * - Serpiente: 'O' para la cabeza, 'o' para el cuerpo
- * - Comida: '*'
- * - Espacios vacíos: ' '
- * 
- * El buffer se actualiza completamente en cada frame para evitar
- * artefactos visuales. Luego se envía al LCD con actualizar_lcd().
+ * Un paso de la serpiente toca a lo sumo tres celdas (cola soltada,
+ * cabeza anterior y cabeza nueva) más la comida (o su aviso) si se regeneró, así que no
+ * hace falta recorrer el cuerpo ni limpiar el buffer completo. Cada una se
+ * recompone junto con la otra mitad de su carácter.
  */
-static void dibujar_en_buffer(void) {
-    limpiar_buffer();
+static void dibujar_movimiento(void) {
+    if (vista_movida) {
+        dibujar_en_buffer();  // La vista saltó: todas las celdas visibles cambian de lugar
+        return;
+    }
     
-    // Dibujar serpiente
-    for (uint8_t i = 0; i < snake_length; i++) {
-        if (snake[i].x < COLUMNAS_LCD_SERPIENTE && snake[i].y < FILAS_LCD_SERPIENTE) {
-            buffer_lcd[snake[i].y][snake[i].x] = (i == 0) ? 'O' : 'o';  // Cabeza 'O', cuerpo 'o'
-        }
+    if (hubo_cola_soltada) {
+        dibujar_celda(cola_soltada);
     }
+    if (snake_length > 1) {
+        dibujar_celda(cabeza_anterior);
+    }
+    dibujar_celda(segmento(0));
     
-    // Dibujar comida
-    if (comida.x < COLUMNAS_LCD_SERPIENTE && comida.y < FILAS_LCD_SERPIENTE) {
-        buffer_lcd[comida.y][comida.x] = '*';
+    if (comida_movida) {
+        dibujar_celda(celda_comida_en_vista());  // La comida o su aviso en el borde
     }
 }
 
 /**
- * @brief Envía el buffer al LCD
+ * @brief Envía el frame al LCD
  * 
- * Transfiere el contenido del buffer de memoria al LCD físico,
- * fila por fila. Esta separación entre buffer y LCD permite
- * preparar todo el frame antes de mostrarlo, evitando parpadeos.
+ * Vuelca el framebuffer: solo viajan por I2C las celdas que cambiaron
+ * desde el frame anterior (cabeza, cabeza anterior, cola y comida), en
+ * lugar de las 80 celdas de la pantalla.
  */
 static void actualizar_lcd(void) {
-    for (uint8_t y = 0; y < FILAS_LCD_SERPIENTE; y++) {
-        lcd_establecer_cursor(y, 0);
-        lcd_escribir((char*)buffer_lcd[y]);
-    }
+    lcd_fb_volcar();
 }
 
 /**
@@ -250,23 +627,28 @@ static void procesar_entrada(void) {
  * Secuencia de actualización:
  * 1. Calcula nueva posición de la cabeza según dirección actual
  * 2. Detecta colisiones:
- *    - Paredes (límites del LCD) → game_over
+ *    - Paredes (límites del mundo) → game_over
  *    - Propio cuerpo → game_over
+ *    (consulta O(1) al mapa de ocupación)
  * 3. Verifica si comió:
  *    - Incrementa score
  *    - Aumenta longitud (hasta LONGITUD_MAXIMA_SERPIENTE)
- *    - Genera nueva comida
  *    - Aumenta velocidad cada 5 comidas (reduce speed_ticks)
- * 4. Mueve el cuerpo (desde la cola hacia adelante)
- * 5. Coloca nueva cabeza
+ * 4. Agrega la nueva cabeza a la cola circular (O(1), sin mover el cuerpo);
+ *    si no creció, la cola anterior ya fue soltada
+ * 5. Si comió, genera nueva comida
+ * 6. Registra el paso para el espectador (se manda después de dibujarlo)
  * 
  * Si hay colisión, reproduce melodía de game over y detiene el juego.
  */
 static void mover_serpiente(void) {
+    uint8_t vista_x_antes = vista_x;
+    uint8_t vista_y_antes = vista_y;
+
     direccion_actual = direccion_siguiente;
     
     // Nueva posición de la cabeza
-    Posicion nueva_cabeza = snake[0];
+    Posicion nueva_cabeza = segmento(0);
     switch (direccion_actual) {
         case DIR_ARRIBA:    nueva_cabeza.y--; break;
         case DIR_ABAJO:     nueva_cabeza.y++; break;
@@ -274,34 +656,44 @@ static void mover_serpiente(void) {
         case DIR_DERECHA:   nueva_cabeza.x++; break;
     }
     
-    // Verificar colisión con paredes
-    if (nueva_cabeza.x >= COLUMNAS_LCD_SERPIENTE || nueva_cabeza.y >= FILAS_LCD_SERPIENTE) {
+    // Verificar colisión con paredes (bordes del mundo)
+    if (nueva_cabeza.x >= COLUMNAS_MUNDO_SERPIENTE || nueva_cabeza.y >= FILAS_MUNDO_SERPIENTE) {
         game_over = 1;
         melodias_iniciar(melodia_game_over);  // Cambiar a melodía de Game Over
         return;
     }
     
-    // Verificar colisión con el propio cuerpo
-    for (uint8_t i = 0; i < snake_length; i++) {
-        if (snake[i].x == nueva_cabeza.x && snake[i].y == nueva_cabeza.y) {
-            game_over = 1;
-            melodias_iniciar(melodia_game_over);  // Cambiar a melodía de Game Over
-            return;
-        }
+    // Verificar colisión con el propio cuerpo (la cola todavía cuenta)
+    if (celda_ocupada(nueva_cabeza)) {
+        game_over = 1;
+        melodias_iniciar(melodia_game_over);  // Cambiar a melodía de Game Over
+        return;
     }
     
     // Verificar si comió
     uint8_t comio = (nueva_cabeza.x == comida.x && nueva_cabeza.y == comida.y);
+    uint8_t crece = comio && snake_length < LONGITUD_MAXIMA_SERPIENTE;
+    
+    // Si no crece, la cola actual se suelta
+    cabeza_anterior = segmento(0);
+    hubo_cola_soltada = !crece;
+    if (!crece) {
+        cola_soltada = segmento(snake_length - 1);
+        liberar_celda(cola_soltada);
+    }
+    ocupar_celda(nueva_cabeza);
+    
+    // Colocar nueva cabeza: la cola queda donde corresponde sin mover el cuerpo
+    agregar_cabeza(nueva_cabeza);
     
     if (comio) {
         score++;
-        if (snake_length < LONGITUD_MAXIMA_SERPIENTE) {
+        if (crece) {
             snake_length++;
         }
-        generar_comida();
         
-        // NO reproducir efecto (interrumpe música de fondo)
-        // melodias_iniciar(melodia_salto);
+        // Efecto en su propia voz: la música de fondo sigue sonando
+        melodias_efecto(melodia_salto);
         
         // Aumentar velocidad cada 5 comidas
         if (speed_ticks > 2 && score % 5 == 0) {
@@ -309,13 +701,16 @@ static void mover_serpiente(void) {
         }
     }
     
-    // Mover el cuerpo (desde la cola hacia la cabeza)
-    for (uint8_t i = snake_length - 1; i > 0; i--) {
-        snake[i] = snake[i - 1];
+    // La comida nueva se elige con el mapa ya actualizado
+    comida_movida = comio;
+    if (comio) {
+        generar_comida();
     }
     
-    // Colocar nueva cabeza
-    snake[0] = nueva_cabeza;
+    actualizar_vista(nueva_cabeza);
+    paso_espectador.comio = comio;
+    paso_espectador.crecio = crece;
+    paso_espectador.vista_movida = (vista_x != vista_x_antes || vista_y != vista_y_antes);
 }
 
 /**
@@ -329,11 +724,9 @@ static void mover_serpiente(void) {
  * Convierte el score (uint32_t) a string manualmente para mostrar.
  */
 static void mostrar_game_over(void) {
-    lcd_borrarPantalla();
-    lcd_establecer_cursor(0, 0);
-    lcd_escribir("   GAME OVER!");
-    lcd_establecer_cursor(1, 0);
-    lcd_escribir("  Puntuacion: ");
+    lcd_fb_borrar_pantalla();
+    lcd_fb_escribir(0, 0, "   GAME OVER!");
+    lcd_fb_escribir(1, 0, "  Puntuacion: ");
     
     char score_str[10];
     uint8_t idx = 0;
@@ -352,59 +745,11 @@ static void mostrar_game_over(void) {
         }
     }
     score_str[idx] = '\0';
-    lcd_escribir(score_str);
-    
-    lcd_establecer_cursor(3, 0);
-    lcd_escribir("Boton:Volver al menu");
-}
-
-/* === CONFIGURACIÓN DEL TIMER === */
-/**
- * @brief Configura TIMER3 para generar ticks de juego cada 50ms
- * 
- * Configuración:
- * - Prescaler: 1000 (1ms por tick del timer)
- * - Match value: 50 (50 ticks = 50ms)
- * - Reset automático en match (contador continuo)
- * - Interrupción habilitada (setea tick_flag en ISR)
- * 
- * Frecuencia resultante: 20 Hz (20 ticks por segundo)
- */
-static void config_timer(void) {
-    TIM_TIMERCFG_Type timer_cfg;
-    TIM_MATCHCFG_Type match_cfg;
-    
-    // Configurar timer a 50ms (usando prescaler en microsegundos)
-    timer_cfg.prescaleOption = TIM_USVAL;
-    timer_cfg.prescaleValue = 1000;  // 1ms por tick
-    TIM_Init(LPC_TIM3, TIM_TIMER_MODE, &timer_cfg);
-    
-    // Match cada 50 ticks = 50ms
-    match_cfg.matchChannel = TIM_MATCH_CHANNEL_0;
-    match_cfg.intOnMatch = ENABLE;
-    match_cfg.resetOnMatch = ENABLE;
-    match_cfg.stopOnMatch = DISABLE;
-    match_cfg.extMatchOutputType = TIM_NOTHING;
-    match_cfg.matchValue = 50;  // 50ms
-    TIM_ConfigMatch(LPC_TIM3, &match_cfg);
+    lcd_fb_escribir(1, 14, score_str);
     
-    NVIC_EnableIRQ(TIMER3_IRQn);
-    TIM_Cmd(LPC_TIM3, ENABLE);
-}
-
-/* === MANEJADOR DE INTERRUPCIÓN === */
-/**
- * @brief Handler de interrupción de TIMER3
- * 
- * Se ejecuta cada 50ms cuando TIMER3 alcanza el valor de match.
- * Setea tick_flag = 1 para indicar al main loop que debe procesar
- * un tick de juego. Mantiene la ISR breve (solo setea flag).
- */
-void TIMER3_IRQHandler(void) {
-    if (TIM_GetIntStatus(LPC_TIM3, TIM_MR0_INT)) {
-        TIM_ClearIntPending(LPC_TIM3, TIM_MR0_INT);
-        tick_flag = 1;
-    }
+    lcd_fb_escribir(3, 0, "Boton:Volver al menu");
+    lcd_fb_volcar();
+    transmitir_marca(ESPECTADOR_FIN);
 }
 
 /* === FUNCIONES PÚBLICAS === */
@@ -413,23 +758,26 @@ void TIMER3_IRQHandler(void) {
  * @brief Inicializa el juego Snake
  * 
  * Llamar esta función una vez antes de entrar al loop del juego.
- * Inicializa el estado del juego, configura TIMER3, borra la pantalla
- * y dibuja el primer frame.
+ * Inicializa el estado del juego, (re)inicia su tarea de 50ms en el
+ * planificador, borra la pantalla y dibuja el primer frame.
  */
 void juego_serpiente_inicializar(void) {
     inicializar_estado();
-    config_timer();
+    planificador_crear_tarea(&tarea_tick, TICK_MS_SERPIENTE, TICK_MS_SERPIENTE);
     
-    lcd_borrarPantalla();
+    lcd_fb_borrar_pantalla();
     dibujar_en_buffer();
     actualizar_lcd();
+
+    foto_pendiente = 1;     // Un espectador ya conectado arranca con esta partida
+    atender_espectador();
 }
 
 /**
  * @brief Loop principal del juego Snake
  * 
  * Debe ser llamada continuamente desde el main loop. Procesa un tick
- * de juego cada vez que tick_flag está seteado (cada 50ms).
+ * de juego cada vez que el planificador libera su tarea (cada 50ms).
  * 
  * Estados:
  * - game_over == 0: Juego activo
@@ -446,12 +794,14 @@ void juego_serpiente_inicializar(void) {
  */
 void juego_serpiente_ejecutar(void) {
     if (!game_started) return;
+    atender_espectador();
     
     if (game_over == 1) {
         static uint8_t game_over_mostrado = 0;
         
         if (!game_over_mostrado) {
             mostrar_game_over();
+            planificador_detener_tarea(tarea_tick);     // El botón se lee sin tick
             game_over_mostrado = 1;
         }
         
@@ -467,15 +817,16 @@ void juego_serpiente_ejecutar(void) {
         return;
     }
     
-    if (!tick_flag) return;
-    tick_flag = 0;
+    if (!planificador_tarea_lista(tarea_tick)) return;
     
     procesar_entrada();
     
     if (paused) {
-        // Mostrar indicador de pausa
-        lcd_establecer_cursor(0, 0);
-        lcd_escribir("PAUSA");
+        // Mostrar indicador de pausa (tapa celdas del tablero)
+        if (!redibujar_completo) transmitir_marca(ESPECTADOR_PAUSA);
+        lcd_fb_escribir(0, 0, "PAUSA");
+        lcd_fb_volcar();
+        redibujar_completo = 1;
         return;
     }
     
@@ -483,8 +834,16 @@ void juego_serpiente_ejecutar(void) {
     if (move_counter >= speed_ticks) {
         move_counter = 0;
         mover_serpiente();
-        dibujar_en_buffer();
+        if (game_over) return;  // La pantalla de Game Over se dibuja en el próximo llamado
+        
+        if (redibujar_completo) {
+            dibujar_en_buffer();
+            redibujar_completo = 0;
+        } else {
+            dibujar_movimiento();
+        }
         actualizar_lcd();
+        transmitir_paso();      // Como Dino: el espectador recibe lo que ya está en el LCD
     }
 }
 
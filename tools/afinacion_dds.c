@@ -0,0 +1,126 @@
+/**
+ * @file afinacion_dds.c
+ * @brief Error de afinación (PC) de cada nota de melodias_dac.h.
+ *
+ * Para cada nota de la tabla compara la frecuencia temperada ideal
+ * (LA_4 = 440 Hz) con lo que sale por el DAC en tres motores:
+ * - Timer0 por muestra (el original): período en us enteros / 16, mínimo 5 us.
+ * - Contador del DAC por nota: DACCNTVAL = PCLK_DAC / (f * 16).
+ * - DDS actual: incremento de fase de 32 bits a frecuencia fija.
+ *
+ * El error se informa en cents (1/100 de semitono). También separa el error
+ * de redondear la nota a Hz enteros en el header del error del motor.
+ *
+ * Compilar: gcc -O2 -Iinclude -o afinacion_dds tools/afinacion_dds.c src/mezclador_audio.c -lm
+ * Uso:      ./afinacion_dds              (tabla completa)
+ *           ./afinacion_dds --verificar  (falla si el DDS se aparta > 0.01 cents)
+ *
+ * @date Noviembre 2025
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "melodias_dac.h"
+#include "mezclador_audio.h"
+
+/* === MISMOS PARÁMETROS QUE melodias_dac.c === */
+#define NUMERO_MUESTRAS   16
+#define PCLK_DAC_HZ       25000000.0   // CCLK 100 MHz / 4 (valor de SystemInit)
+#define FS                MELODIAS_FRECUENCIA_MUESTREO_HZ
+#define TOLERANCIA_CENTS  0.01
+
+typedef struct {
+    const char *nombre;
+    uint16_t hz;        // Valor del #define
+    int midi;           // Número de nota MIDI (LA_4 = 69)
+} NotaTabla;
+
+#define NOTA(n, m) { #n, n, m }
+
+static const NotaTabla notas[] = {
+    NOTA(DO_3, 48), NOTA(DO_S3, 49), NOTA(RE_3, 50), NOTA(RE_S3, 51),
+    NOTA(MI_3, 52), NOTA(FA_3, 53), NOTA(FA_S3, 54), NOTA(SOL_3, 55),
+    NOTA(SOL_S3, 56), NOTA(LA_3, 57), NOTA(LA_S3, 58), NOTA(SI_3, 59),
+    NOTA(DO_4, 60), NOTA(DO_S4, 61), NOTA(RE_4, 62), NOTA(RE_S4, 63),
+    NOTA(MI_4, 64), NOTA(FA_4, 65), NOTA(FA_S4, 66), NOTA(SOL_4, 67),
+    NOTA(SOL_S4, 68), NOTA(LA_4, 69), NOTA(LA_S4, 70), NOTA(SI_4, 71),
+    NOTA(DO_5, 72), NOTA(DO_S5, 73), NOTA(RE_5, 74), NOTA(RE_S5, 75),
+    NOTA(MI_5, 76), NOTA(FA_5, 77), NOTA(FA_S5, 78), NOTA(SOL_5, 79),
+    NOTA(SOL_S5, 80), NOTA(LA_5, 81), NOTA(LA_S5, 82), NOTA(SI_5, 83),
+};
+
+#define CANTIDAD_NOTAS (sizeof(notas) / sizeof(notas[0]))
+
+static double cents(double real, double referencia) {
+    return 1200.0 * log2(real / referencia);
+}
+
+/**
+ * @brief Frecuencia que producía el Timer0 original (us enteros por muestra).
+ */
+static double frecuencia_timer(uint16_t hz) {
+    uint32_t periodo_us = 1000000 / hz;
+    uint32_t muestra_us = periodo_us / NUMERO_MUESTRAS;
+    if (muestra_us < 5) muestra_us = 5;
+    return 1e6 / ((double)muestra_us * NUMERO_MUESTRAS);
+}
+
+/**
+ * @brief Frecuencia con DACCNTVAL recalculado por nota.
+ */
+static double frecuencia_contador_dac(uint16_t hz) {
+    uint32_t cuentas = (uint32_t)(PCLK_DAC_HZ / ((double)hz * NUMERO_MUESTRAS));
+    return PCLK_DAC_HZ / ((double)cuentas * NUMERO_MUESTRAS);
+}
+
+/**
+ * @brief Frecuencia del DDS con el incremento que calcula el firmware.
+ */
+static double frecuencia_dds(uint16_t hz) {
+    return (double)mezclador_incremento_fase(hz) * FS / 4294967296.0;
+}
+
+int main(int argc, char *argv[]) {
+    int verificar = (argc > 1 && strcmp(argv[1], "--verificar") == 0);
+    double peor_timer = 0, peor_contador = 0, peor_dds = 0, peor_tabla = 0;
+
+    if (!verificar) {
+        printf("%-7s %5s %9s | %8s | %8s %8s %10s\n",
+               "nota", "Hz", "ideal", "tabla", "timer", "contador", "dds");
+        printf("%-7s %5s %9s | %8s | %8s %8s %10s\n",
+               "", "", "", "(cents)", "(cents)", "(cents)", "(cents)");
+    }
+
+    for (size_t i = 0; i < CANTIDAD_NOTAS; i++) {
+        const NotaTabla *n = &notas[i];
+        double ideal = 440.0 * pow(2.0, (n->midi - 69) / 12.0);
+
+        // Error del motor respecto del valor pedido (n->hz)
+        double e_timer = cents(frecuencia_timer(n->hz), n->hz);
+        double e_contador = cents(frecuencia_contador_dac(n->hz), n->hz);
+        double e_dds = cents(frecuencia_dds(n->hz), n->hz);
+        // Error de haber redondeado la nota a Hz enteros
+        double e_tabla = cents(n->hz, ideal);
+
+        if (fabs(e_timer) > peor_timer) peor_timer = fabs(e_timer);
+        if (fabs(e_contador) > peor_contador) peor_contador = fabs(e_contador);
+        if (fabs(e_dds) > peor_dds) peor_dds = fabs(e_dds);
+        if (fabs(e_tabla) > peor_tabla) peor_tabla = fabs(e_tabla);
+
+        if (!verificar) {
+            printf("%-7s %5u %9.3f | %+8.3f | %+8.2f %+8.3f %+10.6f\n",
+                   n->nombre, n->hz, ideal, e_tabla, e_timer, e_contador, e_dds);
+        }
+    }
+
+    printf("Peor error: tabla %.3f, timer %.2f, contador DAC %.3f, DDS %.6f cents\n",
+           peor_tabla, peor_timer, peor_contador, peor_dds);
+
+    if (verificar) {
+        printf("%s\n", peor_dds > TOLERANCIA_CENTS ? "FALLO" : "OK: DDS dentro de la tolerancia");
+        return peor_dds > TOLERANCIA_CENTS ? 1 : 0;
+    }
+    return 0;
+}
@@ -0,0 +1,453 @@
+/**
+ * @file cliente_bt.c
+ * @brief Cliente de referencia (PC) del protocolo binario Bluetooth.
+ *
+ * Usa src/protocolo_bt.c tal cual corre en la placa.
+ *
+ * --enviar arma tramas de eventos a partir de letras (W/A/S/D/B/I, C para
+ * centro), separadas por --paso ms en el reloj del emisor y agrupadas de a
+ * --grupo eventos por trama. Al final pide telemetría. La salida va a
+ * stdout, para redirigirla al puerto serie del HC-05.
+ *
+ * --leer analiza lo que manda la placa (stdin): imprime cada trama de
+ * telemetría decodificada y deja pasar el texto tal cual.
+ *
+ * --verificar corre las pruebas de fuzzing del receptor:
+ * - Ida y vuelta de eventos y telemetría con contenidos aleatorios.
+ * - Tramas mezcladas con texto y basura: sin 0xA5 en la basura se tienen
+ *   que recuperar todas y los bytes sueltos tienen que salir en orden;
+ *   con basura cargada de 0xA5 se mide cuántas se pierden por un CRC que
+ *   coincide de casualidad.
+ * - Errores de bit y ráfagas de hasta 8 bits fuera del byte de largo:
+ *   ninguna trama dañada se puede aceptar (garantía del CRC).
+ * - Ruido puro cortado con protocolo_vaciar() al azar: cada byte tiene que
+ *   terminar como suelto, dentro de una trama o contado como error.
+ *
+ * Compilar: gcc -O2 -Iinclude -o cliente_bt tools/cliente_bt.c src/protocolo_bt.c
+ *           (con -fsanitize=address,undefined además busca accesos fuera de rango)
+ * Uso:      ./cliente_bt --enviar wwddb [--paso 50] [--grupo 4] > /dev/rfcomm0
+ *           ./cliente_bt --leer < /dev/rfcomm0
+ *           ./cliente_bt --verificar [semilla]   (devuelve 1 si algo falla)
+ *
+ * @date Noviembre 2025
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "protocolo_bt.h"
+
+#define TRAMAS_MEZCLA       200000
+#define TRAMAS_DANADAS      200000
+#define BYTES_RUIDO         5000000
+
+static int errores = 0;
+static uint32_t estado_azar = 12345;
+
+static uint32_t azar(void) {
+    uint32_t x = estado_azar;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    estado_azar = x;
+    return x;
+}
+
+static void fallo(const char *prueba, const char *detalle, uint32_t paso) {
+    if (errores < 10) {
+        printf("%s: %s en el paso %u\n", prueba, detalle, paso);
+    }
+    errores++;
+}
+
+/* ============================ ENVIAR ====================================== */
+
+static int codigo_de_letra(char letra) {
+    switch (toupper((unsigned char)letra)) {
+        case 'W': return PROTOCOLO_EVENTO_ARRIBA;
+        case 'S': return PROTOCOLO_EVENTO_ABAJO;
+        case 'A': return PROTOCOLO_EVENTO_IZQUIERDA;
+        case 'D': return PROTOCOLO_EVENTO_DERECHA;
+        case 'B': return PROTOCOLO_EVENTO_BOTON;
+        case 'I': return PROTOCOLO_EVENTO_PERFIL;
+        case 'C': return PROTOCOLO_EVENTO_CENTRO;
+        default:  return -1;
+    }
+}
+
+static int enviar(const char *letras, uint16_t paso_ms, uint8_t grupo) {
+    ProtocoloEvento eventos[PROTOCOLO_EVENTOS_MAXIMO];
+    uint8_t carga[PROTOCOLO_CARGA_MAXIMA];
+    uint8_t trama[PROTOCOLO_TRAMA_MAXIMA];
+    uint8_t secuencia = 0, n = 0;
+    uint16_t reloj = 0;
+
+    for (const char *p = letras; ; p++) {
+        if (*p != '\0') {
+            int codigo = codigo_de_letra(*p);
+            if (codigo < 0) {
+                fprintf(stderr, "Letra desconocida '%c'\n", *p);
+                return 1;
+            }
+            eventos[n].tiempo_ms = reloj;
+            eventos[n].codigo = (uint8_t)codigo;
+            n++;
+            reloj += paso_ms;
+        }
+        if (n > 0 && (n == grupo || *p == '\0')) {
+            uint8_t largo = protocolo_codificar_eventos(eventos, n, carga);
+            fwrite(trama, 1, protocolo_armar_trama(PROTOCOLO_TIPO_EVENTOS, secuencia++, carga, largo, trama), stdout);
+            n = 0;
+        }
+        if (*p == '\0') break;
+    }
+
+    fwrite(trama, 1, protocolo_armar_trama(PROTOCOLO_TIPO_PEDIR_TELEMETRIA, secuencia, NULL, 0, trama), stdout);
+    return 0;
+}
+
+/* ============================= LEER ======================================= */
+
+static void imprimir_trama(const ProtocoloTrama *trama) {
+    ProtocoloTelemetria t;
+
+    if (trama->tipo == PROTOCOLO_TIPO_TELEMETRIA &&
+        protocolo_decodificar_telemetria(trama->carga, trama->largo, &t)) {
+        printf("\n[telemetría #%u] t=%u ms  ack=%u  pendientes=%u  tramas=%u  crc=%u  "
+               "perdidas=%u  rx_desc=%u  tx_desc=%u  latencia_peor=%u ms\n",
+               trama->secuencia, t.tiempo_ms, t.ultima_secuencia, t.eventos_pendientes,
+               t.tramas_aceptadas, t.errores_crc, t.tramas_perdidas,
+               t.rx_descartados, t.tx_descartados, t.latencia_peor_ms);
+    } else {
+        printf("\n[trama tipo 0x%02X #%u, %u bytes]\n", trama->tipo, trama->secuencia, trama->largo);
+    }
+}
+
+static void imprimir_suelto(uint8_t byte) {
+    putchar(byte);
+}
+
+static int leer(void) {
+    ProtocoloReceptor receptor;
+    int c;
+
+    protocolo_inicializar(&receptor, imprimir_trama, imprimir_suelto);
+    while ((c = getchar()) != EOF) {
+        protocolo_recibir(&receptor, (uint8_t)c);
+        fflush(stdout);
+    }
+    protocolo_vaciar(&receptor);
+    fprintf(stderr, "%u tramas, %u errores, %u bytes sueltos\n",
+            receptor.tramas, receptor.errores, receptor.sueltos);
+    return 0;
+}
+
+/* =========================== VERIFICAR ==================================== */
+
+/* Lo que entrega el receptor, para compararlo con lo enviado */
+static ProtocoloTrama ultima_trama;
+static uint32_t tramas_entregadas = 0;
+static uint32_t bytes_en_tramas = 0;
+static uint8_t sueltos[64];
+static uint32_t cantidad_sueltos = 0;
+static const uint8_t *esperada = NULL;     // Trama que se está mandando
+static uint32_t coincidencias = 0;         // Entregas iguales a la esperada
+static uint32_t ajenas = 0;                // Entregas armadas con basura (CRC casual)
+
+static uint8_t misma_trama(const ProtocoloTrama *recibida, const uint8_t *enviada) {
+    return recibida->tipo == enviada[1] && recibida->secuencia == enviada[2] &&
+           recibida->largo == enviada[3] &&
+           memcmp(recibida->carga, &enviada[PROTOCOLO_CABECERA], recibida->largo) == 0;
+}
+
+static void guardar_trama(const ProtocoloTrama *trama) {
+    ultima_trama = *trama;
+    tramas_entregadas++;
+    bytes_en_tramas += PROTOCOLO_CABECERA + trama->largo + 1;
+    if (esperada != NULL && misma_trama(trama, esperada)) {
+        coincidencias++;
+    } else {
+        ajenas++;
+    }
+}
+
+static void guardar_suelto(uint8_t byte) {
+    if (cantidad_sueltos < sizeof(sueltos)) {
+        sueltos[cantidad_sueltos] = byte;
+    }
+    cantidad_sueltos++;
+}
+
+static void reiniciar_entregas(void) {
+    tramas_entregadas = 0;
+    bytes_en_tramas = 0;
+    cantidad_sueltos = 0;
+    coincidencias = 0;
+    ajenas = 0;
+    esperada = NULL;
+}
+
+/**
+ * @brief Trama aleatoria; sin_sincronismo evita 0xA5 en tipo, secuencia y carga
+ */
+static uint8_t trama_al_azar(uint8_t *salida, uint8_t sin_sincronismo) {
+    uint8_t carga[PROTOCOLO_CARGA_MAXIMA];
+    uint8_t largo = (uint8_t)(azar() % (PROTOCOLO_CARGA_MAXIMA + 1));
+    uint8_t tipo = (uint8_t)azar(), secuencia = (uint8_t)azar();
+
+    for (uint8_t i = 0; i < largo; i++) {
+        carga[i] = (uint8_t)azar();
+        if (sin_sincronismo && carga[i] == PROTOCOLO_SINCRONISMO) carga[i] = 0;
+    }
+    if (sin_sincronismo) {
+        if (tipo == PROTOCOLO_SINCRONISMO) tipo = 0;
+        if (secuencia == PROTOCOLO_SINCRONISMO) secuencia = 0;
+    }
+    return protocolo_armar_trama(tipo, secuencia, carga, largo, salida);
+}
+
+static void probar_ida_y_vuelta(void) {
+    ProtocoloReceptor receptor;
+    uint8_t carga[PROTOCOLO_CARGA_MAXIMA];
+    uint8_t trama[PROTOCOLO_TRAMA_MAXIMA];
+
+    protocolo_inicializar(&receptor, guardar_trama, guardar_suelto);
+
+    for (uint32_t paso = 0; paso < 100000; paso++) {
+        ProtocoloEvento eventos[PROTOCOLO_EVENTOS_MAXIMO], leidos[PROTOCOLO_EVENTOS_MAXIMO];
+        uint8_t n = (uint8_t)(azar() % (PROTOCOLO_EVENTOS_MAXIMO + 1));
+        for (uint8_t i = 0; i < n; i++) {
+            eventos[i].tiempo_ms = (uint16_t)azar();
+            eventos[i].codigo = (uint8_t)azar();
+        }
+
+        uint8_t largo = protocolo_codificar_eventos(eventos, n, carga);
+        uint8_t total = protocolo_armar_trama(PROTOCOLO_TIPO_EVENTOS, (uint8_t)paso, carga, largo, trama);
+        reiniciar_entregas();
+        esperada = trama;
+        for (uint8_t i = 0; i < total; i++) protocolo_recibir(&receptor, trama[i]);
+
+        if (coincidencias != 1 || tramas_entregadas != 1) {
+            fallo("Ida y vuelta", "trama de eventos distinta", paso);
+            continue;
+        }
+        if (protocolo_decodificar_eventos(ultima_trama.carga, ultima_trama.largo, leidos) != n) {
+            fallo("Ida y vuelta", "cantidad de eventos", paso);
+        }
+        for (uint8_t i = 0; i < n; i++) {
+            if (leidos[i].tiempo_ms != eventos[i].tiempo_ms || leidos[i].codigo != eventos[i].codigo) {
+                fallo("Ida y vuelta", "evento distinto", paso);
+            }
+        }
+
+        ProtocoloTelemetria t, u;
+        memset(&t, 0, sizeof(t));
+        memset(&u, 0, sizeof(u));
+        t.tiempo_ms = azar();
+        t.ultima_secuencia = (uint8_t)azar();
+        t.eventos_pendientes = (uint8_t)azar();
+        t.tramas_aceptadas = (uint16_t)azar();
+        t.errores_crc = (uint16_t)azar();
+        t.tramas_perdidas = (uint16_t)azar();
+        t.rx_descartados = (uint16_t)azar();
+        t.tx_descartados = (uint16_t)azar();
+        t.latencia_peor_ms = (uint16_t)azar();
+        protocolo_codificar_telemetria(&t, carga);
+        if (!protocolo_decodificar_telemetria(carga, PROTOCOLO_BYTES_TELEMETRIA, &u) ||
+            memcmp(&t, &u, sizeof(t)) != 0) {
+            fallo("Ida y vuelta", "telemetría distinta", paso);
+        }
+    }
+
+    /* Restos que no llegan a un evento, largos imposibles */
+    ProtocoloEvento e[PROTOCOLO_EVENTOS_MAXIMO];
+    ProtocoloTelemetria t;
+    if (protocolo_decodificar_eventos(carga, 5, e) != 1) fallo("Ida y vuelta", "resto de evento", 0);
+    if (protocolo_armar_trama(0, 0, carga, PROTOCOLO_CARGA_MAXIMA + 1, trama) != 0) fallo("Ida y vuelta", "largo excedido", 0);
+    if (protocolo_decodificar_telemetria(carga, 17, &t)) fallo("Ida y vuelta", "telemetría corta", 0);
+
+    printf("Ida y vuelta: 100000 tramas de eventos y telemetría %s\n", errores ? "FALLO" : "OK");
+}
+
+/**
+ * @brief Tramas entre texto y basura
+ *
+ * Después de cada trama se llama protocolo_vaciar(), como hace la placa
+ * cuando la línea queda quieta: así una trama que quedó detrás de un 0xA5
+ * de la basura sale en el mismo paso.
+ * @param proporcion_sinc Cada cuántos bytes de basura uno es 0xA5 (0 = nunca)
+ * @return Tramas perdidas
+ */
+static uint32_t probar_mezcla(uint32_t proporcion_sinc, uint32_t *falsas) {
+    ProtocoloReceptor receptor;
+    uint8_t trama[PROTOCOLO_TRAMA_MAXIMA];
+    uint8_t relleno[32];
+    uint32_t perdidas = 0;
+    int errores_antes = errores;
+
+    protocolo_inicializar(&receptor, guardar_trama, guardar_suelto);
+    *falsas = 0;
+
+    for (uint32_t paso = 0; paso < TRAMAS_MEZCLA; paso++) {
+        /* Relleno: texto de la placa o basura */
+        uint32_t n_relleno = azar() % sizeof(relleno);
+        for (uint32_t i = 0; i < n_relleno; i++) {
+            if (proporcion_sinc && azar() % proporcion_sinc == 0) {
+                relleno[i] = PROTOCOLO_SINCRONISMO;
+            } else {
+                do { relleno[i] = (uint8_t)azar(); } while (relleno[i] == PROTOCOLO_SINCRONISMO);
+            }
+        }
+        uint8_t total = trama_al_azar(trama, proporcion_sinc == 0);
+
+        reiniciar_entregas();
+        for (uint32_t i = 0; i < n_relleno; i++) protocolo_recibir(&receptor, relleno[i]);
+        esperada = trama;
+        for (uint8_t i = 0; i < total; i++) protocolo_recibir(&receptor, trama[i]);
+        if (proporcion_sinc == 0 && receptor.cantidad != 0) fallo("Mezcla", "quedaron bytes guardados", paso);
+        protocolo_vaciar(&receptor);
+
+        if (coincidencias == 0) perdidas++;
+        *falsas += ajenas;
+
+        if (proporcion_sinc == 0) {
+            /* Sin 0xA5 en el relleno todo es exacto */
+            if (coincidencias != 1 || ajenas != 0) fallo("Mezcla", "trama perdida sin 0xA5 en la basura", paso);
+            if (cantidad_sueltos != n_relleno || memcmp(sueltos, relleno, n_relleno) != 0) {
+                fallo("Mezcla", "bytes sueltos distintos", paso);
+            }
+        }
+    }
+
+    if (proporcion_sinc == 0) {
+        printf("Mezcla sin 0xA5 en la basura: %u tramas, todas recuperadas y texto intacto %s\n",
+               TRAMAS_MEZCLA, errores == errores_antes ? "OK" : "FALLO");
+    }
+    return perdidas;
+}
+
+static void probar_danadas(void) {
+    ProtocoloReceptor receptor;
+    uint8_t trama[PROTOCOLO_TRAMA_MAXIMA], buena[PROTOCOLO_TRAMA_MAXIMA];
+    uint32_t aceptadas = 0, siguientes_perdidas = 0;
+
+    protocolo_inicializar(&receptor, guardar_trama, guardar_suelto);
+
+    for (uint32_t paso = 0; paso < TRAMAS_DANADAS; paso++) {
+        uint8_t total = trama_al_azar(trama, 0);
+
+        /* Ráfaga de 1 a 8 bits entre el tipo y el CRC sin tocar el largo:
+           el primero y el último se invierten, los del medio al azar */
+        uint32_t bits = 1 + azar() % 8;
+        uint32_t primero;
+        do {
+            primero = 8 + azar() % ((total - 1) * 8 - bits + 1);
+        } while (primero / 8 <= 3 && (primero + bits - 1) / 8 >= 3);
+        for (uint32_t b = 0; b < bits; b++) {
+            if (b == 0 || b == bits - 1 || (azar() & 1)) {
+                uint32_t bit = primero + b;
+                trama[bit / 8] ^= (uint8_t)(0x80 >> (bit % 8));
+            }
+        }
+
+        reiniciar_entregas();
+        esperada = trama;           // Entregarla tal cual sería aceptar el daño
+        for (uint8_t i = 0; i < total; i++) protocolo_recibir(&receptor, trama[i]);
+        if (coincidencias > 0) {
+            aceptadas++;
+            fallo("Dañadas", "se aceptó una trama con error de bits", paso);
+        }
+
+        /* La trama buena que sigue se tiene que recuperar */
+        uint8_t total_buena = trama_al_azar(buena, 0);
+        reiniciar_entregas();
+        esperada = buena;
+        for (uint8_t i = 0; i < total_buena; i++) protocolo_recibir(&receptor, buena[i]);
+        protocolo_vaciar(&receptor);
+        if (coincidencias == 0) siguientes_perdidas++;
+    }
+
+    printf("Dañadas: %u tramas con ráfagas de 1-8 bits, %u aceptadas; "
+           "%u buenas siguientes perdidas (%.3f%%) %s\n",
+           TRAMAS_DANADAS, aceptadas, siguientes_perdidas,
+           100.0 * siguientes_perdidas / TRAMAS_DANADAS, aceptadas ? "FALLO" : "OK");
+    if (siguientes_perdidas > TRAMAS_DANADAS / 100) fallo("Dañadas", "resincronización lenta", 0);
+}
+
+static void probar_ruido(void) {
+    ProtocoloReceptor receptor;
+    uint32_t alimentados = 0;
+
+    protocolo_inicializar(&receptor, guardar_trama, guardar_suelto);
+    reiniciar_entregas();
+
+    for (uint32_t paso = 0; paso < BYTES_RUIDO; paso++) {
+        /* Ruido con muchos 0xA5 y largos chicos para que aparezcan candidatos */
+        uint32_t r = azar();
+        uint8_t byte = (r & 3) == 0 ? PROTOCOLO_SINCRONISMO : (r & 4) ? (uint8_t)((r >> 8) % 8) : (uint8_t)(r >> 8);
+        protocolo_recibir(&receptor, byte);
+        alimentados++;
+
+        if (receptor.cantidad >= PROTOCOLO_TRAMA_MAXIMA) fallo("Ruido", "receptor desbordado", paso);
+        if (azar() % 1000 == 0) protocolo_vaciar(&receptor);
+
+        uint32_t contados = receptor.sueltos + bytes_en_tramas + receptor.errores + receptor.cantidad;
+        if (contados != alimentados) {
+            fallo("Ruido", "bytes sin contabilizar", paso);
+            break;
+        }
+    }
+    protocolo_vaciar(&receptor);
+
+    printf("Ruido: %u bytes, %u tramas casuales, %u errores, %u sueltos, ninguno sin contar %s\n",
+           alimentados, receptor.tramas, receptor.errores, receptor.sueltos,
+           receptor.cantidad == 0 ? "OK" : "FALLO");
+}
+
+static int verificar(void) {
+    uint32_t falsas;
+
+    printf("Semilla %u\n", estado_azar);
+    probar_ida_y_vuelta();
+    probar_mezcla(0, &falsas);
+
+    uint32_t perdidas = probar_mezcla(4, &falsas);
+    printf("Mezcla con basura cargada de 0xA5: %u tramas, %u perdidas (%.3f%%), %u falsas aceptadas %s\n",
+           TRAMAS_MEZCLA, perdidas, 100.0 * perdidas / TRAMAS_MEZCLA, falsas,
+           perdidas <= TRAMAS_MEZCLA / 100 ? "OK" : "FALLO");
+    if (perdidas > TRAMAS_MEZCLA / 100) errores++;
+
+    probar_danadas();
+    probar_ruido();
+
+    printf("\n%s\n", errores ? "FALLO" : "OK: ida y vuelta, resincronización, CRC y conteo");
+    return errores ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc >= 2 && strcmp(argv[1], "--verificar") == 0) {
+        if (argc >= 3) {
+            estado_azar = (uint32_t)strtoul(argv[2], NULL, 0);
+            if (estado_azar == 0) estado_azar = 1;
+        }
+        return verificar();
+    }
+    if (argc >= 2 && strcmp(argv[1], "--leer") == 0) {
+        return leer();
+    }
+    if (argc >= 3 && strcmp(argv[1], "--enviar") == 0) {
+        uint16_t paso_ms = 50;
+        uint8_t grupo = 4;
+        for (int i = 3; i + 1 < argc; i += 2) {
+            if (strcmp(argv[i], "--paso") == 0) paso_ms = (uint16_t)atoi(argv[i + 1]);
+            if (strcmp(argv[i], "--grupo") == 0) grupo = (uint8_t)atoi(argv[i + 1]);
+        }
+        if (grupo == 0 || grupo > PROTOCOLO_EVENTOS_MAXIMO) grupo = PROTOCOLO_EVENTOS_MAXIMO;
+        return enviar(argv[2], paso_ms, grupo);
+    }
+
+    fprintf(stderr, "Uso: %s --enviar <letras> [--paso ms] [--grupo n] | --leer | --verificar [semilla]\n", argv[0]);
+    return 2;
+}
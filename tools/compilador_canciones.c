@@ -0,0 +1,568 @@
+/**
+ * @file compilador_canciones.c
+ * @brief Compilador (PC) de canciones de texto o MIDI al formato de bytes
+ *        de melodias_dac.h.
+ *
+ * Formato de texto (una o varias canciones por archivo, '#' comenta):
+ *
+ *   cancion melodia_fondo      # nombre del arreglo en C
+ *   tempo 120                  # negras por minuto (30..255)
+ *   envolvente legato          # legato | percusiva | suave | efecto
+ *   forma cuadrada25           # triangular | seno | sierra | cuadrada50 |
+ *                              #   cuadrada25 | cuadrada12 | ruido
+ *   MI_5/8 MI_5/8 SILENCIO/8   # NOTA/figura: 1 redonda, 2 blanca, 4 negra,
+ *   SI_3/4.                    #   8 corchea, 16 semicorchea; '.' = puntillo
+ *   loop                       # marca de loop (lo anterior es intro)
+ *   fin
+ *
+ * Las notas son los mismos nombres de melodias_dac.h (DO_3 .. SI_5).
+ * Una duración que no tiene código propio (redonda, blanca con puntillo)
+ * se parte en un evento más ligaduras.
+ *
+ * Compilar: gcc -O2 -Iinclude -o compilador_canciones tools/compilador_canciones.c
+ * Uso:      ./compilador_canciones tools/canciones.txt > src/canciones.c
+ *           ./compilador_canciones --midi tema.mid nombre > tema.c
+ *           ./compilador_canciones --verificar tools/canciones.txt
+ *
+ * --verificar decodifica cada canción como lo hace el firmware, la compara
+ * con la fuente y muestra el tamaño contra el formato anterior (4 bytes
+ * por nota). Devuelve 1 si algo no coincide.
+ *
+ * @date Noviembre 2025
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "melodias_dac.h"
+
+/* === LÍMITES === */
+#define MAX_CANCIONES       32
+#define MAX_ELEMENTOS       2048
+#define MAX_BYTES           (MAX_ELEMENTOS * 4)
+#define MAX_NOMBRE          64
+#define TEMPO_POR_DEFECTO   120
+
+/* === NOTAS (mismo orden que CANCION_LISTA_NOTAS) === */
+#define NOMBRE_NOTA(n, arg) #n,
+static const char *nombres_notas[CANCION_NOTAS] = { CANCION_LISTA_NOTAS(NOMBRE_NOTA, 0) };
+
+#define MIDI_DO_3           48      // Nota MIDI del índice 1
+#define MIDI_SI_5           83
+
+static const char *nombres_envolventes[MELODIAS_ENVOLVENTES] = {
+    "legato", "percusiva", "suave", "efecto"
+};
+
+static const char *nombres_formas[MELODIAS_FORMAS] = {
+    "triangular", "seno", "sierra", "cuadrada50", "cuadrada25", "cuadrada12", "ruido"
+};
+
+/* === REPRESENTACIÓN INTERMEDIA === */
+typedef enum {
+    ELEMENTO_NOTA,
+    ELEMENTO_ENVOLVENTE,
+    ELEMENTO_FORMA,
+    ELEMENTO_MARCA
+} TipoElemento;
+
+typedef struct {
+    uint8_t tipo;
+    uint8_t valor;          // Índice de nota, envolvente o forma
+    uint16_t semicorcheas;  // Solo notas
+} Elemento;
+
+typedef struct {
+    char nombre[MAX_NOMBRE];
+    uint8_t tempo;
+    uint8_t envolvente;
+    Elemento elementos[MAX_ELEMENTOS];
+    int cantidad;
+} Cancion;
+
+static Cancion canciones[MAX_CANCIONES];
+static int cantidad_canciones = 0;
+
+static void error_fuente(const char *archivo, int linea, const char *mensaje, const char *detalle) {
+    fprintf(stderr, "%s:%d: %s '%s'\n", archivo, linea, mensaje, detalle);
+    exit(1);
+}
+
+static void agregar(Cancion *c, uint8_t tipo, uint8_t valor, uint16_t semicorcheas) {
+    if (c->cantidad >= MAX_ELEMENTOS) {
+        fprintf(stderr, "%s: demasiados eventos\n", c->nombre);
+        exit(1);
+    }
+    c->elementos[c->cantidad].tipo = tipo;
+    c->elementos[c->cantidad].valor = valor;
+    c->elementos[c->cantidad].semicorcheas = semicorcheas;
+    c->cantidad++;
+}
+
+static Cancion *nueva_cancion(const char *nombre) {
+    if (cantidad_canciones >= MAX_CANCIONES) {
+        fprintf(stderr, "Demasiadas canciones\n");
+        exit(1);
+    }
+    Cancion *c = &canciones[cantidad_canciones++];
+    memset(c, 0, sizeof(*c));
+    snprintf(c->nombre, sizeof(c->nombre), "%s", nombre);
+    c->tempo = TEMPO_POR_DEFECTO;
+    c->envolvente = MELODIAS_ENV_LEGATO;
+    return c;
+}
+
+/* ========================== CODIFICACIÓN ================================= */
+
+/**
+ * @brief Convierte una canción a bytes. Devuelve la cantidad de bytes.
+ */
+static int codificar(const Cancion *c, uint8_t *salida) {
+    int n = 0;
+
+    salida[n++] = c->tempo;
+    salida[n++] = c->envolvente;
+
+    for (int i = 0; i < c->cantidad; i++) {
+        const Elemento *e = &c->elementos[i];
+
+        if (e->tipo == ELEMENTO_ENVOLVENTE) {
+            salida[n++] = (uint8_t)(CANCION_ENVOLVENTE + e->valor);
+        } else if (e->tipo == ELEMENTO_FORMA) {
+            salida[n++] = (uint8_t)(CANCION_FORMA + e->valor);
+        } else if (e->tipo == ELEMENTO_MARCA) {
+            salida[n++] = CANCION_MARCA_LOOP;
+        } else {
+            // El código más largo que entra; el resto va en ligaduras de hasta 16
+            int codigo = CANCION_DURACIONES - 1;
+            while (CANCION_SEMICORCHEAS(codigo) > e->semicorcheas) codigo--;
+            salida[n++] = CANCION_EVENTO(e->valor, codigo);
+
+            int resto = e->semicorcheas - CANCION_SEMICORCHEAS(codigo);
+            while (resto > 0) {
+                int parte = resto > 16 ? 16 : resto;
+                salida[n++] = (uint8_t)(CANCION_LIGAR + parte - 1);
+                resto -= parte;
+            }
+        }
+    }
+    salida[n++] = CANCION_FIN;
+    return n;
+}
+
+/**
+ * @brief Decodifica bytes con las mismas reglas que el secuenciador.
+ * @return Bytes leídos, o -1 si aparece un código inválido
+ */
+static int decodificar(const uint8_t *bytes, int largo, Cancion *c) {
+    int i = CANCION_BYTES_CABECERA;
+
+    c->tempo = bytes[0];
+    c->envolvente = bytes[1];
+    c->cantidad = 0;
+
+    while (i < largo) {
+        uint8_t b = bytes[i++];
+        if (b < CANCION_EVENTOS) {
+            uint8_t nota = b % CANCION_NOTAS;
+            uint16_t semis = CANCION_SEMICORCHEAS(b / CANCION_NOTAS);
+            while (i < largo && bytes[i] >= CANCION_LIGAR && bytes[i] < CANCION_LIGAR + 16) {
+                semis += bytes[i++] - CANCION_LIGAR + 1;
+            }
+            agregar(c, ELEMENTO_NOTA, nota, semis);
+        } else if (b >= CANCION_ENVOLVENTE && b < CANCION_ENVOLVENTE + MELODIAS_ENVOLVENTES) {
+            agregar(c, ELEMENTO_ENVOLVENTE, (uint8_t)(b - CANCION_ENVOLVENTE), 0);
+        } else if (b >= CANCION_FORMA && b < CANCION_FORMA + MELODIAS_FORMAS) {
+            agregar(c, ELEMENTO_FORMA, (uint8_t)(b - CANCION_FORMA), 0);
+        } else if (b == CANCION_MARCA_LOOP) {
+            agregar(c, ELEMENTO_MARCA, 0, 0);
+        } else if (b == CANCION_FIN) {
+            return i;
+        } else {
+            return -1;  // Ligadura suelta o código reservado
+        }
+    }
+    return -1;
+}
+
+/* ========================== FUENTE DE TEXTO ============================== */
+
+static int buscar_nota(const char *nombre) {
+    for (int i = 0; i < CANCION_NOTAS; i++) {
+        if (strcmp(nombres_notas[i], nombre) == 0) return i;
+    }
+    return -1;
+}
+
+static int buscar_envolvente(const char *nombre) {
+    for (int i = 0; i < MELODIAS_ENVOLVENTES; i++) {
+        if (strcmp(nombres_envolventes[i], nombre) == 0) return i;
+    }
+    return -1;
+}
+
+static int buscar_forma(const char *nombre) {
+    for (int i = 0; i < MELODIAS_FORMAS; i++) {
+        if (strcmp(nombres_formas[i], nombre) == 0) return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief Interpreta "NOTA/figura[.]" y la agrega a la canción.
+ */
+static void leer_nota(Cancion *c, char *token, const char *archivo, int linea) {
+    char *barra = strchr(token, '/');
+    if (barra == NULL) error_fuente(archivo, linea, "falta la figura en", token);
+    *barra = '\0';
+
+    int nota = buscar_nota(token);
+    if (nota < 0) error_fuente(archivo, linea, "nota desconocida", token);
+
+    char *fin;
+    long figura = strtol(barra + 1, &fin, 10);
+    if (figura != 1 && figura != 2 && figura != 4 && figura != 8 && figura != 16) {
+        error_fuente(archivo, linea, "figura inválida", barra + 1);
+    }
+    int semis = (int)(16 / figura);
+    if (*fin == '.') {
+        if (semis < 2) error_fuente(archivo, linea, "puntillo sin semicorchea entera en", token);
+        semis += semis / 2;
+        fin++;
+    }
+    if (*fin != '\0') error_fuente(archivo, linea, "sobra texto en", fin);
+
+    agregar(c, ELEMENTO_NOTA, (uint8_t)nota, (uint16_t)semis);
+}
+
+static void leer_texto(const char *archivo) {
+    FILE *f = fopen(archivo, "r");
+    if (f == NULL) {
+        perror(archivo);
+        exit(1);
+    }
+
+    char renglon[512];
+    int linea = 0;
+    Cancion *actual = NULL;
+
+    while (fgets(renglon, sizeof(renglon), f) != NULL) {
+        linea++;
+        char *comentario = strchr(renglon, '#');
+        if (comentario != NULL) *comentario = '\0';
+
+        for (char *token = strtok(renglon, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n")) {
+            if (strcmp(token, "cancion") == 0) {
+                char *nombre = strtok(NULL, " \t\r\n");
+                if (nombre == NULL) error_fuente(archivo, linea, "falta el nombre de", token);
+                actual = nueva_cancion(nombre);
+                continue;
+            }
+            if (actual == NULL) error_fuente(archivo, linea, "fuera de una canción:", token);
+
+            if (strcmp(token, "fin") == 0) {
+                actual = NULL;
+            } else if (strcmp(token, "tempo") == 0) {
+                char *valor = strtok(NULL, " \t\r\n");
+                long tempo = valor ? strtol(valor, NULL, 10) : 0;
+                if (tempo < 30 || tempo > 255) error_fuente(archivo, linea, "tempo fuera de 30..255:", valor ? valor : "");
+                actual->tempo = (uint8_t)tempo;
+            } else if (strcmp(token, "envolvente") == 0) {
+                char *valor = strtok(NULL, " \t\r\n");
+                int k = valor ? buscar_envolvente(valor) : -1;
+                if (k < 0) error_fuente(archivo, linea, "envolvente desconocida", valor ? valor : "");
+                if (actual->cantidad == 0) {
+                    actual->envolvente = (uint8_t)k;   // Antes de la primera nota: cabecera
+                } else {
+                    agregar(actual, ELEMENTO_ENVOLVENTE, (uint8_t)k, 0);
+                }
+            } else if (strcmp(token, "forma") == 0) {
+                char *valor = strtok(NULL, " \t\r\n");
+                int k = valor ? buscar_forma(valor) : -1;
+                if (k < 0) error_fuente(archivo, linea, "forma desconocida", valor ? valor : "");
+                agregar(actual, ELEMENTO_FORMA, (uint8_t)k, 0);   // No tiene lugar en la cabecera
+            } else if (strcmp(token, "loop") == 0) {
+                agregar(actual, ELEMENTO_MARCA, 0, 0);
+            } else {
+                leer_nota(actual, token, archivo, linea);
+            }
+        }
+    }
+    fclose(f);
+
+    if (actual != NULL) {
+        fprintf(stderr, "%s: falta 'fin' en %s\n", archivo, actual->nombre);
+        exit(1);
+    }
+}
+
+/* ============================== MIDI ===================================== */
+
+typedef struct {
+    uint32_t tick;
+    uint8_t nota;
+    uint8_t encendida;
+} EventoMidi;
+
+static EventoMidi eventos_midi[MAX_ELEMENTOS * 2];
+static int cantidad_eventos_midi = 0;
+
+static uint32_t leer_be(const uint8_t *p, int bytes) {
+    uint32_t v = 0;
+    for (int i = 0; i < bytes; i++) v = (v << 8) | p[i];
+    return v;
+}
+
+static uint32_t leer_variable(const uint8_t **p, const uint8_t *fin) {
+    uint32_t v = 0;
+    while (*p < fin) {
+        uint8_t b = *(*p)++;
+        v = (v << 7) | (b & 0x7F);
+        if (!(b & 0x80)) break;
+    }
+    return v;
+}
+
+static int comparar_eventos(const void *a, const void *b) {
+    const EventoMidi *x = a, *y = b;
+    if (x->tick != y->tick) return x->tick < y->tick ? -1 : 1;
+    return (int)x->encendida - (int)y->encendida;   // Apagados primero
+}
+
+/**
+ * @brief Lee las notas de una pista (todas menos el canal 10 de percusión).
+ * @return Microsegundos por negra si la pista trae un cambio de tempo, o 0
+ */
+static uint32_t leer_pista(const uint8_t *p, const uint8_t *fin) {
+    uint32_t tick = 0, us_por_negra = 0;
+    uint8_t estado = 0;
+
+    while (p < fin) {
+        tick += leer_variable(&p, fin);
+        if (p >= fin) break;
+
+        if (*p & 0x80) estado = *p++;   // Si no, running status
+
+        if (estado == 0xFF) {
+            uint8_t tipo = *p++;
+            uint32_t largo = leer_variable(&p, fin);
+            if (tipo == 0x51 && largo == 3 && us_por_negra == 0) us_por_negra = leer_be(p, 3);
+            if (tipo == 0x2F) break;
+            p += largo;
+            estado = 0;
+        } else if (estado == 0xF0 || estado == 0xF7) {
+            p += leer_variable(&p, fin);
+            estado = 0;
+        } else {
+            uint8_t tipo = estado & 0xF0, canal = estado & 0x0F;
+            if (tipo == 0xC0 || tipo == 0xD0) {
+                p += 1;
+            } else {
+                uint8_t nota = p[0], velocidad = p[1];
+                p += 2;
+                if ((tipo == 0x90 || tipo == 0x80) && canal != 9 &&
+                    cantidad_eventos_midi < (int)(sizeof(eventos_midi) / sizeof(eventos_midi[0]))) {
+                    EventoMidi *e = &eventos_midi[cantidad_eventos_midi++];
+                    e->tick = tick;
+                    e->nota = nota;
+                    e->encendida = (tipo == 0x90 && velocidad > 0);
+                }
+            }
+        }
+    }
+    return us_por_negra;
+}
+
+/**
+ * @brief Índice de nota del formato, llevando la nota MIDI al rango por octavas.
+ */
+static uint8_t nota_desde_midi(int midi) {
+    while (midi < MIDI_DO_3) midi += 12;
+    while (midi > MIDI_SI_5) midi -= 12;
+    return (uint8_t)(midi - MIDI_DO_3 + 1);
+}
+
+/**
+ * @brief Reduce un MIDI a una voz (la nota más aguda que esté sonando),
+ *        cuantizada a semicorcheas.
+ */
+static void leer_midi(const char *archivo, const char *nombre) {
+    FILE *f = fopen(archivo, "rb");
+    if (f == NULL) {
+        perror(archivo);
+        exit(1);
+    }
+    static uint8_t datos[1 << 20];
+    size_t largo = fread(datos, 1, sizeof(datos), f);
+    fclose(f);
+
+    if (largo < 14 || memcmp(datos, "MThd", 4) != 0) {
+        fprintf(stderr, "%s: no es un archivo MIDI\n", archivo);
+        exit(1);
+    }
+    uint32_t pistas = leer_be(datos + 10, 2);
+    uint32_t division = leer_be(datos + 12, 2);
+    if (division & 0x8000 || division < 4) {
+        fprintf(stderr, "%s: división SMPTE o demasiado chica\n", archivo);
+        exit(1);
+    }
+
+    uint32_t us_por_negra = 500000;     // 120 negras por minuto si no dice nada
+    const uint8_t *p = datos + 8 + leer_be(datos + 4, 4);
+    const uint8_t *fin_archivo = datos + largo;
+    for (uint32_t t = 0; t < pistas && p + 8 <= fin_archivo; t++) {
+        uint32_t largo_pista = leer_be(p + 4, 4);
+        const uint8_t *fin_pista = p + 8 + largo_pista;
+        if (fin_pista > fin_archivo) fin_pista = fin_archivo;
+        if (memcmp(p, "MTrk", 4) == 0) {
+            uint32_t tempo = leer_pista(p + 8, fin_pista);
+            if (tempo != 0) us_por_negra = tempo;
+        }
+        p = fin_pista;
+    }
+    qsort(eventos_midi, cantidad_eventos_midi, sizeof(EventoMidi), comparar_eventos);
+
+    Cancion *c = nueva_cancion(nombre);
+    long tempo = (long)((60000000UL + us_por_negra / 2) / us_por_negra);
+    c->tempo = (uint8_t)(tempo < 30 ? 30 : tempo > 255 ? 255 : tempo);
+
+    uint32_t ticks_semicorchea = division / 4;
+    uint8_t activas[128] = {0};
+    int sonando = -1;                   // Nota MIDI en curso (-1 = silencio)
+    uint32_t inicio = 0;                // En semicorcheas
+
+    for (int i = 0; i < cantidad_eventos_midi; ) {
+        uint32_t tick = eventos_midi[i].tick;
+        for (; i < cantidad_eventos_midi && eventos_midi[i].tick == tick; i++) {
+            uint8_t n = eventos_midi[i].nota & 0x7F;
+            if (eventos_midi[i].encendida) {
+                activas[n]++;
+            } else if (activas[n] > 0) {
+                activas[n]--;
+            }
+        }
+
+        int aguda = -1;
+        for (int n = 127; n >= 0; n--) {
+            if (activas[n]) {
+                aguda = n;
+                break;
+            }
+        }
+        if (aguda == sonando) continue;
+
+        uint32_t ahora = (tick + ticks_semicorchea / 2) / ticks_semicorchea;
+        if (ahora > inicio) {
+            uint8_t nota = sonando < 0 ? 0 : nota_desde_midi(sonando);
+            // Silencio inicial del archivo: se descarta
+            if (c->cantidad > 0 || nota != 0) {
+                agregar(c, ELEMENTO_NOTA, nota, (uint16_t)(ahora - inicio));
+            }
+            inicio = ahora;
+        }
+        sonando = aguda;
+    }
+
+    if (c->cantidad == 0) {
+        fprintf(stderr, "%s: no tiene notas\n", archivo);
+        exit(1);
+    }
+}
+
+/* ============================= SALIDA ==================================== */
+
+static int contar_notas(const Cancion *c) {
+    int notas = 0;
+    for (int i = 0; i < c->cantidad; i++) {
+        if (c->elementos[i].tipo == ELEMENTO_NOTA) notas++;
+    }
+    return notas;
+}
+
+static void emitir_c(const char *fuente, const char *argumentos) {
+    uint8_t bytes[MAX_BYTES];
+
+    printf("/**\n");
+    printf(" * @file canciones.c\n");
+    printf(" * @brief Canciones compiladas al formato de bytes de melodias_dac.h\n");
+    printf(" *\n");
+    printf(" * Generado por tools/compilador_canciones.c desde %s. No editar a mano:\n", fuente);
+    printf(" *   ./compilador_canciones %s\n", argumentos);
+    printf(" *\n");
+    printf(" * @date Noviembre 2025\n");
+    printf(" */\n\n");
+    printf("#include \"melodias_dac.h\"\n");
+
+    for (int s = 0; s < cantidad_canciones; s++) {
+        const Cancion *c = &canciones[s];
+        int n = codificar(c, bytes);
+
+        printf("\n// %s: %d notas, %d bytes (%d como Nota[])\n",
+               c->nombre, contar_notas(c), n, (contar_notas(c) + 1) * 4);
+        printf("const uint8_t %s[] = {\n", c->nombre);
+        printf("    %3u, %u,  // tempo, envolvente\n   ", bytes[0], bytes[1]);
+        for (int i = CANCION_BYTES_CABECERA; i < n; i++) {
+            printf(" 0x%02X,", bytes[i]);
+            if ((i - CANCION_BYTES_CABECERA) % 12 == 11 && i + 1 < n) printf("\n   ");
+        }
+        printf("\n};\n");
+    }
+}
+
+static int verificar(void) {
+    static Cancion decodificada;
+    uint8_t bytes[MAX_BYTES];
+    int errores = 0, total = 0, total_anterior = 0;
+
+    for (int s = 0; s < cantidad_canciones; s++) {
+        const Cancion *c = &canciones[s];
+        int n = codificar(c, bytes);
+        int leidos = decodificar(bytes, n, &decodificada);
+
+        int iguales = (leidos == n && decodificada.tempo == c->tempo &&
+                       decodificada.envolvente == c->envolvente &&
+                       decodificada.cantidad == c->cantidad &&
+                       memcmp(decodificada.elementos, c->elementos,
+                              (size_t)c->cantidad * sizeof(Elemento)) == 0);
+
+        uint32_t semis = 0;
+        for (int i = 0; i < c->cantidad; i++) semis += c->elementos[i].semicorcheas;
+        int anterior = (contar_notas(c) + 1) * 4;
+
+        printf("%-24s %4d bytes (Nota[]: %5d) %6u ms a %3u/min %s\n",
+               c->nombre, n, anterior, semis * (15000u / c->tempo), c->tempo,
+               iguales ? "OK" : "FALLO");
+        if (!iguales) errores++;
+        total += n;
+        total_anterior += anterior;
+    }
+
+    printf("Total: %d bytes contra %d (%.0f%%)\n", total, total_anterior,
+           total_anterior ? 100.0 * total / total_anterior : 0.0);
+    return errores ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc == 3 && strcmp(argv[1], "--verificar") == 0) {
+        leer_texto(argv[2]);
+        return verificar();
+    }
+    if (argc == 4 && strcmp(argv[1], "--midi") == 0) {
+        char argumentos[256];
+        snprintf(argumentos, sizeof(argumentos), "--midi %s %s", argv[2], argv[3]);
+        leer_midi(argv[2], argv[3]);
+        emitir_c(argv[2], argumentos);
+        return 0;
+    }
+    if (argc == 2) {
+        char argumentos[256];
+        snprintf(argumentos, sizeof(argumentos), "%s > src/canciones.c", argv[1]);
+        leer_texto(argv[1]);
+        emitir_c(argv[1], argumentos);
+        return 0;
+    }
+
+    fprintf(stderr, "Uso: %s canciones.txt | --midi tema.mid nombre | --verificar canciones.txt\n", argv[0]);
+    return 1;
+}
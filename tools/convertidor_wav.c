@@ -0,0 +1,279 @@
+/**
+ * @file convertidor_wav.c
+ * @brief Convertidor (PC) de archivos WAV a clips PCM para melodias_clip_*().
+ *
+ * Lee WAV PCM de 8 o 16 bits, mono o estéreo, a cualquier frecuencia;
+ * mezcla a mono, remuestrea (interpolación lineal) a
+ * MELODIAS_FRECUENCIA_MUESTREO_HZ y cuantiza al formato del clip:
+ *
+ *   archivo.wav      CLIP_PCM_8:  1 byte por muestra (bits 9..2 del DAC)
+ *   archivo.wav:10   CLIP_PCM_10: 2 bytes por muestra (valor << 6, como DACR)
+ *
+ * El nombre del clip sale del archivo: golpe.wav -> clip_golpe, CLIP_GOLPE.
+ *
+ * Compilar: gcc -O2 -Iinclude -o convertidor_wav tools/convertidor_wav.c -lm
+ * Uso:      ./convertidor_wav tools/clips/golpe.wav [otro.wav:10 ...]
+ *
+ * Escribe include/clips_pcm.h y src/clips_pcm.c (se corre desde la raíz
+ * del repositorio) y muestra duración y bytes de cada clip.
+ *
+ * @date Noviembre 2025
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include "melodias_dac.h"
+
+/* === LÍMITES === */
+#define MAX_CLIPS           16
+#define MAX_NOMBRE          48
+#define MAX_SEGUNDOS        2       // Lo que entra en una cadena de LLI del firmware
+
+#define ARCHIVO_CABECERA    "include/clips_pcm.h"
+#define ARCHIVO_FUENTE      "src/clips_pcm.c"
+
+typedef struct {
+    char archivo[256];
+    char nombre[MAX_NOMBRE];
+    uint8_t formato;
+    uint32_t cantidad;
+    uint16_t *valores;      // 0..1023, ya remuestreados
+} Clip;
+
+static Clip clips[MAX_CLIPS];
+static int cantidad_clips = 0;
+
+static void error_archivo(const char *archivo, const char *mensaje) {
+    fprintf(stderr, "%s: %s\n", archivo, mensaje);
+    exit(1);
+}
+
+static uint32_t leer_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t leer_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/* ============================ LECTURA WAV ================================= */
+
+/**
+ * @brief Lee un WAV y deja las muestras mono en -1.0..1.0.
+ * @return Cantidad de muestras; la frecuencia original queda en *frecuencia
+ */
+static uint32_t leer_wav(const char *archivo, float **muestras, uint32_t *frecuencia) {
+    FILE *f = fopen(archivo, "rb");
+    if (f == NULL) error_archivo(archivo, "no se puede abrir");
+
+    fseek(f, 0, SEEK_END);
+    long largo = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *datos = malloc((size_t)largo);
+    if (datos == NULL || fread(datos, 1, (size_t)largo, f) != (size_t)largo) {
+        error_archivo(archivo, "no se pudo leer");
+    }
+    fclose(f);
+
+    if (largo < 12 || memcmp(datos, "RIFF", 4) != 0 || memcmp(datos + 8, "WAVE", 4) != 0) {
+        error_archivo(archivo, "no es un WAV");
+    }
+
+    uint16_t canales = 0, bits = 0;
+    const uint8_t *pcm = NULL;
+    uint32_t bytes_pcm = 0;
+    long pos = 12;
+
+    while (pos + 8 <= largo) {
+        uint32_t tamano = leer_u32(datos + pos + 4);
+        const uint8_t *contenido = datos + pos + 8;
+        if (pos + 8 + (long)tamano > largo) tamano = (uint32_t)(largo - pos - 8);
+
+        if (memcmp(datos + pos, "fmt ", 4) == 0 && tamano >= 16) {
+            if (leer_u16(contenido) != 1) error_archivo(archivo, "solo se admite PCM sin compresión");
+            canales = leer_u16(contenido + 2);
+            *frecuencia = leer_u32(contenido + 4);
+            bits = leer_u16(contenido + 14);
+        } else if (memcmp(datos + pos, "data", 4) == 0) {
+            pcm = contenido;
+            bytes_pcm = tamano;
+        }
+        pos += 8 + tamano + (tamano & 1);
+    }
+
+    if (pcm == NULL || canales == 0 || *frecuencia == 0) error_archivo(archivo, "falta fmt o data");
+    if (bits != 8 && bits != 16) error_archivo(archivo, "solo 8 o 16 bits por muestra");
+
+    uint32_t bytes_cuadro = canales * (bits / 8);
+    uint32_t cuadros = bytes_pcm / bytes_cuadro;
+    *muestras = malloc(cuadros * sizeof(float));
+
+    for (uint32_t i = 0; i < cuadros; i++) {
+        float suma = 0.0f;
+        for (uint16_t c = 0; c < canales; c++) {
+            const uint8_t *p = pcm + i * bytes_cuadro + c * (bits / 8);
+            suma += (bits == 8) ? (p[0] - 128) / 128.0f : (int16_t)leer_u16(p) / 32768.0f;
+        }
+        (*muestras)[i] = suma / canales;
+    }
+
+    free(datos);
+    return cuadros;
+}
+
+/* ============================ CONVERSIÓN ================================== */
+
+static void agregar_clip(const char *argumento) {
+    if (cantidad_clips >= MAX_CLIPS) {
+        fprintf(stderr, "Demasiados clips\n");
+        exit(1);
+    }
+    Clip *c = &clips[cantidad_clips++];
+
+    snprintf(c->archivo, sizeof(c->archivo), "%s", argumento);
+    c->formato = CLIP_PCM_8;
+    char *sufijo = strrchr(c->archivo, ':');
+    if (sufijo != NULL && strcmp(sufijo, ":10") == 0) {
+        *sufijo = '\0';
+        c->formato = CLIP_PCM_10;
+    }
+
+    // Nombre: archivo sin carpeta ni extensión, en minúsculas y sin símbolos
+    const char *base = strrchr(c->archivo, '/');
+    base = base ? base + 1 : c->archivo;
+    int n = 0;
+    for (const char *p = base; *p && *p != '.' && n < MAX_NOMBRE - 1; p++) {
+        c->nombre[n++] = isalnum((unsigned char)*p) ? (char)tolower((unsigned char)*p) : '_';
+    }
+    c->nombre[n] = '\0';
+
+    float *origen;
+    uint32_t frecuencia = 0;
+    uint32_t cuadros = leer_wav(c->archivo, &origen, &frecuencia);
+
+    c->cantidad = (uint32_t)((uint64_t)cuadros * MELODIAS_FRECUENCIA_MUESTREO_HZ / frecuencia);
+    if (c->cantidad == 0) error_archivo(c->archivo, "clip vacío");
+    if (c->cantidad > MAX_SEGUNDOS * MELODIAS_FRECUENCIA_MUESTREO_HZ) {
+        error_archivo(c->archivo, "más largo que lo que reproduce el firmware (2 s)");
+    }
+
+    c->valores = malloc(c->cantidad * sizeof(uint16_t));
+    for (uint32_t i = 0; i < c->cantidad; i++) {
+        double t = (double)i * frecuencia / MELODIAS_FRECUENCIA_MUESTREO_HZ;
+        uint32_t k = (uint32_t)t;
+        float fraccion = (float)(t - k);
+        float a = origen[k];
+        float b = (k + 1 < cuadros) ? origen[k + 1] : a;
+        float v = a + (b - a) * fraccion;
+
+        long valor = lroundf(v * 511.5f + 511.5f);
+        if (valor < 0) valor = 0;
+        if (valor > 1023) valor = 1023;
+        // En 8 bits se guarda lo que el DAC va a recibir
+        c->valores[i] = (c->formato == CLIP_PCM_8) ? (uint16_t)(valor & ~3L) : (uint16_t)valor;
+    }
+    free(origen);
+}
+
+/* ============================ SALIDA ====================================== */
+
+static void emitir_cabecera(const char *argumentos) {
+    FILE *f = fopen(ARCHIVO_CABECERA, "w");
+    if (f == NULL) error_archivo(ARCHIVO_CABECERA, "no se puede escribir");
+
+    fprintf(f, "/**\n");
+    fprintf(f, " * @file clips_pcm.h\n");
+    fprintf(f, " * @brief Índice de los clips PCM para melodias_clip_reproducir()\n");
+    fprintf(f, " *\n");
+    fprintf(f, " * Generado por tools/convertidor_wav.c. No editar a mano:\n");
+    fprintf(f, " *   ./convertidor_wav %s\n", argumentos);
+    fprintf(f, " *\n");
+    fprintf(f, " * @date Noviembre 2025\n");
+    fprintf(f, " */\n\n");
+    fprintf(f, "#ifndef CLIPS_PCM_H\n#define CLIPS_PCM_H\n\n");
+    fprintf(f, "#include \"melodias_dac.h\"\n\n");
+    fprintf(f, "/* === ÍNDICES EN clips_pcm[] === */\n");
+    for (int i = 0; i < cantidad_clips; i++) {
+        char mayusculas[MAX_NOMBRE];
+        int n = 0;
+        for (; clips[i].nombre[n]; n++) mayusculas[n] = (char)toupper((unsigned char)clips[i].nombre[n]);
+        mayusculas[n] = '\0';
+        fprintf(f, "#define CLIP_%-20s %d\n", mayusculas, i);
+    }
+    fprintf(f, "#define CLIPS_PCM_CANTIDAD        %d\n\n", cantidad_clips);
+    fprintf(f, "extern const ClipPCM clips_pcm[CLIPS_PCM_CANTIDAD];\n\n");
+    fprintf(f, "#endif // CLIPS_PCM_H\n");
+    fclose(f);
+}
+
+static void emitir_fuente(const char *argumentos) {
+    FILE *f = fopen(ARCHIVO_FUENTE, "w");
+    if (f == NULL) error_archivo(ARCHIVO_FUENTE, "no se puede escribir");
+
+    fprintf(f, "/**\n");
+    fprintf(f, " * @file clips_pcm.c\n");
+    fprintf(f, " * @brief Clips PCM a %d Hz, en flash, para melodias_clip_reproducir()\n",
+            MELODIAS_FRECUENCIA_MUESTREO_HZ);
+    fprintf(f, " *\n");
+    fprintf(f, " * Generado por tools/convertidor_wav.c. No editar a mano:\n");
+    fprintf(f, " *   ./convertidor_wav %s\n", argumentos);
+    fprintf(f, " *\n");
+    fprintf(f, " * @date Noviembre 2025\n");
+    fprintf(f, " */\n\n");
+    fprintf(f, "#include \"clips_pcm.h\"\n");
+
+    for (int i = 0; i < cantidad_clips; i++) {
+        const Clip *c = &clips[i];
+        int ocho = (c->formato == CLIP_PCM_8);
+        fprintf(f, "\n// %s: %u muestras (%u ms), %u bytes\n", c->nombre, c->cantidad,
+                c->cantidad * 1000 / MELODIAS_FRECUENCIA_MUESTREO_HZ, c->cantidad * (ocho ? 1 : 2));
+        fprintf(f, "static const %s clip_%s[] = {", ocho ? "uint8_t" : "uint16_t", c->nombre);
+        for (uint32_t k = 0; k < c->cantidad; k++) {
+            if (k % (ocho ? 16 : 12) == 0) fprintf(f, "\n   ");
+            if (ocho) {
+                fprintf(f, " 0x%02X,", c->valores[k] >> 2);
+            } else {
+                fprintf(f, " 0x%04X,", (unsigned)(c->valores[k] << 6));
+            }
+        }
+        fprintf(f, "\n};\n");
+    }
+
+    fprintf(f, "\nconst ClipPCM clips_pcm[CLIPS_PCM_CANTIDAD] = {\n");
+    for (int i = 0; i < cantidad_clips; i++) {
+        fprintf(f, "    { clip_%s, %u, %s },\n", clips[i].nombre, clips[i].cantidad,
+                clips[i].formato == CLIP_PCM_8 ? "CLIP_PCM_8" : "CLIP_PCM_10");
+    }
+    fprintf(f, "};\n");
+    fclose(f);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Uso: %s archivo.wav[:10] ...\n", argv[0]);
+        return 1;
+    }
+
+    char argumentos[512] = "";
+    for (int i = 1; i < argc; i++) {
+        agregar_clip(argv[i]);
+        strncat(argumentos, argv[i], sizeof(argumentos) - strlen(argumentos) - 2);
+        if (i + 1 < argc) strcat(argumentos, " ");
+    }
+
+    emitir_cabecera(argumentos);
+    emitir_fuente(argumentos);
+
+    for (int i = 0; i < cantidad_clips; i++) {
+        const Clip *c = &clips[i];
+        printf("%-16s %6u muestras %5u ms %6u bytes (%s)\n", c->nombre, c->cantidad,
+               c->cantidad * 1000 / MELODIAS_FRECUENCIA_MUESTREO_HZ,
+               c->cantidad * (c->formato == CLIP_PCM_8 ? 1 : 2),
+               c->formato == CLIP_PCM_8 ? "8 bits" : "10 bits");
+    }
+    return 0;
+}
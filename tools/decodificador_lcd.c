@@ -0,0 +1,231 @@
+/**
+ * @file decodificador_lcd.c
+ * @brief Decodificador (PC) del flujo de bytes PCF8574 que envía lcd_i2c.c.
+ *
+ * Reconstruye los comandos HD44780 a partir de los nibbles y pulsos de
+ * enable, mantiene una DDRAM/CGRAM virtual del LCD 20x4 y cuenta los bytes
+ * de bus por frame. Sirve para medir cada camino de dibujo sin la placa.
+ *
+ * Entrada (stdin): bytes en hexadecimal, una transacción I2C por línea.
+ * Una línea vacía o que empiece con '#' cierra el frame actual.
+ *
+ * Con DECODIFICADOR_LCD_SIN_MAIN definido antes de incluirlo queda solo el
+ * LCD virtual, para los programas que lo usan como sumidero de sus bytes
+ * I2C (tools/simulador/simulador.c, tools/prueba_lcd_i2c.c).
+ *
+ * Compilar: gcc -O2 -o decodificador_lcd decodificador_lcd.c
+ * Uso:      ./decodificador_lcd < captura.txt
+ *
+ * @date Noviembre 2025
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+
+/* === MISMOS BITS QUE lcd_i2c.c === */
+#define LCD_FILAS       4
+#define LCD_COLUMNAS    20
+#define LCD_LUZ_FONDO   0x08
+#define LCD_ENABLE      0x04
+#define MODO_DATOS      0x01
+
+#define I2C_HZ          100000  // Velocidad del bus en la placa
+#define BITS_POR_BYTE   9       // 8 datos + ACK
+#define BITS_TRANSACCION 20     // START + dirección + ACK + STOP (aprox.)
+
+static const uint8_t inicio_fila[LCD_FILAS] = {0x00, 0x40, 0x14, 0x54};
+
+/* === ESTADO DEL LCD VIRTUAL === */
+typedef struct {
+    uint8_t ddram[128];
+    uint8_t cgram[64];
+    uint8_t direccion;      // Contador de direcciones (AC)
+    uint8_t en_cgram;       // 1 si el último set de dirección fue CGRAM
+    uint8_t modo_4bits;
+    uint8_t nibble_alto;    // Nibble pendiente en modo 4 bits
+    uint8_t esperando_bajo;
+    uint8_t ultimo;         // Último byte en el bus (para detectar flanco de E)
+} LcdVirtual;
+
+typedef struct {
+    uint32_t bytes;
+    uint32_t transacciones;
+    uint32_t caracteres;
+    uint32_t cursores;
+    uint32_t borrados;
+    uint32_t cgram;
+    uint32_t otros;
+    uint32_t fuera_de_pantalla;
+} Contadores;
+
+static LcdVirtual lcd;
+static Contadores frame, total;
+
+static void lcd_reiniciar(void) {
+    memset(&lcd, 0, sizeof(lcd));
+    memset(lcd.ddram, ' ', sizeof(lcd.ddram));
+}
+
+/**
+ * @brief Convierte una dirección DDRAM a (fila, columna) visibles.
+ * @return 1 si la dirección cae dentro de la pantalla de 20x4
+ */
+static int direccion_a_celda(uint8_t direccion, int *fila, int *columna) {
+    for (int f = 0; f < LCD_FILAS; f++) {
+        if (direccion >= inicio_fila[f] && direccion < inicio_fila[f] + LCD_COLUMNAS) {
+            *fila = f;
+            *columna = direccion - inicio_fila[f];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Ejecuta un byte completo recibido por el HD44780.
+ */
+static void lcd_ejecutar(uint8_t valor, uint8_t datos) {
+    if (datos) {
+        if (lcd.en_cgram) {
+            lcd.cgram[lcd.direccion & 0x3F] = valor & 0x1F;
+            lcd.direccion = (lcd.direccion + 1) & 0x3F;
+        } else {
+            int f, c;
+            if (!direccion_a_celda(lcd.direccion, &f, &c)) frame.fuera_de_pantalla++;
+            lcd.ddram[lcd.direccion & 0x7F] = valor;
+            lcd.direccion = (lcd.direccion + 1) & 0x7F;
+        }
+        frame.caracteres++;
+        return;
+    }
+
+    if (valor & 0x80) {                 // Set DDRAM address
+        int f, c;
+        lcd.direccion = valor & 0x7F;
+        lcd.en_cgram = 0;
+        if (!direccion_a_celda(lcd.direccion, &f, &c)) frame.fuera_de_pantalla++;
+        frame.cursores++;
+    } else if (valor & 0x40) {          // Set CGRAM address
+        lcd.direccion = valor & 0x3F;
+        lcd.en_cgram = 1;
+        frame.cgram++;
+    } else if (valor == 0x01) {         // Clear display
+        memset(lcd.ddram, ' ', sizeof(lcd.ddram));
+        lcd.direccion = 0;
+        lcd.en_cgram = 0;
+        frame.borrados++;
+    } else {
+        if ((valor & 0xE0) == 0x20) lcd.modo_4bits = !(valor & 0x10);
+        frame.otros++;
+    }
+}
+
+/**
+ * @brief Procesa un byte escrito en el PCF8574. El HD44780 lee el bus en el
+ * flanco descendente de E.
+ */
+static void pcf8574_escribir(uint8_t dato) {
+    uint8_t flanco = (lcd.ultimo & LCD_ENABLE) && !(dato & LCD_ENABLE);
+    uint8_t previo = lcd.ultimo;
+    lcd.ultimo = dato;
+    frame.bytes++;
+    if (!flanco) return;
+
+    uint8_t nibble = previo & 0xF0;
+    uint8_t datos = previo & MODO_DATOS;
+    if (!lcd.modo_4bits) {
+        // Secuencia de reset: cada nibble se interpreta como byte de 8 bits
+        lcd_ejecutar(nibble, datos);
+        return;
+    }
+    if (!lcd.esperando_bajo) {
+        lcd.nibble_alto = nibble;
+        lcd.esperando_bajo = 1;
+    } else {
+        lcd.esperando_bajo = 0;
+        lcd_ejecutar(lcd.nibble_alto | (nibble >> 4), datos);
+    }
+}
+
+static void sumar(Contadores *a, const Contadores *b) {
+    a->bytes += b->bytes;
+    a->transacciones += b->transacciones;
+    a->caracteres += b->caracteres;
+    a->cursores += b->cursores;
+    a->borrados += b->borrados;
+    a->cgram += b->cgram;
+    a->otros += b->otros;
+    a->fuera_de_pantalla += b->fuera_de_pantalla;
+}
+
+static double tiempo_bus_us(const Contadores *c) {
+    uint32_t bits = c->bytes * BITS_POR_BYTE + c->transacciones * BITS_TRANSACCION;
+    return bits * 1e6 / I2C_HZ;
+}
+
+static void imprimir_contadores(const char *nombre, const Contadores *c) {
+    printf("%s: %u bytes, %u transacciones, %.0f us de bus | chars %u, cursor %u, clear %u, cgram %u, otros %u",
+           nombre, c->bytes, c->transacciones, tiempo_bus_us(c),
+           c->caracteres, c->cursores, c->borrados, c->cgram, c->otros);
+    if (c->fuera_de_pantalla) printf(" | FUERA DE PANTALLA %u", c->fuera_de_pantalla);
+    printf("\n");
+}
+
+static void imprimir_pantalla(void) {
+    printf("+--------------------+\n");
+    for (int f = 0; f < LCD_FILAS; f++) {
+        putchar('|');
+        for (int c = 0; c < LCD_COLUMNAS; c++) {
+            uint8_t ch = lcd.ddram[inicio_fila[f] + c];
+            putchar(ch < 0x10 ? '0' + (ch & 0x07) : (isprint(ch) ? ch : '?'));
+        }
+        printf("|\n");
+    }
+    printf("+--------------------+\n");
+}
+
+/* === LECTURA DE LA CAPTURA === */
+
+#ifndef DECODIFICADOR_LCD_SIN_MAIN
+
+static void cerrar_frame(int *numero) {
+    if (frame.bytes == 0) return;
+    char nombre[32];
+    snprintf(nombre, sizeof(nombre), "Frame %d", (*numero)++);
+    imprimir_contadores(nombre, &frame);
+    sumar(&total, &frame);
+    memset(&frame, 0, sizeof(frame));
+}
+
+int main(void) {
+    char linea[4096];
+    int numero = 0;
+
+    lcd_reiniciar();
+    while (fgets(linea, sizeof(linea), stdin)) {
+        char *p = linea;
+        int bytes_linea = 0;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '\n' || *p == '\r' || *p == '\0' || *p == '#') {
+            cerrar_frame(&numero);
+            continue;
+        }
+        unsigned valor;
+        int leidos;
+        while (sscanf(p, " %x%n", &valor, &leidos) == 1) {
+            pcf8574_escribir((uint8_t)valor);
+            bytes_linea++;
+            p += leidos;
+        }
+        if (bytes_linea) frame.transacciones++;
+    }
+    cerrar_frame(&numero);
+
+    imprimir_pantalla();
+    imprimir_contadores("Total", &total);
+    return total.fuera_de_pantalla ? 1 : 0;
+}
+
+#endif // DECODIFICADOR_LCD_SIN_MAIN
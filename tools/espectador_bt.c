@@ -0,0 +1,1564 @@
+/**
+ * @file espectador_bt.c
+ * @brief Espectador (PC) de los juegos por Bluetooth.
+ *
+ * Usa src/espectador.c y src/protocolo_bt.c tal cual corren en la placa:
+ * con los registros de las tramas PROTOCOLO_TIPO_JUEGO lleva su propia
+ * copia de la serpiente o del Dino (el "espejo") y arma la misma pantalla
+ * de 20x4. Un salto de secuencia o un registro roto dejan el espejo sin
+ * sincronismo hasta la próxima foto, que pide solo.
+ *
+ * --pedir escribe en stdout la trama que enciende el espectador (con 0,
+ * lo apaga).
+ *
+ * --mirar abre el puerto del HC-05, enciende el espectador y dibuja la
+ * pantalla en la terminal cada vez que cambia. Vuelve a pedir la foto si
+ * el espejo pierde el sincronismo o si la placa lleva 2 s sin mandar nada
+ * (la última trama antes de un silencio se puede perder sin que se note).
+ *
+ * --verificar corre la placa contra el espejo sin hardware:
+ * - Ida y vuelta de registros al azar y cargas cortadas por el medio.
+ * - Modelos de la serpiente y del Dino que dibujan con src/lcd_framebuffer.c
+ *   sobre un HD44780 virtual (DDRAM + CGRAM) y mandan sus registros como
+ *   lo hacen snake_game.c y dino_game.c, por una cola TX de
+ *   bluetooth_uart.c que se vacía a 9600 bps.
+ * - Con la cola vacía y el espejo sincronizado, la pantalla del espejo
+ *   tiene que ser la del LCD virtual (los glifos CGRAM se traducen de vuelta
+ *   a medios bloques; los caracteres de respaldo valen si respetan la
+ *   prioridad).
+ * - Sin pérdidas el espejo no se puede desincronizar nunca; con tramas
+ *   dañadas y texto intercalado se tiene que recuperar con las fotos.
+ * - Los bytes por tick (sin fotos) quedan dentro del peor caso de
+ *   espectador.h y la foto de una serpiente que llena el mundo entra en
+ *   la cola TX.
+ *
+ * Compilar: gcc -O2 -Iinclude -o espectador_bt tools/espectador_bt.c src/espectador.c \
+ *               src/protocolo_bt.c src/lcd_framebuffer.c
+ *           (con -fsanitize=address,undefined además busca accesos fuera de rango)
+ * Uso:      ./espectador_bt --pedir [0] > /dev/rfcomm0
+ *           ./espectador_bt --mirar /dev/rfcomm0
+ *           ./espectador_bt --verificar [semilla]   (devuelve 1 si algo falla)
+ *
+ * @date Noviembre 2025
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include "espectador.h"
+#include "protocolo_bt.h"
+#include "lcd_framebuffer.h"
+#include "lcd_i2c.h"
+
+#define FILAS_LCD           4
+#define COLUMNAS_LCD        20
+#define FILAS_VISTA         (FILAS_LCD * 2)     // Dos celdas del mundo por carácter
+
+#define JUEGO_NINGUNO       0
+#define JUEGO_SERPIENTE     1
+#define JUEGO_DINO          2
+
+/* Celda de la serpiente en la pantalla del espejo: MEDIO_BLOQUE | arriba << 3 | abajo */
+#define MEDIO_BLOQUE        0x80
+#define MITAD_VACIA         0
+#define MITAD_CUERPO        1
+#define MITAD_CABEZA        2
+#define MITAD_COMIDA        3
+#define MITAD_AVISO         4   // Comida fuera de la vista, en el borde de su lado
+#define CANTIDAD_MITADES    5
+
+/* Los mismos que snake_game.c y dino_game.c */
+static const uint8_t patron_mitad[CANTIDAD_MITADES][4] = {
+    {0x00, 0x00, 0x00, 0x00},   // Vacía
+    {0x0E, 0x1F, 0x1F, 0x0E},   // Cuerpo
+    {0x1F, 0x15, 0x1F, 0x1F},   // Cabeza (con ojos)
+    {0x04, 0x0E, 0x0E, 0x04},   // Comida
+    {0x04, 0x0A, 0x0A, 0x04}    // Aviso (comida hueca)
+};
+static const uint8_t caracter_respaldo[CANTIDAD_MITADES] = {' ', 'o', 'O', '*', '+'};
+
+#define COLUMNA_DINO        2
+#define FILA_SUELO_DINO     3
+#define TICKS_POR_SEGUNDO   20
+
+typedef struct {
+    uint8_t x;
+    uint8_t y;
+} Posicion;
+
+static int errores = 0;
+static uint32_t estado_azar = 12345;
+
+static uint32_t azar(void) {
+    uint32_t x = estado_azar;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    estado_azar = x;
+    return x;
+}
+
+static void fallo(const char *prueba, const char *detalle, uint32_t paso) {
+    if (errores < 10) {
+        printf("%s: %s en el paso %u\n", prueba, detalle, paso);
+    }
+    errores++;
+}
+
+/* ============================= ESPEJO ===================================== */
+
+static struct {
+    uint8_t juego;
+    uint8_t sincronizado;
+    uint8_t armando_foto;           // Llegó FOTO_SERPIENTE, faltan registros CUERPO
+    uint8_t pedir_foto;             // Hay que mandar PROTOCOLO_TIPO_ESPECTADOR
+    uint8_t hay_secuencia;
+    uint8_t secuencia_esperada;
+    uint32_t tramas;
+    uint32_t perdidas;              // Sincronismo perdido (salto de secuencia o registro roto)
+    uint32_t fotos;
+
+    /* Serpiente: cola circular con índices de 16 bits, da la vuelta sola */
+    uint8_t ancho, alto;
+    Posicion cuerpo[65536];
+    uint16_t cabeza;
+    uint16_t largo;
+    uint16_t direcciones;           // Direcciones del cuerpo recibidas desde la foto
+    uint8_t ocupada[256][256];
+    uint8_t comida_x, comida_y;
+    uint8_t vista_x, vista_y;
+    uint16_t puntuacion;
+    uint8_t estado;
+
+    EspectadorFotoDino dino;
+} espejo;
+
+static void espejo_reiniciar(void) {
+    memset(&espejo, 0, sizeof(espejo));
+}
+
+static void perder_sincronismo(void) {
+    if (espejo.sincronizado || espejo.armando_foto) espejo.perdidas++;
+    espejo.sincronizado = 0;
+    espejo.armando_foto = 0;
+    espejo.pedir_foto = 1;
+}
+
+/**
+ * @brief ¿(x,y) es la celda del aviso? Como celda_comida_en_vista() de snake_game.c:
+ *        la comida llevada al borde de la vista más cercano
+ */
+static uint8_t es_aviso_comida(uint8_t x, uint8_t y, uint8_t comida_x, uint8_t comida_y,
+                               uint8_t vista_x, uint8_t vista_y) {
+    if (comida_x == ESPECTADOR_SIN_COMIDA) return 0;
+    if (comida_x < vista_x) comida_x = vista_x;
+    if (comida_x >= vista_x + COLUMNAS_LCD) comida_x = vista_x + COLUMNAS_LCD - 1;
+    if (comida_y < vista_y) comida_y = vista_y;
+    if (comida_y >= vista_y + FILAS_VISTA) comida_y = vista_y + FILAS_VISTA - 1;
+    return x == comida_x && y == comida_y;
+}
+
+static Posicion segmento_espejo(uint16_t i) {
+    return espejo.cuerpo[(uint16_t)(espejo.cabeza + i)];
+}
+
+/**
+ * @brief Celda vecina en una dirección (0 si sale del mundo)
+ */
+static uint8_t avanzar(Posicion desde, uint8_t direccion, uint8_t ancho, uint8_t alto, Posicion *hasta) {
+    int x = desde.x, y = desde.y;
+
+    switch (direccion) {
+        case ESPECTADOR_ARRIBA:    y--; break;
+        case ESPECTADOR_ABAJO:     y++; break;
+        case ESPECTADOR_IZQUIERDA: x--; break;
+        default:                   x++; break;
+    }
+    if (x < 0 || y < 0 || x >= ancho || y >= alto) return 0;
+    hasta->x = (uint8_t)x;
+    hasta->y = (uint8_t)y;
+    return 1;
+}
+
+static uint8_t aplicar_foto_serpiente(const EspectadorFotoSerpiente *f) {
+    if (f->ancho < COLUMNAS_LCD || f->alto < FILAS_VISTA) return 0;
+    if (f->cabeza_x >= f->ancho || f->cabeza_y >= f->alto) return 0;
+    if (f->vista_x + COLUMNAS_LCD > f->ancho || f->vista_y + FILAS_VISTA > f->alto) return 0;
+    if (f->largo == 0 || f->largo > (uint32_t)f->ancho * f->alto) return 0;
+    if (f->estado > ESPECTADOR_TERMINADO) return 0;
+
+    espejo.juego = JUEGO_SERPIENTE;
+    espejo.ancho = f->ancho;
+    espejo.alto = f->alto;
+    memset(espejo.ocupada, 0, sizeof(espejo.ocupada));
+    espejo.cabeza = 0;
+    espejo.cuerpo[0].x = f->cabeza_x;
+    espejo.cuerpo[0].y = f->cabeza_y;
+    espejo.ocupada[f->cabeza_y][f->cabeza_x] = 1;
+    espejo.largo = f->largo;
+    espejo.direcciones = 0;
+    espejo.comida_x = f->comida_x;
+    espejo.comida_y = f->comida_y;
+    espejo.vista_x = f->vista_x;
+    espejo.vista_y = f->vista_y;
+    espejo.puntuacion = f->puntuacion;
+    espejo.estado = f->estado;
+    espejo.sincronizado = (f->largo == 1);
+    espejo.armando_foto = !espejo.sincronizado;
+    espejo.fotos++;
+    return 1;
+}
+
+static uint8_t aplicar_cuerpo(const EspectadorRegistro *r) {
+    if (!espejo.armando_foto || r->cuerpo_desde != espejo.direcciones) return 0;
+    if ((uint32_t)espejo.direcciones + r->cuerpo_cantidad > espejo.largo - 1u) return 0;
+
+    for (uint8_t k = 0; k < r->cuerpo_cantidad; k++) {
+        uint16_t i = (uint16_t)(r->cuerpo_desde + k);
+        Posicion siguiente;
+        if (!avanzar(segmento_espejo(i), r->cuerpo[k], espejo.ancho, espejo.alto, &siguiente)) return 0;
+        if (espejo.ocupada[siguiente.y][siguiente.x]) return 0;
+        espejo.cuerpo[(uint16_t)(espejo.cabeza + i + 1)] = siguiente;
+        espejo.ocupada[siguiente.y][siguiente.x] = 1;
+    }
+    espejo.direcciones += r->cuerpo_cantidad;
+    if (espejo.direcciones == espejo.largo - 1) {
+        espejo.armando_foto = 0;
+        espejo.sincronizado = 1;
+    }
+    return 1;
+}
+
+/**
+ * @brief Repite el paso de mover_serpiente(): cabeza nueva y, si no creció, cola afuera
+ */
+static uint8_t aplicar_paso(const EspectadorPaso *paso) {
+    Posicion nueva;
+
+    if (espejo.juego != JUEGO_SERPIENTE) return 0;
+    if (!avanzar(segmento_espejo(0), paso->direccion, espejo.ancho, espejo.alto, &nueva)) return 0;
+
+    if (paso->crecio) {
+        if (espejo.largo >= (uint32_t)espejo.ancho * espejo.alto) return 0;
+        espejo.largo++;
+    } else {
+        Posicion cola = segmento_espejo(espejo.largo - 1);
+        espejo.ocupada[cola.y][cola.x] = 0;
+    }
+    if (espejo.ocupada[nueva.y][nueva.x]) return 0;
+    espejo.cabeza--;
+    espejo.cuerpo[espejo.cabeza] = nueva;
+    espejo.ocupada[nueva.y][nueva.x] = 1;
+
+    if (paso->comio) espejo.puntuacion++;
+    if (paso->comida_movida) {
+        espejo.comida_x = paso->comida_x;
+        espejo.comida_y = paso->comida_y;
+    }
+    if (paso->vista_movida) {
+        if (paso->vista_x + COLUMNAS_LCD > espejo.ancho || paso->vista_y + FILAS_VISTA > espejo.alto) return 0;
+        espejo.vista_x = paso->vista_x;
+        espejo.vista_y = paso->vista_y;
+    }
+    espejo.estado = ESPECTADOR_JUGANDO;    // El paso redibuja sobre "PAUSA"
+    return 1;
+}
+
+static uint8_t aplicar_tick(const EspectadorTick *tick) {
+    EspectadorFotoDino *d = &espejo.dino;
+
+    if (espejo.juego != JUEGO_DINO) return 0;
+    d->ticks++;
+    if (tick->desplazo) {
+        memmove(&d->obstaculos[0], &d->obstaculos[1], ESPECTADOR_COLUMNAS_DINO - 1);
+        d->obstaculos[ESPECTADOR_COLUMNAS_DINO - 1] = tick->obstaculo;
+    }
+    if (tick->punto) d->puntuacion++;
+    d->altura = tick->altura;
+    d->cuadro = tick->cuadro;
+    return 1;
+}
+
+/**
+ * @brief Aplica un registro (0 si no cuadra con la copia: hay que pedir foto)
+ */
+static uint8_t aplicar_registro(const EspectadorRegistro *r) {
+    switch (r->tipo) {
+        case ESPECTADOR_FOTO_SERPIENTE:
+            return aplicar_foto_serpiente(&r->foto_serpiente);
+        case ESPECTADOR_CUERPO:
+            return aplicar_cuerpo(r);
+        case ESPECTADOR_FOTO_DINO:
+            if (r->foto_dino.altura > 2 || (r->foto_dino.estado != ESPECTADOR_JUGANDO &&
+                                            r->foto_dino.estado != ESPECTADOR_TERMINADO)) {
+                return 0;
+            }
+            espejo.juego = JUEGO_DINO;
+            espejo.dino = r->foto_dino;
+            espejo.sincronizado = 1;
+            espejo.armando_foto = 0;
+            espejo.fotos++;
+            return 1;
+        default:
+            break;
+    }
+
+    /* Los cambios sueltos solo sirven sobre una copia completa */
+    if (!espejo.sincronizado) return 1;
+    switch (r->tipo) {
+        case ESPECTADOR_PASO_SERPIENTE:
+            return aplicar_paso(&r->paso);
+        case ESPECTADOR_TICK_DINO:
+            return aplicar_tick(&r->tick);
+        case ESPECTADOR_PAUSA:
+            if (espejo.juego != JUEGO_SERPIENTE) return 0;
+            espejo.estado = ESPECTADOR_EN_PAUSA;
+            return 1;
+        case ESPECTADOR_FIN:
+            espejo.estado = ESPECTADOR_TERMINADO;
+            espejo.dino.estado = ESPECTADOR_TERMINADO;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+static void espejo_recibir_trama(const ProtocoloTrama *trama) {
+    EspectadorRegistro registro;
+    uint8_t posicion = 0;
+
+    if (trama->tipo != PROTOCOLO_TIPO_JUEGO) return;
+    espejo.tramas++;
+
+    if (espejo.hay_secuencia && trama->secuencia != espejo.secuencia_esperada) {
+        perder_sincronismo();
+    }
+    espejo.hay_secuencia = 1;
+    espejo.secuencia_esperada = (uint8_t)(trama->secuencia + 1);
+
+    while (espectador_leer(trama->carga, trama->largo, &posicion, &registro)) {
+        if (!aplicar_registro(&registro)) {
+            perder_sincronismo();
+            return;
+        }
+    }
+    if (posicion != trama->largo) perder_sincronismo();
+}
+
+/* ------------------------- Pantalla del espejo --------------------------- */
+
+static void escribir_texto(uint8_t pantalla[FILAS_LCD][COLUMNAS_LCD], uint8_t fila, uint8_t columna,
+                           const char *texto) {
+    while (*texto && columna < COLUMNAS_LCD) {
+        pantalla[fila][columna++] = (uint8_t)*texto++;
+    }
+}
+
+/* Tres dígitos como dibujar_marcadores() de dino_game.c */
+static void escribir_tres_digitos(uint8_t pantalla[FILAS_LCD][COLUMNAS_LCD], uint8_t columna, uint32_t valor) {
+    char texto[4];
+    snprintf(texto, sizeof(texto), "%03u", valor % 1000);
+    escribir_texto(pantalla, 0, columna, texto);
+}
+
+static uint8_t mitad_espejo(uint8_t x, uint8_t y) {
+    Posicion cabeza = segmento_espejo(0);
+
+    if (x == cabeza.x && y == cabeza.y) return MITAD_CABEZA;
+    if (espejo.ocupada[y][x]) return MITAD_CUERPO;
+    if (x == espejo.comida_x && y == espejo.comida_y) return MITAD_COMIDA;
+    if (es_aviso_comida(x, y, espejo.comida_x, espejo.comida_y, espejo.vista_x, espejo.vista_y)) return MITAD_AVISO;
+    return MITAD_VACIA;
+}
+
+static void pantalla_serpiente(uint8_t pantalla[FILAS_LCD][COLUMNAS_LCD]) {
+    if (espejo.estado == ESPECTADOR_TERMINADO) {
+        char texto[8];
+        escribir_texto(pantalla, 0, 0, "   GAME OVER!");
+        escribir_texto(pantalla, 1, 0, "  Puntuacion: ");
+        snprintf(texto, sizeof(texto), "%u", espejo.puntuacion);
+        escribir_texto(pantalla, 1, 14, texto);
+        escribir_texto(pantalla, 3, 0, "Boton:Volver al menu");
+        return;
+    }
+
+    for (uint8_t fila = 0; fila < FILAS_LCD; fila++) {
+        for (uint8_t col = 0; col < COLUMNAS_LCD; col++) {
+            uint8_t x = espejo.vista_x + col;
+            uint8_t y = espejo.vista_y + fila * 2;
+            uint8_t arriba = mitad_espejo(x, y);
+            uint8_t abajo = mitad_espejo(x, y + 1);
+            if (arriba != MITAD_VACIA || abajo != MITAD_VACIA) {
+                pantalla[fila][col] = MEDIO_BLOQUE | (arriba << 3) | abajo;
+            }
+        }
+    }
+    if (espejo.estado == ESPECTADOR_EN_PAUSA) {
+        escribir_texto(pantalla, 0, 0, "PAUSA");
+    }
+}
+
+static void pantalla_dino(uint8_t pantalla[FILAS_LCD][COLUMNAS_LCD]) {
+    const EspectadorFotoDino *d = &espejo.dino;
+    int fila_inferior = FILA_SUELO_DINO - d->altura;
+
+    escribir_texto(pantalla, 0, 0, "DINO");
+    escribir_tres_digitos(pantalla, (COLUMNAS_LCD - 3) / 2, d->ticks / TICKS_POR_SEGUNDO);
+    escribir_tres_digitos(pantalla, COLUMNAS_LCD - 3, d->puntuacion);
+
+    for (int fila = 1; fila <= FILA_SUELO_DINO; fila++) {
+        for (int col = 0; col < COLUMNAS_LCD; col++) {
+            uint8_t c = ' ';
+            if (col == COLUMNA_DINO && fila >= fila_inferior - 1 && fila <= fila_inferior) {
+                c = (fila == fila_inferior - 1) ? 'D' : (d->cuadro ? 'I' : 'A');
+            }
+            if (c == ' ' && fila == FILA_SUELO_DINO) {
+                if (d->obstaculos[col] > 0) c = '#';
+                for (int atras = 1; atras < 3; atras++) {
+                    if (col - atras >= 0 && d->obstaculos[col - atras] > atras) c = '#';
+                }
+            }
+            pantalla[fila][col] = c;
+        }
+    }
+    if (d->estado == ESPECTADOR_TERMINADO) {
+        escribir_texto(pantalla, 1, 0, "  GAME OVER   ");
+        escribir_texto(pantalla, 3, 0, "Boton:Volver al menu");
+    }
+}
+
+/**
+ * @brief Arma la pantalla que muestra la placa (0 si el espejo no está sincronizado)
+ */
+static uint8_t espejo_pantalla(uint8_t pantalla[FILAS_LCD][COLUMNAS_LCD]) {
+    memset(pantalla, ' ', FILAS_LCD * COLUMNAS_LCD);
+    if (!espejo.sincronizado) return 0;
+
+    if (espejo.juego == JUEGO_SERPIENTE) {
+        pantalla_serpiente(pantalla);
+    } else {
+        pantalla_dino(pantalla);
+    }
+    return 1;
+}
+
+/* Carácter de respaldo con la prioridad de caracter_celda(): cabeza > comida > aviso > cuerpo */
+static uint8_t respaldo(uint8_t arriba, uint8_t abajo) {
+    if (arriba == MITAD_CABEZA || abajo == MITAD_CABEZA) return caracter_respaldo[MITAD_CABEZA];
+    if (arriba == MITAD_COMIDA || abajo == MITAD_COMIDA) return caracter_respaldo[MITAD_COMIDA];
+    if (arriba == MITAD_AVISO || abajo == MITAD_AVISO) return caracter_respaldo[MITAD_AVISO];
+    return caracter_respaldo[MITAD_CUERPO];
+}
+
+/* ============================= PEDIR ====================================== */
+
+/**
+ * @brief Trama PROTOCOLO_TIPO_ESPECTADOR.
+ *
+ * Cada ejecución arranca en 0, como cliente_bt: la placa olvida la
+ * secuencia anterior cuando el cliente calla BT_CLIENTE_ACTIVO_MS.
+ */
+static uint8_t armar_pedido(uint8_t encender, uint8_t *trama) {
+    static uint8_t secuencia = 0;
+
+    return protocolo_armar_trama(PROTOCOLO_TIPO_ESPECTADOR, secuencia++, &encender, 1, trama);
+}
+
+static int pedir(uint8_t encender) {
+    uint8_t trama[PROTOCOLO_TRAMA_MAXIMA];
+
+    fwrite(trama, 1, armar_pedido(encender, trama), stdout);
+    return 0;
+}
+
+/* ============================= MIRAR ====================================== */
+
+#define SEGUNDOS_ENTRE_PEDIDOS  1
+#define SEGUNDOS_SILENCIO       2
+
+static void imprimir_pantalla(void) {
+    static uint8_t anterior[FILAS_LCD][COLUMNAS_LCD];
+    static uint8_t anterior_sincronizado = 2;
+    uint8_t pantalla[FILAS_LCD][COLUMNAS_LCD];
+    uint8_t sincronizado = espejo_pantalla(pantalla);
+
+    if (sincronizado == anterior_sincronizado && memcmp(pantalla, anterior, sizeof(pantalla)) == 0) return;
+    memcpy(anterior, pantalla, sizeof(pantalla));
+    anterior_sincronizado = sincronizado;
+
+    printf("\033[H\033[J+--------------------+\n");
+    for (uint8_t fila = 0; fila < FILAS_LCD; fila++) {
+        putchar('|');
+        for (uint8_t col = 0; col < COLUMNAS_LCD; col++) {
+            uint8_t c = pantalla[fila][col];
+            putchar((c & MEDIO_BLOQUE) ? respaldo((c >> 3) & 7, c & 7) : c);
+        }
+        printf("|\n");
+    }
+    printf("+--------------------+\n%s  fotos %u  perdidas %u\n",
+           sincronizado ? "sincronizado" : "esperando la foto...", espejo.fotos, espejo.perdidas);
+    fflush(stdout);
+}
+
+static int mirar(const char *ruta) {
+    ProtocoloReceptor receptor;
+    uint8_t trama[PROTOCOLO_TRAMA_MAXIMA];
+    uint8_t datos[64];
+    time_t ultimo_pedido = 0, ultima_trama = time(NULL);
+    uint32_t tramas_antes = 0;
+
+    int fd = open(ruta, O_RDWR | O_NOCTTY);
+    if (fd < 0) {
+        perror(ruta);
+        return 1;
+    }
+
+    espejo_reiniciar();
+    espejo.pedir_foto = 1;
+    protocolo_inicializar(&receptor, espejo_recibir_trama, NULL);
+    for (;;) {
+        time_t ahora = time(NULL);
+        if ((espejo.pedir_foto && ahora - ultimo_pedido >= SEGUNDOS_ENTRE_PEDIDOS) ||
+            (ahora - ultima_trama >= SEGUNDOS_SILENCIO && ahora - ultimo_pedido >= SEGUNDOS_SILENCIO)) {
+            uint8_t n = armar_pedido(1, trama);
+            if (write(fd, trama, n) != n) {
+                perror(ruta);
+                break;
+            }
+            espejo.pedir_foto = 0;
+            ultimo_pedido = ahora;
+        }
+
+        struct pollfd espera = { fd, POLLIN, 0 };
+        int listo = poll(&espera, 1, 1000 / TICKS_POR_SEGUNDO);
+        if (listo < 0) break;
+        if (listo == 0) {
+            protocolo_vaciar(&receptor);   // Línea quieta: una trama a medias no se completa
+            continue;
+        }
+        ssize_t n = read(fd, datos, sizeof(datos));
+        if (n <= 0) break;
+        for (ssize_t i = 0; i < n; i++) {
+            protocolo_recibir(&receptor, datos[i]);
+        }
+        if (espejo.tramas != tramas_antes) {
+            tramas_antes = espejo.tramas;
+            ultima_trama = ahora;
+            imprimir_pantalla();
+        }
+    }
+    close(fd);
+    return 0;
+}
+
+/* ========================== VERIFICAR: LCD ================================ */
+
+/* Reemplaza a lcd_i2c.c: lcd_framebuffer.c escribe en un HD44780 en memoria */
+static uint8_t ddram[FILAS_LCD][COLUMNAS_LCD];
+static uint8_t cgram[8][8];
+static uint8_t cursor_fila = 0, cursor_columna = 0;
+static uint32_t bytes_lcd = 0;
+
+#define BYTES_I2C_POR_BYTE  6   // Dos nibbles con su pulso de enable
+
+void lcd_borrarPantalla(void) {
+    memset(ddram, ' ', sizeof(ddram));
+    cursor_fila = 0;
+    cursor_columna = 0;
+    bytes_lcd += BYTES_I2C_POR_BYTE;
+}
+
+void lcd_establecer_cursor(uint8_t fila, uint8_t columna) {
+    cursor_fila = fila;
+    cursor_columna = columna;
+    bytes_lcd += BYTES_I2C_POR_BYTE;
+}
+
+void lcd_escribir_byte(uint8_t caracter) {
+    if (cursor_fila < FILAS_LCD && cursor_columna < COLUMNAS_LCD) {
+        ddram[cursor_fila][cursor_columna] = caracter;
+    }
+    cursor_columna++;
+    bytes_lcd += BYTES_I2C_POR_BYTE;
+}
+
+void lcd_crear_caracter(uint8_t indice, const uint8_t patron[8]) {
+    memcpy(cgram[indice & 7], patron, 8);
+    bytes_lcd += 9 * BYTES_I2C_POR_BYTE;
+}
+
+void lcd_iniciar_lote(void) {}
+void lcd_terminar_lote(void) {}
+
+uint32_t lcd_obtener_bytes_enviados(void) {
+    return bytes_lcd;
+}
+
+static uint8_t mitad_de_patron(const uint8_t *filas) {
+    for (uint8_t m = 0; m < CANTIDAD_MITADES; m++) {
+        if (memcmp(filas, patron_mitad[m], 4) == 0) return m;
+    }
+    return 0xFF;
+}
+
+/**
+ * @brief Compara la pantalla del espejo con el LCD virtual (1 si coinciden)
+ */
+static uint8_t coincide_con_lcd(const uint8_t pantalla[FILAS_LCD][COLUMNAS_LCD]) {
+    for (uint8_t fila = 0; fila < FILAS_LCD; fila++) {
+        for (uint8_t col = 0; col < COLUMNAS_LCD; col++) {
+            uint8_t e = pantalla[fila][col], c = ddram[fila][col];
+            if (e & MEDIO_BLOQUE) {
+                uint8_t arriba = (e >> 3) & 7, abajo = e & 7;
+                if (c < 0x10) {
+                    const uint8_t *glifo = cgram[c & 7];
+                    if (mitad_de_patron(glifo) != arriba || mitad_de_patron(glifo + 4) != abajo) return 0;
+                } else if (c != respaldo(arriba, abajo)) {
+                    return 0;
+                }
+            } else if (c != e) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* ========================= VERIFICAR: ENLACE ============================== */
+
+#define COLA_TX_PLACA       1024                    // TAMAÑO_BUFFER_TX de bluetooth_uart.c
+#define BYTES_POR_TICK      (9600 / 10 / TICKS_POR_SEGUNDO)  // 9600 bps, 10 bits por byte
+#define LATENCIA_PEDIDO     3                       // Ticks hasta que el pedido llega a la placa
+#define TICKS_ENTRE_PEDIDOS (SEGUNDOS_ENTRE_PEDIDOS * TICKS_POR_SEGUNDO)
+#define TICKS_SILENCIO      (SEGUNDOS_SILENCIO * TICKS_POR_SEGUNDO)
+#define PEOR_TICK_SERPIENTE 10                      // espectador.h
+#define PEOR_TICK_DINO      6
+
+/* bt_enviar_juego() y la cola TX de bluetooth_uart.c */
+static struct {
+    uint8_t cola[COLA_TX_PLACA];
+    uint32_t inicio, ocupados;
+    uint8_t activo;
+    uint8_t pedido_foto;
+    uint8_t secuencia;
+    uint8_t en_foto;                // Lo que se encola va a bytes_foto
+    uint32_t bytes_foto;
+    uint32_t bytes_tick;            // Registros del tick, sin fotos ni texto
+    uint32_t dano;                  // Una trama dañada cada tantas (0 = nunca)
+} placa;
+
+/* Lo que sabe la prueba y no el espejo */
+static uint8_t danada_pendiente = 0;       // Trama dañada o descartada que el espejo todavía no notó
+static uint8_t secuencia_danada = 0;
+static uint32_t tramas_danadas = 0;
+static uint32_t tramas_descartadas = 0;
+
+static uint8_t placa_encolar(const uint8_t *datos, uint32_t n) {
+    if (COLA_TX_PLACA - placa.ocupados < n) return 0;
+    for (uint32_t i = 0; i < n; i++) {
+        placa.cola[(placa.inicio + placa.ocupados + i) % COLA_TX_PLACA] = datos[i];
+    }
+    placa.ocupados += n;
+    return 1;
+}
+
+static uint32_t placa_tx_libres(void) {
+    return COLA_TX_PLACA - placa.ocupados;
+}
+
+static uint8_t placa_obtener_pedido_foto(void) {
+    uint8_t pedido = placa.pedido_foto;
+    placa.pedido_foto = 0;
+    return pedido;
+}
+
+static uint8_t placa_enviar_juego(const uint8_t *registros, uint8_t largo) {
+    uint8_t trama[PROTOCOLO_TRAMA_MAXIMA];
+
+    if (!placa.activo) return 0;
+
+    uint8_t secuencia = placa.secuencia++;
+    uint8_t n = protocolo_armar_trama(PROTOCOLO_TIPO_JUEGO, secuencia, registros, largo, trama);
+    if (placa.dano && azar() % placa.dano == 0) {
+        trama[azar() % n] ^= (uint8_t)(1u << (azar() % 8));    // El CRC-8 lo detecta siempre
+        danada_pendiente = 1;
+        secuencia_danada = secuencia;
+        tramas_danadas++;
+    }
+    if (n == 0 || !placa_encolar(trama, n)) {
+        placa.pedido_foto = 1;
+        danada_pendiente = 1;
+        secuencia_danada = secuencia;
+        tramas_descartadas++;
+        return 0;
+    }
+    if (placa.en_foto) {
+        placa.bytes_foto += n;
+    } else {
+        placa.bytes_tick += n;
+    }
+    return 1;
+}
+
+/* ====================== VERIFICAR: SERPIENTE ============================== */
+
+/* Como snake_game.c con el mundo por defecto */
+#define COLUMNAS_MUNDO      64
+#define FILAS_MUNDO         32
+#define CELDAS_MUNDO        (COLUMNAS_MUNDO * FILAS_MUNDO)
+#define MARGEN_VISTA_X      3
+#define MARGEN_VISTA_Y      1
+#define SIN_COMIDA          0xFF
+
+static struct {
+    Posicion cuerpo[CELDAS_MUNDO];  // Cola circular: cuerpo[cabeza] es la cabeza
+    uint16_t cabeza, largo;
+    uint8_t ocupada[FILAS_MUNDO][COLUMNAS_MUNDO];
+    uint8_t direccion;
+    Posicion comida;
+    uint8_t vista_x, vista_y;
+    uint16_t puntuacion;
+    uint8_t ticks_por_paso, contador;
+    uint8_t pausada, redibujar_completo;
+    uint8_t terminada, fin_mostrado;
+    uint8_t foto_pendiente;
+    uint16_t largo_maximo;          // Para el resumen
+} serpiente;
+
+static Posicion segmento(uint16_t i) {
+    return serpiente.cuerpo[(serpiente.cabeza + i) % CELDAS_MUNDO];
+}
+
+static uint8_t celda_libre(Posicion p) {
+    return !serpiente.ocupada[p.y][p.x];
+}
+
+/**
+ * @brief Comida en una celda libre; la mayoría de las veces justo adelante,
+ *        para que las partidas lleguen a serpientes largas
+ */
+static void serpiente_generar_comida(void) {
+    Posicion adelante;
+
+    if (serpiente.largo == CELDAS_MUNDO) {
+        serpiente.comida.x = SIN_COMIDA;
+        serpiente.comida.y = SIN_COMIDA;
+        return;
+    }
+    if (azar() % 4 != 0 &&
+        avanzar(segmento(0), serpiente.direccion, COLUMNAS_MUNDO, FILAS_MUNDO, &adelante) &&
+        celda_libre(adelante)) {
+        serpiente.comida = adelante;
+        return;
+    }
+
+    uint32_t k = azar() % (CELDAS_MUNDO - serpiente.largo);
+    for (uint8_t y = 0; y < FILAS_MUNDO; y++) {
+        for (uint8_t x = 0; x < COLUMNAS_MUNDO; x++) {
+            if (serpiente.ocupada[y][x]) continue;
+            if (k-- == 0) {
+                serpiente.comida.x = x;
+                serpiente.comida.y = y;
+                return;
+            }
+        }
+    }
+}
+
+static uint8_t centrar_vista(uint8_t cabeza, uint8_t tam_vista, uint8_t tam_mundo) {
+    int origen = (int)cabeza - tam_vista / 2;
+    if (origen < 0) origen = 0;
+    if (origen > tam_mundo - tam_vista) origen = tam_mundo - tam_vista;
+    return (uint8_t)origen;
+}
+
+static uint8_t serpiente_actualizar_vista(Posicion cabeza) {
+    uint8_t x = serpiente.vista_x, y = serpiente.vista_y;
+
+    if (cabeza.x < x + MARGEN_VISTA_X || cabeza.x >= x + COLUMNAS_LCD - MARGEN_VISTA_X) {
+        x = centrar_vista(cabeza.x, COLUMNAS_LCD, COLUMNAS_MUNDO);
+    }
+    if (cabeza.y < y + MARGEN_VISTA_Y || cabeza.y >= y + FILAS_VISTA - MARGEN_VISTA_Y) {
+        y = centrar_vista(cabeza.y, FILAS_VISTA, FILAS_MUNDO);
+    }
+    if (x == serpiente.vista_x && y == serpiente.vista_y) return 0;
+    serpiente.vista_x = x;
+    serpiente.vista_y = y;
+    return 1;
+}
+
+static uint8_t serpiente_mitad(uint8_t x, uint8_t y) {
+    Posicion cabeza = segmento(0);
+
+    if (x == cabeza.x && y == cabeza.y) return MITAD_CABEZA;
+    if (serpiente.ocupada[y][x]) return MITAD_CUERPO;
+    if (x == serpiente.comida.x && y == serpiente.comida.y) return MITAD_COMIDA;
+    if (es_aviso_comida(x, y, serpiente.comida.x, serpiente.comida.y, serpiente.vista_x, serpiente.vista_y)) {
+        return MITAD_AVISO;
+    }
+    return MITAD_VACIA;
+}
+
+/* caracter_celda() y dibujar_en_buffer() de snake_game.c */
+static void serpiente_dibujar(void) {
+    lcd_fb_limpiar();
+    for (uint8_t fila = 0; fila < FILAS_LCD; fila++) {
+        for (uint8_t col = 0; col < COLUMNAS_LCD; col++) {
+            uint8_t x = serpiente.vista_x + col;
+            uint8_t y = serpiente.vista_y + fila * 2;
+            uint8_t arriba = serpiente_mitad(x, y), abajo = serpiente_mitad(x, y + 1);
+            uint8_t caracter = ' ';
+            if (arriba != MITAD_VACIA || abajo != MITAD_VACIA) {
+                uint8_t patron[8];
+                memcpy(patron, patron_mitad[arriba], 4);
+                memcpy(patron + 4, patron_mitad[abajo], 4);
+                caracter = lcd_fb_glifo((uint16_t)(arriba * CANTIDAD_MITADES + abajo), patron);
+                if (!caracter) caracter = respaldo(arriba, abajo);
+            }
+            lcd_fb_escribir_caracter(fila, col, caracter);
+        }
+    }
+}
+
+static void serpiente_transmitir_marca(uint8_t tipo) {
+    EspectadorTrama trama;
+
+    espectador_iniciar_trama(&trama);
+    espectador_poner_marca(&trama, tipo);
+    placa_enviar_juego(trama.carga, trama.largo);
+}
+
+static uint8_t direccion_entre(Posicion desde, Posicion hasta) {
+    if (hasta.y < desde.y) return ESPECTADOR_ARRIBA;
+    if (hasta.y > desde.y) return ESPECTADOR_ABAJO;
+    if (hasta.x < desde.x) return ESPECTADOR_IZQUIERDA;
+    return ESPECTADOR_DERECHA;
+}
+
+/* transmitir_foto() de snake_game.c */
+static uint8_t serpiente_transmitir_foto(void) {
+    uint32_t bytes = espectador_bytes_foto_serpiente(serpiente.largo);
+    if (placa_tx_libres() < bytes) return 0;
+
+    EspectadorTrama trama;
+    EspectadorFotoSerpiente foto;
+    uint8_t direcciones[ESPECTADOR_CUERPO_MAXIMO];
+    Posicion cabeza = segmento(0);
+
+    foto.ancho = COLUMNAS_MUNDO;
+    foto.alto = FILAS_MUNDO;
+    foto.cabeza_x = cabeza.x;
+    foto.cabeza_y = cabeza.y;
+    foto.comida_x = serpiente.comida.x;
+    foto.comida_y = serpiente.comida.y;
+    foto.vista_x = serpiente.vista_x;
+    foto.vista_y = serpiente.vista_y;
+    foto.puntuacion = serpiente.puntuacion;
+    foto.largo = serpiente.largo;
+    foto.estado = serpiente.terminada ? ESPECTADOR_TERMINADO :
+                  (serpiente.redibujar_completo ? ESPECTADOR_EN_PAUSA : ESPECTADOR_JUGANDO);
+
+    placa.en_foto = 1;
+    placa.bytes_foto = 0;
+    espectador_iniciar_trama(&trama);
+    espectador_poner_foto_serpiente(&trama, &foto);
+
+    uint16_t siguiente = 0;
+    for (;;) {
+        uint16_t faltan = serpiente.largo - 1 - siguiente;
+        uint8_t n = espectador_lugar_cuerpo(&trama);
+        if (n > faltan) n = (uint8_t)faltan;
+
+        if (n > 0) {
+            for (uint8_t k = 0; k < n; k++) {
+                direcciones[k] = direccion_entre(segmento(siguiente + k), segmento(siguiente + k + 1));
+            }
+            espectador_poner_cuerpo(&trama, siguiente, direcciones, n);
+            siguiente += n;
+        }
+        if (siguiente == serpiente.largo - 1 || n == 0) {
+            placa_enviar_juego(trama.carga, trama.largo);
+            if (siguiente == serpiente.largo - 1) break;
+            espectador_iniciar_trama(&trama);
+        }
+    }
+    placa.en_foto = 0;
+
+    if (placa.bytes_foto != bytes) {
+        fallo("foto serpiente", "espectador_bytes_foto_serpiente() no coincide", serpiente.largo);
+    }
+    return 1;
+}
+
+static void serpiente_atender(void) {
+    uint8_t pedido = placa_obtener_pedido_foto();
+
+    if (!placa.activo) {
+        serpiente.foto_pendiente = 0;
+        return;
+    }
+    if (pedido) serpiente.foto_pendiente = 1;
+    if (serpiente.foto_pendiente && serpiente_transmitir_foto()) {
+        serpiente.foto_pendiente = 0;
+    }
+}
+
+static void serpiente_iniciar(void) {
+    memset(&serpiente, 0, sizeof(serpiente));
+    for (uint8_t i = 0; i < 3; i++) {
+        serpiente.cuerpo[i].x = COLUMNAS_MUNDO / 2 - i;
+        serpiente.cuerpo[i].y = FILAS_MUNDO / 2;
+        serpiente.ocupada[serpiente.cuerpo[i].y][serpiente.cuerpo[i].x] = 1;
+    }
+    serpiente.largo = 3;
+    serpiente.direccion = ESPECTADOR_DERECHA;
+    serpiente.vista_x = centrar_vista(serpiente.cuerpo[0].x, COLUMNAS_LCD, COLUMNAS_MUNDO);
+    serpiente.vista_y = centrar_vista(serpiente.cuerpo[0].y, FILAS_VISTA, FILAS_MUNDO);
+    serpiente.ticks_por_paso = 10;
+    serpiente_generar_comida();
+
+    lcd_fb_borrar_pantalla();
+    serpiente_dibujar();
+    lcd_fb_volcar();
+
+    serpiente.foto_pendiente = 1;
+    serpiente_atender();
+}
+
+/**
+ * @brief El "jugador": casi siempre va hacia la comida por una celda libre
+ */
+static uint8_t serpiente_elegir_direccion(void) {
+    uint8_t d = serpiente.direccion;
+    uint8_t giro = (d <= ESPECTADOR_ABAJO) ? ESPECTADOR_IZQUIERDA : ESPECTADOR_ARRIBA;
+    uint8_t opciones[4] = { d, d, giro, (uint8_t)(giro + 1) };
+    Posicion cabeza = segmento(0), p;
+
+    if (azar() % 2) {       // Los dos giros en cualquier orden
+        opciones[2] = (uint8_t)(giro + 1);
+        opciones[3] = giro;
+    }
+    if (serpiente.comida.x != SIN_COMIDA && azar() % 8 != 0) {
+        int dx = serpiente.comida.x - cabeza.x, dy = serpiente.comida.y - cabeza.y;
+        uint8_t horizontal = dx < 0 ? ESPECTADOR_IZQUIERDA : ESPECTADOR_DERECHA;
+        uint8_t vertical = dy < 0 ? ESPECTADOR_ARRIBA : ESPECTADOR_ABAJO;
+        uint8_t hacia = (dx != 0 && (dy == 0 || azar() % 2)) ? horizontal : vertical;
+        if ((hacia ^ 1) != d) opciones[0] = hacia;     // Nunca en reversa
+    } else if (azar() % 6 == 0) {
+        opciones[0] = opciones[2];
+    }
+    if (azar() % 2000 == 0) return opciones[0];    // Distraído: puede chocar
+    for (uint8_t i = 0; i < 4; i++) {
+        if (avanzar(cabeza, opciones[i], COLUMNAS_MUNDO, FILAS_MUNDO, &p) && celda_libre(p)) {
+            return opciones[i];
+        }
+    }
+    return d;
+}
+
+static EspectadorPaso paso_serpiente;      // Lo registra serpiente_mover(), sale después del dibujo
+
+/* mover_serpiente() de snake_game.c */
+static void serpiente_mover(void) {
+    Posicion nueva;
+
+    serpiente.direccion = serpiente_elegir_direccion();
+    if (!avanzar(segmento(0), serpiente.direccion, COLUMNAS_MUNDO, FILAS_MUNDO, &nueva) ||
+        !celda_libre(nueva)) {
+        serpiente.terminada = 1;
+        return;
+    }
+
+    uint8_t comio = (nueva.x == serpiente.comida.x && nueva.y == serpiente.comida.y);
+    uint8_t crece = comio && serpiente.largo < CELDAS_MUNDO;
+    if (!crece) {
+        Posicion cola = segmento(serpiente.largo - 1);
+        serpiente.ocupada[cola.y][cola.x] = 0;
+    }
+    serpiente.ocupada[nueva.y][nueva.x] = 1;
+    serpiente.cabeza = (serpiente.cabeza + CELDAS_MUNDO - 1) % CELDAS_MUNDO;
+    serpiente.cuerpo[serpiente.cabeza] = nueva;
+
+    if (comio) {
+        serpiente.puntuacion++;
+        if (crece) serpiente.largo++;
+        if (serpiente.ticks_por_paso > 2 && serpiente.puntuacion % 5 == 0) serpiente.ticks_por_paso--;
+        serpiente_generar_comida();
+    }
+    if (serpiente.largo > serpiente.largo_maximo) serpiente.largo_maximo = serpiente.largo;
+
+    paso_serpiente.comio = comio;
+    paso_serpiente.crecio = crece;
+    paso_serpiente.comida_movida = comio;
+    paso_serpiente.vista_movida = serpiente_actualizar_vista(nueva);
+}
+
+/* transmitir_paso() de snake_game.c */
+static void serpiente_transmitir_paso(void) {
+    EspectadorTrama trama;
+
+    paso_serpiente.direccion = serpiente.direccion;
+    paso_serpiente.comida_x = serpiente.comida.x;
+    paso_serpiente.comida_y = serpiente.comida.y;
+    paso_serpiente.vista_x = serpiente.vista_x;
+    paso_serpiente.vista_y = serpiente.vista_y;
+    espectador_iniciar_trama(&trama);
+    espectador_poner_paso(&trama, &paso_serpiente);
+    placa_enviar_juego(trama.carga, trama.largo);
+}
+
+/* juego_serpiente_ejecutar() de snake_game.c, un tick */
+static void serpiente_tick(void) {
+    serpiente_atender();
+
+    if (serpiente.terminada) {
+        if (!serpiente.fin_mostrado) {
+            char texto[8];
+            lcd_fb_borrar_pantalla();
+            lcd_fb_escribir(0, 0, "   GAME OVER!");
+            lcd_fb_escribir(1, 0, "  Puntuacion: ");
+            snprintf(texto, sizeof(texto), "%u", serpiente.puntuacion);
+            lcd_fb_escribir(1, 14, texto);
+            lcd_fb_escribir(3, 0, "Boton:Volver al menu");
+            lcd_fb_volcar();
+            serpiente_transmitir_marca(ESPECTADOR_FIN);
+            serpiente.fin_mostrado = 1;
+        }
+        return;
+    }
+
+    if (azar() % (serpiente.pausada ? 20 : 300) == 0) serpiente.pausada = !serpiente.pausada;
+    if (serpiente.pausada) {
+        if (!serpiente.redibujar_completo) serpiente_transmitir_marca(ESPECTADOR_PAUSA);
+        lcd_fb_escribir(0, 0, "PAUSA");
+        lcd_fb_volcar();
+        serpiente.redibujar_completo = 1;
+        return;
+    }
+
+    if (++serpiente.contador >= serpiente.ticks_por_paso) {
+        serpiente.contador = 0;
+        serpiente_mover();
+        if (serpiente.terminada) return;
+        serpiente_dibujar();
+        serpiente.redibujar_completo = 0;
+        lcd_fb_volcar();
+        serpiente_transmitir_paso();
+    }
+}
+
+/* ========================= VERIFICAR: DINO ================================ */
+
+#define INTERVALO_INICIAL   2
+#define INTERVALO_MINIMO    1
+#define UMBRAL_SPAWN_BASE   40
+#define UMBRAL_SPAWN_MAXIMO 80
+
+static struct {
+    uint8_t obstaculos[COLUMNAS_LCD];
+    int8_t vertical;
+    uint8_t ultimo_obstaculo;
+    uint8_t terminado, fin_mostrado;
+    uint32_t puntuacion;
+    uint32_t ticks;
+    uint8_t intervalo, contador_movimiento, umbral_spawn;
+    uint8_t cuadro, contador_animacion;
+    EspectadorTick tick;
+    uint8_t foto_pendiente;
+} dino;
+
+static uint8_t dino_altura(void) {
+    if (dino.vertical >= 10) return 2;
+    if (dino.vertical >= 5) return 1;
+    return 0;
+}
+
+/* dibujar_pantalla_juego() y dibujar_marcadores() de dino_game.c */
+static void dino_dibujar(void) {
+    int fila_inferior = FILA_SUELO_DINO - dino_altura();
+    char texto[4];
+
+    for (int fila = 1; fila <= FILA_SUELO_DINO; fila++) {
+        for (int col = 0; col < COLUMNAS_LCD; col++) {
+            char c = ' ';
+            if (col == COLUMNA_DINO && fila >= fila_inferior - 1 && fila <= fila_inferior) {
+                c = (fila == fila_inferior - 1) ? 'D' : (dino.cuadro ? 'I' : 'A');
+            }
+            if (c == ' ' && fila == FILA_SUELO_DINO) {
+                if (dino.obstaculos[col] > 0) {
+                    c = '#';
+                } else {
+                    for (int atras = 1; atras < 3; atras++) {
+                        if (col - atras >= 0 && dino.obstaculos[col - atras] > atras) {
+                            c = '#';
+                            break;
+                        }
+                    }
+                }
+            }
+            lcd_fb_escribir_caracter(fila, col, c);
+        }
+    }
+
+    lcd_fb_escribir(0, 0, "DINO");
+    snprintf(texto, sizeof(texto), "%03u", (dino.ticks / TICKS_POR_SEGUNDO) % 1000);
+    lcd_fb_escribir(0, (COLUMNAS_LCD - 3) / 2, texto);
+    snprintf(texto, sizeof(texto), "%03u", dino.puntuacion % 1000);
+    lcd_fb_escribir(0, COLUMNAS_LCD - 3, texto);
+}
+
+static void dino_atender(void) {
+    uint8_t pedido = placa_obtener_pedido_foto();
+
+    if (!placa.activo) {
+        dino.foto_pendiente = 0;
+        return;
+    }
+    if (pedido) dino.foto_pendiente = 1;
+    if (!dino.foto_pendiente) return;
+
+    EspectadorTrama trama;
+    EspectadorFotoDino foto;
+    foto.altura = dino_altura();
+    foto.cuadro = dino.cuadro;
+    foto.puntuacion = (uint16_t)dino.puntuacion;
+    foto.ticks = dino.ticks;
+    memcpy(foto.obstaculos, dino.obstaculos, sizeof(foto.obstaculos));
+    foto.estado = dino.terminado ? ESPECTADOR_TERMINADO : ESPECTADOR_JUGANDO;
+
+    espectador_iniciar_trama(&trama);
+    espectador_poner_foto_dino(&trama, &foto);
+    placa.en_foto = 1;
+    if (placa_enviar_juego(trama.carga, trama.largo)) dino.foto_pendiente = 0;
+    placa.en_foto = 0;
+}
+
+static void dino_iniciar(void) {
+    memset(&dino, 0, sizeof(dino));
+    dino.intervalo = INTERVALO_INICIAL;
+    dino.umbral_spawn = UMBRAL_SPAWN_BASE;
+
+    lcd_fb_borrar_pantalla();
+    dino_dibujar();
+    lcd_fb_volcar();
+
+    dino.foto_pendiente = 1;
+    dino_atender();
+}
+
+/* actualizar_tick_juego() de dino_game.c */
+static void dino_actualizar(void) {
+    dino.tick.desplazo = 0;
+    dino.tick.obstaculo = 0;
+    dino.tick.punto = 0;
+    dino.ticks++;
+
+    if (dino.vertical > 0) {
+        dino.vertical -= (dino.intervalo <= 3) ? 2 : 1;
+        if (dino.vertical < 0) dino.vertical = 0;
+    }
+    if (++dino.contador_movimiento < dino.intervalo) return;
+    dino.contador_movimiento = 0;
+
+    uint8_t habia_en_dino = dino.obstaculos[COLUMNA_DINO];
+    memmove(&dino.obstaculos[0], &dino.obstaculos[1], COLUMNAS_LCD - 1);
+    if (dino.ultimo_obstaculo > 0) dino.ultimo_obstaculo--;
+    if ((azar() & 0xFF) < dino.umbral_spawn && dino.ultimo_obstaculo == 0) {
+        uint8_t tamano = (uint8_t)(azar() % 3 + 1);
+        dino.obstaculos[COLUMNAS_LCD - 1] = tamano;
+        dino.ultimo_obstaculo = 4 + tamano;
+    } else {
+        dino.obstaculos[COLUMNAS_LCD - 1] = 0;
+    }
+    dino.tick.desplazo = 1;
+    dino.tick.obstaculo = dino.obstaculos[COLUMNAS_LCD - 1];
+
+    int intervalo = INTERVALO_INICIAL - (int)(dino.puntuacion / 5);
+    dino.intervalo = (uint8_t)(intervalo < INTERVALO_MINIMO ? INTERVALO_MINIMO : intervalo);
+    int umbral = UMBRAL_SPAWN_BASE + (int)(dino.puntuacion / 3) * 2;
+    dino.umbral_spawn = (uint8_t)(umbral > UMBRAL_SPAWN_MAXIMO ? UMBRAL_SPAWN_MAXIMO : umbral);
+
+    if (dino.vertical <= 2 + dino.intervalo / 2 && dino.obstaculos[COLUMNA_DINO]) {
+        dino.terminado = 1;
+    }
+    if (habia_en_dino && !dino.obstaculos[COLUMNA_DINO] && !dino.terminado) {
+        dino.puntuacion++;
+        dino.tick.punto = 1;
+    }
+}
+
+/* juego_dinosaurio_ejecutar() de dino_game.c, un tick */
+static void dino_tick(void) {
+    EspectadorTrama trama;
+
+    dino_atender();
+
+    if (!dino.terminado) {
+        if (dino.vertical == 0 && azar() % 8 == 0) {
+            dino.vertical = (int8_t)(10 + dino.intervalo * 2);
+        }
+        dino_actualizar();
+        if (dino.vertical == 0 && ++dino.contador_animacion >= 6) {
+            dino.cuadro ^= 1;
+            dino.contador_animacion = 0;
+        }
+        dino_dibujar();
+        lcd_fb_volcar();
+
+        dino.tick.altura = dino_altura();
+        dino.tick.cuadro = dino.cuadro;
+        espectador_iniciar_trama(&trama);
+        espectador_poner_tick(&trama, &dino.tick);
+        placa_enviar_juego(trama.carga, trama.largo);
+    } else if (!dino.fin_mostrado) {
+        lcd_fb_escribir(1, 0, "  GAME OVER   ");
+        lcd_fb_escribir(3, 0, "Boton:Volver al menu");
+        lcd_fb_volcar();
+        espectador_iniciar_trama(&trama);
+        espectador_poner_marca(&trama, ESPECTADOR_FIN);
+        placa_enviar_juego(trama.carga, trama.largo);
+        dino.fin_mostrado = 1;
+    }
+}
+
+/* ======================== VERIFICAR: PARTIDAS ============================= */
+
+static const char *textos_placa[] = {
+    "Snake: W/A/S/D\r\n", "Bateria OK\r\n", "ISR  ciclos  carga\r\n", "Perfil: 1\r\n"
+};
+
+static void recibir_trama_prueba(const ProtocoloTrama *trama) {
+    espejo_recibir_trama(trama);
+    if (trama->tipo == PROTOCOLO_TIPO_JUEGO && danada_pendiente &&
+        (uint8_t)(trama->secuencia - secuencia_danada) < 128) {
+        danada_pendiente = 0;   // El espejo ya vio el salto de secuencia
+    }
+}
+
+static void reiniciar_enlace(ProtocoloReceptor *receptor, uint32_t dano) {
+    memset(&placa, 0, sizeof(placa));
+    placa.dano = dano;
+    placa.secuencia = (uint8_t)azar();
+    danada_pendiente = 0;
+    tramas_danadas = 0;
+    tramas_descartadas = 0;
+    espejo_reiniciar();
+    protocolo_inicializar(receptor, recibir_trama_prueba, NULL);
+}
+
+/**
+ * @brief Vacía la cola TX hacia el espejo a 9600 bps (todo si limite es 0)
+ */
+static uint32_t transmitir(ProtocoloReceptor *receptor, uint32_t limite) {
+    uint32_t enviados = 0;
+
+    while (placa.ocupados > 0 && (limite == 0 || enviados < limite)) {
+        protocolo_recibir(receptor, placa.cola[placa.inicio]);
+        placa.inicio = (placa.inicio + 1) % COLA_TX_PLACA;
+        placa.ocupados--;
+        enviados++;
+    }
+    if (placa.ocupados == 0) protocolo_vaciar(receptor);   // Resto del tick en silencio
+    return enviados;
+}
+
+/**
+ * @brief Partidas seguidas de serpiente y Dino contra el espejo
+ * @param dano Una trama dañada cada tantas (0 = enlace perfecto)
+ * @param ruido Un texto de la placa cada tantos ticks (0 = nunca)
+ */
+static void correr_partidas(const char *nombre, uint32_t ticks, uint32_t dano, uint32_t ruido) {
+    ProtocoloReceptor receptor;
+    uint8_t pantalla[FILAS_LCD][COLUMNAS_LCD];
+    uint8_t juego = JUEGO_SERPIENTE;
+    uint32_t espera_menu = 0, comparados = 0, distintos = 0, partidas = 1;
+    uint32_t peor_serpiente = 0, peor_dino = 0;
+    uint64_t bytes_juego = 0;
+    uint16_t largo_maximo = 0;
+    uint32_t ultimo_pedido = 0, pedido_llega = 0, ultima_trama = 0, tramas_antes = 0;
+
+    reiniciar_enlace(&receptor, dano);
+    lcd_fb_inicializar();
+    serpiente_iniciar();
+
+    for (uint32_t t = 1; t <= ticks; t++) {
+        /* Lo que hace --mirar, con ticks en lugar de segundos */
+        if ((espejo.pedir_foto && t - ultimo_pedido >= TICKS_ENTRE_PEDIDOS) ||
+            (t - ultima_trama >= TICKS_SILENCIO && t - ultimo_pedido >= TICKS_SILENCIO)) {
+            espejo.pedir_foto = 0;
+            ultimo_pedido = t;
+            pedido_llega = t + LATENCIA_PEDIDO;
+        }
+        if (pedido_llega == t) {
+            placa.activo = 1;       // procesar_trama_bt() con PROTOCOLO_TIPO_ESPECTADOR
+            placa.pedido_foto = 1;
+        }
+
+        placa.bytes_tick = 0;
+        if (juego == JUEGO_SERPIENTE) {
+            serpiente_tick();
+            if (placa.bytes_tick > peor_serpiente) peor_serpiente = placa.bytes_tick;
+            if (serpiente.largo_maximo > largo_maximo) largo_maximo = serpiente.largo_maximo;
+            if (serpiente.fin_mostrado && ++espera_menu == 40) {
+                juego = (azar() % 2) ? JUEGO_SERPIENTE : JUEGO_DINO;
+            }
+        } else {
+            dino_tick();
+            if (placa.bytes_tick > peor_dino) peor_dino = placa.bytes_tick;
+            if (dino.fin_mostrado && ++espera_menu == 40) {
+                juego = (azar() % 2) ? JUEGO_SERPIENTE : JUEGO_DINO;
+            }
+        }
+        bytes_juego += placa.bytes_tick;
+        if (espera_menu == 40) {
+            espera_menu = 0;
+            partidas++;
+            if (juego == JUEGO_SERPIENTE) serpiente_iniciar(); else dino_iniciar();
+        }
+        if (ruido && azar() % ruido == 0) {
+            const char *texto = textos_placa[azar() % 4];
+            placa_encolar((const uint8_t *)texto, (uint32_t)strlen(texto));
+        }
+
+        transmitir(&receptor, BYTES_POR_TICK);
+        if (espejo.tramas != tramas_antes) {
+            tramas_antes = espejo.tramas;
+            ultima_trama = t;
+        }
+
+        if (placa.ocupados == 0 && !danada_pendiente && espejo_pantalla(pantalla)) {
+            comparados++;
+            if (!coincide_con_lcd(pantalla)) {
+                distintos++;
+                fallo(nombre, "el espejo no muestra lo mismo que el LCD", t);
+            }
+        }
+    }
+
+    uint32_t peor = peor_serpiente > peor_dino ? peor_serpiente : peor_dino;
+    printf("%s: %u ticks, %u partidas, %u comparados (%u distintos), %u fotos, "
+           "%u desincronizados, %u tramas dañadas, %u descartadas, %u errores CRC, %u bytes de texto\n",
+           nombre, ticks, partidas, comparados, distintos, espejo.fotos, espejo.perdidas,
+           tramas_danadas, tramas_descartadas, receptor.errores, receptor.sueltos);
+    printf("  serpiente más larga %u; peor tick %u B (serpiente %u, dino %u); "
+           "promedio sin fotos %.1f B/s = %.1f %% de 9600 bps, %.1f %% de 115200 bps\n",
+           largo_maximo, peor, peor_serpiente, peor_dino,
+           (double)bytes_juego * TICKS_POR_SEGUNDO / ticks,
+           100.0 * bytes_juego * TICKS_POR_SEGUNDO * 10 / ticks / 9600,
+           100.0 * bytes_juego * TICKS_POR_SEGUNDO * 10 / ticks / 115200);
+
+    if (peor_serpiente > PEOR_TICK_SERPIENTE) fallo(nombre, "tick de la serpiente más grande que el peor caso", peor_serpiente);
+    if (peor_dino > PEOR_TICK_DINO) fallo(nombre, "tick del Dino más grande que el peor caso", peor_dino);
+    if (peor > BYTES_POR_TICK) fallo(nombre, "un tick no entra en 9600 bps", peor);
+    if (dano == 0 && espejo.perdidas != 0) fallo(nombre, "se desincronizó sin pérdidas", espejo.perdidas);
+    if (comparados < (dano ? ticks / 2 : ticks / 10 * 9)) {
+        fallo(nombre, "el espejo pasó demasiado tiempo sin sincronismo", comparados);
+    }
+}
+
+/* ===================== VERIFICAR: CASOS PUNTUALES ========================= */
+
+static void comparar_registros(const EspectadorRegistro *a, const EspectadorRegistro *b, uint32_t paso) {
+    uint8_t igual = a->tipo == b->tipo;
+
+    if (igual && a->tipo == ESPECTADOR_PASO_SERPIENTE) {
+        const EspectadorPaso *p = &a->paso, *q = &b->paso;
+        igual = p->direccion == q->direccion && p->comio == q->comio && p->crecio == q->crecio &&
+                p->comida_movida == q->comida_movida && p->vista_movida == q->vista_movida &&
+                (!p->comida_movida || (p->comida_x == q->comida_x && p->comida_y == q->comida_y)) &&
+                (!p->vista_movida || (p->vista_x == q->vista_x && p->vista_y == q->vista_y));
+    } else if (igual && a->tipo == ESPECTADOR_TICK_DINO) {
+        igual = memcmp(&a->tick, &b->tick, sizeof(a->tick)) == 0;
+    } else if (igual && a->tipo == ESPECTADOR_FOTO_SERPIENTE) {
+        igual = memcmp(&a->foto_serpiente, &b->foto_serpiente, sizeof(a->foto_serpiente)) == 0;
+    } else if (igual && a->tipo == ESPECTADOR_FOTO_DINO) {
+        const EspectadorFotoDino *p = &a->foto_dino, *q = &b->foto_dino;
+        igual = p->altura == q->altura && p->cuadro == q->cuadro && p->puntuacion == q->puntuacion &&
+                p->ticks == q->ticks && p->estado == q->estado &&
+                memcmp(p->obstaculos, q->obstaculos, sizeof(p->obstaculos)) == 0;
+    } else if (igual && a->tipo == ESPECTADOR_CUERPO) {
+        igual = a->cuerpo_desde == b->cuerpo_desde && a->cuerpo_cantidad == b->cuerpo_cantidad &&
+                memcmp(a->cuerpo, b->cuerpo, a->cuerpo_cantidad) == 0;
+    }
+    if (!igual) fallo("ida y vuelta", "registro distinto", paso);
+}
+
+/**
+ * @brief Registros al azar, de a varios por trama, escritos y vueltos a leer
+ */
+static void probar_ida_y_vuelta(void) {
+    static EspectadorRegistro puestos[PROTOCOLO_CARGA_MAXIMA];
+    EspectadorRegistro leido;
+
+    for (uint32_t paso = 0; paso < 200000; paso++) {
+        EspectadorTrama trama;
+        uint8_t cantidad = 0;
+
+        espectador_iniciar_trama(&trama);
+        for (;;) {
+            EspectadorRegistro *r = &puestos[cantidad];
+            uint8_t ok;
+            memset(r, 0, sizeof(*r));
+            switch (azar() % 7) {
+                case 0:
+                    r->tipo = ESPECTADOR_PASO_SERPIENTE;
+                    r->paso.direccion = azar() % 4;
+                    r->paso.comio = azar() % 2;
+                    r->paso.crecio = azar() % 2;
+                    r->paso.comida_movida = azar() % 2;
+                    r->paso.comida_x = (uint8_t)azar();
+                    r->paso.comida_y = (uint8_t)azar();
+                    r->paso.vista_movida = azar() % 2;
+                    r->paso.vista_x = (uint8_t)azar();
+                    r->paso.vista_y = (uint8_t)azar();
+                    ok = espectador_poner_paso(&trama, &r->paso);
+                    break;
+                case 1:
+                    r->tipo = ESPECTADOR_TICK_DINO;
+                    r->tick.altura = azar() % 3;
+                    r->tick.cuadro = azar() % 2;
+                    r->tick.desplazo = azar() % 2;
+                    r->tick.obstaculo = azar() % 4;
+                    r->tick.punto = azar() % 2;
+                    ok = espectador_poner_tick(&trama, &r->tick);
+                    break;
+                case 2: {
+                    EspectadorFotoSerpiente *f = &r->foto_serpiente;
+                    r->tipo = ESPECTADOR_FOTO_SERPIENTE;
+                    f->ancho = (uint8_t)azar(); f->alto = (uint8_t)azar();
+                    f->cabeza_x = (uint8_t)azar(); f->cabeza_y = (uint8_t)azar();
+                    f->comida_x = (uint8_t)azar(); f->comida_y = (uint8_t)azar();
+                    f->vista_x = (uint8_t)azar(); f->vista_y = (uint8_t)azar();
+                    f->puntuacion = (uint16_t)azar(); f->largo = (uint16_t)azar();
+                    f->estado = azar() % 3;
+                    ok = espectador_poner_foto_serpiente(&trama, f);
+                    break;
+                }
+                case 3: {
+                    EspectadorFotoDino *f = &r->foto_dino;
+                    r->tipo = ESPECTADOR_FOTO_DINO;
+                    f->altura = azar() % 3;
+                    f->cuadro = azar() % 2;
+                    f->puntuacion = (uint16_t)azar();
+                    f->ticks = azar();
+                    for (uint8_t i = 0; i < ESPECTADOR_COLUMNAS_DINO; i++) f->obstaculos[i] = azar() % 4;
+                    f->estado = (azar() % 2) ? ESPECTADOR_TERMINADO : ESPECTADOR_JUGANDO;
+                    ok = espectador_poner_foto_dino(&trama, f);
+                    break;
+                }
+                case 4: {
+                    uint8_t lugar = espectador_lugar_cuerpo(&trama);
+                    r->tipo = ESPECTADOR_CUERPO;
+                    r->cuerpo_desde = (uint16_t)azar();
+                    r->cuerpo_cantidad = lugar ? (uint8_t)(1 + azar() % lugar) : 1;
+                    for (uint8_t i = 0; i < r->cuerpo_cantidad; i++) r->cuerpo[i] = azar() % 4;
+                    ok = espectador_poner_cuerpo(&trama, r->cuerpo_desde, r->cuerpo, r->cuerpo_cantidad);
+                    if (lugar && !ok) fallo("ida y vuelta", "CUERPO no entró en el lugar que había", paso);
+                    break;
+                }
+                default:
+                    r->tipo = (azar() % 2) ? ESPECTADOR_PAUSA : ESPECTADOR_FIN;
+                    ok = espectador_poner_marca(&trama, r->tipo);
+                    break;
+            }
+            if (!ok) break;
+            cantidad++;
+        }
+
+        uint8_t posicion = 0, leidos = 0;
+        while (espectador_leer(trama.carga, trama.largo, &posicion, &leido)) {
+            if (leidos < cantidad) comparar_registros(&puestos[leidos], &leido, paso);
+            leidos++;
+        }
+        if (leidos != cantidad || posicion != trama.largo) {
+            fallo("ida y vuelta", "cantidad de registros distinta", paso);
+        }
+
+        /* Cortada en cualquier lugar: se lee un prefijo y nunca se pasa del largo */
+        uint8_t corte = trama.largo ? (uint8_t)(azar() % trama.largo) : 0;
+        posicion = 0;
+        leidos = 0;
+        while (espectador_leer(trama.carga, corte, &posicion, &leido)) leidos++;
+        if (posicion > corte || leidos > cantidad) fallo("carga cortada", "leyó de más", paso);
+    }
+}
+
+/**
+ * @brief La foto de una serpiente que llena el mundo (recorrido en zigzag)
+ */
+static void probar_serpiente_llena(void) {
+    ProtocoloReceptor receptor;
+    uint8_t pantalla[FILAS_LCD][COLUMNAS_LCD];
+    uint32_t bytes = espectador_bytes_foto_serpiente(CELDAS_MUNDO);
+
+    printf("foto: %u B con 3 segmentos, %u B con %u (cola TX de %u B)\n",
+           espectador_bytes_foto_serpiente(3), bytes, CELDAS_MUNDO, COLA_TX_PLACA);
+    if (bytes > COLA_TX_PLACA) fallo("serpiente llena", "la foto no entra en la cola TX", bytes);
+
+    reiniciar_enlace(&receptor, 0);
+    placa.activo = 1;
+    lcd_fb_inicializar();
+    memset(&serpiente, 0, sizeof(serpiente));
+    for (uint16_t i = 0; i < CELDAS_MUNDO; i++) {
+        uint16_t paso = CELDAS_MUNDO - 1 - i;      // La cabeza es la última celda del zigzag
+        uint8_t y = paso / COLUMNAS_MUNDO, x = paso % COLUMNAS_MUNDO;
+        if (y % 2) x = COLUMNAS_MUNDO - 1 - x;
+        serpiente.cuerpo[i].x = x;
+        serpiente.cuerpo[i].y = y;
+        serpiente.ocupada[y][x] = 1;
+    }
+    serpiente.largo = CELDAS_MUNDO;
+    serpiente.comida.x = SIN_COMIDA;
+    serpiente.comida.y = SIN_COMIDA;
+    serpiente.vista_x = centrar_vista(serpiente.cuerpo[0].x, COLUMNAS_LCD, COLUMNAS_MUNDO);
+    serpiente.vista_y = centrar_vista(serpiente.cuerpo[0].y, FILAS_VISTA, FILAS_MUNDO);
+    lcd_fb_borrar_pantalla();
+    serpiente_dibujar();
+    lcd_fb_volcar();
+
+    serpiente.foto_pendiente = 1;
+    serpiente_atender();
+    if (serpiente.foto_pendiente) fallo("serpiente llena", "no mandó la foto", 0);
+    transmitir(&receptor, 0);
+    if (!espejo_pantalla(pantalla)) {
+        fallo("serpiente llena", "el espejo no se sincronizó", 0);
+    } else if (!coincide_con_lcd(pantalla)) {
+        fallo("serpiente llena", "el espejo no muestra lo mismo que el LCD", 0);
+    }
+}
+
+static int verificar(uint32_t semilla) {
+    estado_azar = semilla ? semilla : 1;
+
+    probar_ida_y_vuelta();
+    probar_serpiente_llena();
+    correr_partidas("sin pérdidas", 200000, 0, 0);
+    correr_partidas("con pérdidas", 200000, 200, 50);
+    correr_partidas("enlace malo", 100000, 15, 10);
+
+    if (errores == 0) {
+        printf("OK\n");
+        return 0;
+    }
+    printf("%d fallos\n", errores);
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    if (argc >= 2 && strcmp(argv[1], "--pedir") == 0) {
+        return pedir(argc >= 3 ? (uint8_t)(atoi(argv[2]) != 0) : 1);
+    }
+    if (argc >= 3 && strcmp(argv[1], "--mirar") == 0) {
+        return mirar(argv[2]);
+    }
+    if (argc >= 2 && strcmp(argv[1], "--verificar") == 0) {
+        return verificar(argc >= 3 ? (uint32_t)strtoul(argv[2], NULL, 0) : 12345);
+    }
+    fprintf(stderr, "Uso: %s --pedir [0] | --mirar <puerto> | --verificar [semilla]\n", argv[0]);
+    return 2;
+}
@@ -0,0 +1,253 @@
+/**
+ * @file generador_formas.c
+ * @brief Generador (PC) de las tablas de formas de onda de melodias_dac.h.
+ *
+ * Cada forma se arma por suma de armónicos, con tantos armónicos como
+ * entran por debajo de MELODIAS_FRECUENCIA_MUESTREO_HZ / 2 para la nota
+ * más aguda de cada octava (SI_3, SI_4, SI_5): 40, 20 y 10. Los armónicos
+ * se atenúan con el factor sigma de Lanczos para que el corte no agregue
+ * sobrepicos de Gibbs. Después se normaliza a ±127 y se guarda en int8_t.
+ *
+ * Las fases están elegidas para que la triangular tenga el pico en la
+ * muestra 64 y el valle en la 192, como la tabla de 16 puntos de antes.
+ *
+ * Compilar: gcc -O2 -Iinclude -o generador_formas tools/generador_formas.c -lm
+ * Uso:      ./generador_formas > src/formas_onda.c
+ *           ./generador_formas --verificar
+ *
+ * --verificar calcula la DFT de cada tabla ya cuantizada y muestra el
+ * armónico más fuerte por encima del límite de su banda, relativo al
+ * fundamental. Devuelve 1 si alguno supera -40 dB.
+ *
+ * @date Noviembre 2025
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "melodias_dac.h"
+
+#define N                   MELODIAS_MUESTRAS_FORMA
+#define MAX_ARMONICO        (N / 2 - 1)
+#define LIMITE_DB           (-40.0)
+#define SEMILLA_RUIDO       0xACE1u
+
+typedef enum {
+    TIPO_TRIANGULAR,
+    TIPO_SENO,
+    TIPO_SIERRA,
+    TIPO_PULSO,
+    TIPO_RUIDO
+} TipoForma;
+
+typedef struct {
+    const char *nombre;
+    uint8_t tipo;
+    double ciclo;           // Solo pulsos: fracción del período en alto
+} Forma;
+
+static const Forma formas[MELODIAS_FORMAS] = {
+    [MELODIAS_FORMA_TRIANGULAR]  = { "triangular",  TIPO_TRIANGULAR, 0.0 },
+    [MELODIAS_FORMA_SENO]        = { "seno",        TIPO_SENO,       0.0 },
+    [MELODIAS_FORMA_SIERRA]      = { "sierra",      TIPO_SIERRA,     0.0 },
+    [MELODIAS_FORMA_CUADRADA_50] = { "cuadrada_50", TIPO_PULSO,      0.5 },
+    [MELODIAS_FORMA_CUADRADA_25] = { "cuadrada_25", TIPO_PULSO,      0.25 },
+    [MELODIAS_FORMA_CUADRADA_12] = { "cuadrada_12", TIPO_PULSO,      0.125 },
+    [MELODIAS_FORMA_RUIDO]       = { "ruido",       TIPO_RUIDO,      0.0 },
+};
+
+// Nota más aguda de cada banda: fija cuántos armónicos caben
+static const uint16_t tope_banda[MELODIAS_BANDAS_FORMA] = { SI_3, SI_4, SI_5 };
+
+static int armonicos_banda(int banda) {
+    int n = (MELODIAS_FRECUENCIA_MUESTREO_HZ / 2) / tope_banda[banda];
+    return n > MAX_ARMONICO ? MAX_ARMONICO : n;
+}
+
+/* Seno y ruido no dependen de la altura: una sola tabla para las tres bandas */
+static int una_sola_tabla(const Forma *f) {
+    return f->tipo == TIPO_SENO || f->tipo == TIPO_RUIDO;
+}
+
+/* ============================ SÍNTESIS ==================================== */
+
+/**
+ * @brief Amplitud (seno y coseno) del armónico k de la forma ideal.
+ */
+static void armonico(const Forma *f, int k, double *a_seno, double *a_coseno) {
+    *a_seno = 0.0;
+    *a_coseno = 0.0;
+    switch (f->tipo) {
+    case TIPO_TRIANGULAR:
+        if (k % 2) *a_seno = ((k / 2) % 2 ? -1.0 : 1.0) / ((double)k * k);
+        break;
+    case TIPO_SENO:
+        if (k == 1) *a_seno = 1.0;
+        break;
+    case TIPO_SIERRA:
+        *a_seno = (k % 2 ? 1.0 : -1.0) / k;
+        break;
+    case TIPO_PULSO:
+        // Pulso en alto de 0 a ciclo·2π, sin componente continua
+        *a_seno = (1.0 - cos(2.0 * M_PI * k * f->ciclo)) / k;
+        *a_coseno = sin(2.0 * M_PI * k * f->ciclo) / k;
+        break;
+    default:
+        break;
+    }
+}
+
+static void generar(const Forma *f, int banda, int8_t *tabla) {
+    double valores[N];
+    double pico = 0.0;
+
+    if (f->tipo == TIPO_RUIDO) {
+        uint16_t lfsr = SEMILLA_RUIDO;
+        double media = 0.0;
+        for (int i = 0; i < N; i++) {
+            // LFSR de Galois de 16 bits, 8 pasos por muestra
+            for (int p = 0; p < 8; p++) lfsr = (uint16_t)((lfsr >> 1) ^ (-(lfsr & 1u) & 0xB400u));
+            valores[i] = (double)(lfsr & 0xFF) - 127.5;
+            media += valores[i];
+        }
+        for (int i = 0; i < N; i++) valores[i] -= media / N;
+    } else {
+        int limite = armonicos_banda(banda);
+        for (int i = 0; i < N; i++) {
+            double x = 2.0 * M_PI * i / N;
+            double v = 0.0;
+            for (int k = 1; k <= limite; k++) {
+                double s, c;
+                armonico(f, k, &s, &c);
+                double sigma = (k == 1) ? 1.0 : sin(M_PI * k / (limite + 1)) / (M_PI * k / (limite + 1));
+                v += sigma * (s * sin(k * x) + c * cos(k * x));
+            }
+            valores[i] = v;
+        }
+    }
+
+    for (int i = 0; i < N; i++) {
+        if (fabs(valores[i]) > pico) pico = fabs(valores[i]);
+    }
+    for (int i = 0; i < N; i++) {
+        tabla[i] = (int8_t)lround(valores[i] * 127.0 / pico);
+    }
+}
+
+/* ============================ VERIFICACIÓN ================================ */
+
+static double magnitud(const int8_t *tabla, int k) {
+    double re = 0.0, im = 0.0;
+    for (int i = 0; i < N; i++) {
+        re += tabla[i] * cos(2.0 * M_PI * k * i / N);
+        im -= tabla[i] * sin(2.0 * M_PI * k * i / N);
+    }
+    return sqrt(re * re + im * im);
+}
+
+static int verificar(void) {
+    int8_t tabla[N];
+    int errores = 0;
+
+    printf("%-12s %5s %9s %10s %8s\n", "Forma", "Banda", "Armónicos", "Fuera (dB)", "Pico");
+    for (int f = 0; f < MELODIAS_FORMAS; f++) {
+        int bandas = una_sola_tabla(&formas[f]) ? 1 : MELODIAS_BANDAS_FORMA;
+        for (int b = 0; b < bandas; b++) {
+            generar(&formas[f], b, tabla);
+
+            int minimo = 0, maximo = 0;
+            for (int i = 0; i < N; i++) {
+                if (tabla[i] < minimo) minimo = tabla[i];
+                if (tabla[i] > maximo) maximo = tabla[i];
+            }
+
+            if (formas[f].tipo == TIPO_RUIDO) {
+                printf("%-12s %5s %9s %10s %4d..%d\n", formas[f].nombre, "-", "-", "-", minimo, maximo);
+                continue;
+            }
+
+            // El peor armónico por encima del límite de la banda más aguda que usa la tabla
+            int limite = armonicos_banda(bandas == 1 ? MELODIAS_BANDAS_FORMA - 1 : b);
+            double fundamental = magnitud(tabla, 1), peor = 0.0;
+            for (int k = limite + 1; k <= N / 2; k++) {
+                double m = magnitud(tabla, k);
+                if (m > peor) peor = m;
+            }
+            double db = 20.0 * log10(peor / fundamental + 1e-12);
+            int ok = db <= LIMITE_DB && (maximo == 127 || minimo == -127);
+            printf("%-12s %5d %9d %10.1f %4d..%d %s\n", formas[f].nombre, b, limite, db,
+                   minimo, maximo, ok ? "OK" : "FALLO");
+            if (!ok) errores++;
+        }
+    }
+    return errores ? 1 : 0;
+}
+
+/* ============================ SALIDA ====================================== */
+
+static void emitir_c(void) {
+    int8_t tabla[N];
+    int bytes = 0;
+
+    printf("/**\n");
+    printf(" * @file formas_onda.c\n");
+    printf(" * @brief Tablas de formas de onda sin aliasing, una por octava\n");
+    printf(" *\n");
+    printf(" * Generado por tools/generador_formas.c. No editar a mano:\n");
+    printf(" *   ./generador_formas > src/formas_onda.c\n");
+    printf(" *\n");
+    printf(" * @date Noviembre 2025\n");
+    printf(" */\n\n");
+    printf("#include \"melodias_dac.h\"\n");
+
+    for (int f = 0; f < MELODIAS_FORMAS; f++) {
+        int bandas = una_sola_tabla(&formas[f]) ? 1 : MELODIAS_BANDAS_FORMA;
+        for (int b = 0; b < bandas; b++) {
+            generar(&formas[f], b, tabla);
+            if (bandas == 1) {
+                printf("\n// %s\n", formas[f].nombre);
+                printf("static const int8_t forma_%s[%d] = {", formas[f].nombre, N);
+            } else {
+                printf("\n// %s, banda %d: %d armónicos\n", formas[f].nombre, b, armonicos_banda(b));
+                printf("static const int8_t forma_%s_%d[%d] = {", formas[f].nombre, b, N);
+            }
+            for (int i = 0; i < N; i++) {
+                if (i % 16 == 0) printf("\n   ");
+                printf(" %4d,", tabla[i]);
+            }
+            printf("\n};\n");
+            bytes += N;
+        }
+    }
+
+    printf("\n// %d bytes de tablas\n", bytes);
+    printf("const int8_t *const formas_onda[MELODIAS_FORMAS][MELODIAS_BANDAS_FORMA] = {\n");
+    for (int f = 0; f < MELODIAS_FORMAS; f++) {
+        printf("    {");
+        for (int b = 0; b < MELODIAS_BANDAS_FORMA; b++) {
+            if (una_sola_tabla(&formas[f])) {
+                printf(" forma_%s", formas[f].nombre);
+            } else {
+                printf(" forma_%s_%d", formas[f].nombre, b);
+            }
+            printf(b + 1 < MELODIAS_BANDAS_FORMA ? "," : " ");
+        }
+        printf("},\n");
+    }
+    printf("};\n");
+}
+
+int main(int argc, char *argv[]) {
+    if (argc == 2 && strcmp(argv[1], "--verificar") == 0) {
+        return verificar();
+    }
+    if (argc == 1) {
+        emitir_c();
+        return 0;
+    }
+
+    fprintf(stderr, "Uso: %s [--verificar]\n", argv[0]);
+    return 1;
+}
@@ -0,0 +1,226 @@
+/**
+ * @file prueba_cola_spsc.c
+ * @brief Prueba (PC) de la cola SPSC de la recepción Bluetooth.
+ *
+ * Compila src/cola_spsc.c tal cual corre en la placa y verifica:
+ * - Intercalado aleatorio en un hilo: en cada paso se sortea si actúa el
+ *   productor (una ráfaga, como la ISR vaciando el FIFO) o el consumidor,
+ *   y cada resultado se compara con una cola de referencia trivial. Cubre
+ *   cola llena, vacía, descartes y el desborde de los índices de 32 bits.
+ *   Los dos lados alternan además la forma de la transmisión: bloques
+ *   enteros o nada del lado productor, tramos contiguos (como el DMA)
+ *   del lado consumidor.
+ * - Dos hilos reales con demoras aleatorias: el productor reintenta cuando
+ *   la cola está llena, así que el consumidor (byte a byte o por tramos)
+ *   tiene que recibir la secuencia completa, en orden y sin repetidos.
+ *
+ * Compilar: gcc -O2 -pthread -Iinclude -o prueba_cola_spsc tools/prueba_cola_spsc.c src/cola_spsc.c
+ *           (con -fsanitize=thread además busca carreras de datos)
+ * Uso:      ./prueba_cola_spsc [semilla]   (devuelve 1 si algo falla)
+ *
+ * @date Noviembre 2025
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include "cola_spsc.h"
+
+#define TAMANO_COLA         256     // Mismo tamaño que bluetooth_uart.c
+#define PASOS_INTERCALADO   2000000
+#define BYTES_HILOS         5000000
+
+static int errores = 0;
+static uint32_t estado_azar = 12345;
+
+/* Generador propio (xorshift): reproducible con la misma semilla y sin
+   estado compartido con la libc entre hilos */
+static uint32_t azar(uint32_t *estado) {
+    uint32_t x = *estado;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *estado = x;
+    return x;
+}
+
+static void fallo(const char *prueba, const char *detalle, uint32_t paso) {
+    if (errores < 10) {
+        printf("%s: %s en el paso %u\n", prueba, detalle, paso);
+    }
+    errores++;
+}
+
+/* ======================= INTERCALADO EN UN HILO =========================== */
+
+static void probar_intercalado(void) {
+    static uint8_t datos[TAMANO_COLA];
+    static uint8_t referencia[TAMANO_COLA];
+    uint32_t ref_cabeza = 0, ref_cantidad = 0, ref_descartados = 0;
+    uint32_t puestos = 0, sacados = 0;
+    uint8_t siguiente = 0;
+    ColaSpsc cola;
+
+    cola_spsc_inicializar(&cola, datos, TAMANO_COLA);
+    // Índices cerca del desborde de 32 bits
+    cola.escritura = cola.lectura = 0xFFFFFF00u;
+
+    for (uint32_t paso = 0; paso < PASOS_INTERCALADO; paso++) {
+        uint32_t sorteo = azar(&estado_azar) % 4;
+        if (sorteo == 0) {
+            // Productor: un bloque de 1 a 64 bytes entero o nada (una línea)
+            uint8_t bloque[64];
+            uint32_t n = 1 + azar(&estado_azar) % 64;
+            for (uint32_t i = 0; i < n; i++) bloque[i] = (uint8_t)(siguiente + i);
+
+            uint8_t esperado = n <= TAMANO_COLA - ref_cantidad;
+            if (cola_spsc_libres(&cola) != TAMANO_COLA - ref_cantidad) fallo("Intercalado", "libres no coincide", paso);
+            if (cola_spsc_poner_bloque(&cola, bloque, n) != esperado) fallo("Intercalado", "poner_bloque no coincide", paso);
+            if (esperado) {
+                for (uint32_t i = 0; i < n; i++) {
+                    referencia[(ref_cabeza + ref_cantidad) % TAMANO_COLA] = bloque[i];
+                    ref_cantidad++;
+                }
+                puestos += n;
+            } else {
+                ref_descartados += n;
+            }
+            siguiente = (uint8_t)(siguiente + n);
+        } else if (sorteo == 1) {
+            // Consumidor tipo DMA: toma un tramo contiguo y libera una parte
+            const uint8_t *inicio;
+            uint32_t tramo = cola_spsc_tramo(&cola, &inicio);
+            uint32_t hasta_el_final = TAMANO_COLA - (cola.lectura % TAMANO_COLA);
+            uint32_t esperado = ref_cantidad < hasta_el_final ? ref_cantidad : hasta_el_final;
+            if (tramo != esperado) fallo("Intercalado", "tramo de largo incorrecto", paso);
+
+            uint32_t usados = tramo ? 1 + azar(&estado_azar) % tramo : 0;
+            for (uint32_t i = 0; i < usados; i++) {
+                if (inicio[i] != referencia[ref_cabeza]) fallo("Intercalado", "tramo fuera de orden", paso);
+                ref_cabeza = (ref_cabeza + 1) % TAMANO_COLA;
+                ref_cantidad--;
+                sacados++;
+            }
+            cola_spsc_liberar(&cola, usados);
+        } else if (sorteo == 2) {
+            // Productor: ráfaga de 1 a 16 bytes (un FIFO de la UART)
+            uint32_t rafaga = 1 + azar(&estado_azar) % 16;
+            for (uint32_t i = 0; i < rafaga; i++) {
+                uint8_t aceptado = cola_spsc_poner(&cola, siguiente);
+                uint8_t esperado = ref_cantidad < TAMANO_COLA;
+                if (aceptado != esperado) fallo("Intercalado", "poner no coincide", paso);
+                if (esperado) {
+                    referencia[(ref_cabeza + ref_cantidad) % TAMANO_COLA] = siguiente;
+                    ref_cantidad++;
+                    puestos++;
+                } else {
+                    ref_descartados++;
+                }
+                siguiente++;
+            }
+        } else {
+            // Consumidor: saca de 1 a 24 bytes (a veces más de los que hay)
+            uint32_t cuantos = 1 + azar(&estado_azar) % 24;
+            for (uint32_t i = 0; i < cuantos; i++) {
+                int byte = cola_spsc_sacar(&cola);
+                if (ref_cantidad == 0) {
+                    if (byte != -1) fallo("Intercalado", "sacó de una cola vacía", paso);
+                } else {
+                    if (byte != referencia[ref_cabeza]) fallo("Intercalado", "byte fuera de orden", paso);
+                    ref_cabeza = (ref_cabeza + 1) % TAMANO_COLA;
+                    ref_cantidad--;
+                    sacados++;
+                }
+            }
+        }
+
+        if (cola_spsc_ocupados(&cola) != ref_cantidad) fallo("Intercalado", "ocupados no coincide", paso);
+        if (cola_spsc_descartados(&cola) != ref_descartados) fallo("Intercalado", "descartes no coinciden", paso);
+    }
+
+    printf("Intercalado: %u pasos, %u puestos, %u sacados, %u descartados, máximo %u %s\n",
+           PASOS_INTERCALADO, puestos, sacados, ref_descartados,
+           cola_spsc_maximo_ocupado(&cola), errores ? "FALLO" : "OK");
+}
+
+/* ========================== DOS HILOS ===================================== */
+
+static uint8_t datos_hilos[TAMANO_COLA];
+static ColaSpsc cola_hilos;
+static uint32_t semilla_hilos;
+
+static void demora(uint32_t *estado) {
+    uint32_t r = azar(estado) % 64;
+    if (r == 0) {
+        sched_yield();
+    } else if (r < 8) {
+        for (volatile uint32_t i = 0; i < r * 50; i++) { }
+    }
+}
+
+static void *productor(void *argumento) {
+    uint32_t estado = semilla_hilos ^ 0x9E3779B9u;
+    (void)argumento;
+
+    for (uint32_t n = 0; n < BYTES_HILOS; n++) {
+        while (!cola_spsc_poner(&cola_hilos, (uint8_t)n)) {
+            sched_yield();
+        }
+        demora(&estado);
+    }
+    return NULL;
+}
+
+static void probar_hilos(void) {
+    pthread_t hilo;
+    uint32_t estado = semilla_hilos;
+    uint32_t recibidos = 0, desordenados = 0;
+
+    cola_spsc_inicializar(&cola_hilos, datos_hilos, TAMANO_COLA);
+    pthread_create(&hilo, NULL, productor, NULL);
+
+    while (recibidos < BYTES_HILOS) {
+        if (azar(&estado) & 1) {
+            // Como el DMA: lee el tramo en el lugar y recién después lo libera
+            const uint8_t *inicio;
+            uint32_t tramo = cola_spsc_tramo(&cola_hilos, &inicio);
+            for (uint32_t i = 0; i < tramo; i++) {
+                if (inicio[i] != (uint8_t)recibidos) desordenados++;
+                recibidos++;
+            }
+            cola_spsc_liberar(&cola_hilos, tramo);
+            if (tramo == 0) demora(&estado);
+            continue;
+        }
+        int byte = cola_spsc_sacar(&cola_hilos);
+        if (byte < 0) {
+            demora(&estado);
+            continue;
+        }
+        if (byte != (uint8_t)recibidos) desordenados++;
+        recibidos++;
+    }
+    pthread_join(hilo, NULL);
+
+    int ok = (desordenados == 0 && cola_spsc_sacar(&cola_hilos) == -1);
+    printf("Dos hilos: %u bytes, %u fuera de orden, máximo ocupado %u %s\n",
+           recibidos, desordenados, cola_spsc_maximo_ocupado(&cola_hilos), ok ? "OK" : "FALLO");
+    if (!ok) errores++;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc == 2) {
+        estado_azar = (uint32_t)strtoul(argv[1], NULL, 0);
+        if (estado_azar == 0) estado_azar = 1;
+    }
+    semilla_hilos = estado_azar;
+    printf("Semilla %u\n", estado_azar);
+
+    probar_intercalado();
+    probar_hilos();
+
+    printf("\n%s\n", errores ? "FALLO" : "OK: orden, llena, vacía y descartes");
+    return errores ? 1 : 0;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file prueba_divisor_uart.c
+ * @brief Prueba (PC) del cálculo de DLL/DLM/FDR de las UART.
+ *
+ * Compila src/divisor_uart.c tal cual corre en la placa y, para cada PCLK
+ * que puede elegir PCLKSEL (CCLK/1, /2, /4 y /8 con el CCLK que arma
+ * system_LPC17xx.c) y cada velocidad estándar de 1200 a 921600 bps:
+ * - Comprueba las condiciones del manual (MULVAL, DIVADDVAL, DLM:DLL >= 3
+ *   con el divisor fraccional).
+ * - Recalcula la velocidad y el error en punto flotante, sin pasar por la
+ *   aritmética entera del módulo.
+ * - Busca por fuerza bruta si alguna combinación válida tiene menos error.
+ * - Verifica que devuelva 0 justo cuando ninguna combinación queda dentro
+ *   de DIVISOR_UART_ERROR_MAXIMO_PPM (y con 0 bps).
+ * Lo mismo, sin imprimir, para un barrido de velocidades arbitrarias.
+ *
+ * Imprime la tabla de lo logrado junto al cálculo anterior de
+ * bt_inicializar(), PCLK / (16 * baudios) truncado y sin FDR.
+ *
+ * Compilar: gcc -O2 -Iinclude -o prueba_divisor_uart tools/prueba_divisor_uart.c src/divisor_uart.c -lm
+ * Uso:      ./prueba_divisor_uart   (devuelve 1 si algo falla)
+ *
+ * @date Noviembre 2025
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "divisor_uart.h"
+
+/* Reloj de system_LPC17xx.c: XTAL 12 MHz, PLL0CFG 0x00050063, CCLKCFG 3 */
+#define XTAL_HZ         12000000.0
+#define PLL0_M          (0x63 + 1)
+#define PLL0_N          (0x05 + 1)
+#define CCLK_DIVISOR    (3 + 1)
+#define CCLK_HZ         ((uint32_t)(2.0 * PLL0_M * XTAL_HZ / PLL0_N / CCLK_DIVISOR))
+
+#define PPM_TOLERANCIA  1.0     // Redondeo del error entero del módulo
+#define PASO_BARRIDO    997     // bps entre velocidades del barrido (primo)
+
+static const uint32_t velocidades[] = {
+    1200, 2400, 4800, 9600, 14400, 19200, 38400, 57600,
+    115200, 230400, 460800, 921600
+};
+#define CANTIDAD_VELOCIDADES (sizeof(velocidades) / sizeof(velocidades[0]))
+
+static const struct {
+    uint8_t pclksel;
+    uint8_t divisor;
+} opciones_pclk[] = { { 1, 1 }, { 2, 2 }, { 0, 4 }, { 3, 8 } };
+#define CANTIDAD_PCLK (sizeof(opciones_pclk) / sizeof(opciones_pclk[0]))
+
+static int errores = 0;
+
+static void fallo(uint32_t pclk, uint32_t baudios, const char *detalle) {
+    if (errores < 20) {
+        printf("PCLK %u, %u bps: %s\n", pclk, baudios, detalle);
+    }
+    errores++;
+}
+
+static double velocidad_real(uint32_t pclk, uint32_t divisor, uint32_t divaddval, uint32_t mulval) {
+    return (double)pclk / (16.0 * divisor * (1.0 + (double)divaddval / mulval));
+}
+
+static double error_ppm(double real, uint32_t baudios) {
+    return (real / baudios - 1.0) * 1e6;
+}
+
+/* Menor |error| posible: todas las fracciones y los divisores vecinos al ideal
+   (-1 si no hay ninguna combinación válida) */
+static double mejor_error_posible(uint32_t pclk, uint32_t baudios) {
+    double mejor = -1.0;
+
+    for (uint32_t mulval = 1; mulval <= 15; mulval++) {
+        for (uint32_t divaddval = 0; divaddval < mulval; divaddval++) {
+            double ideal = velocidad_real(pclk, 1, divaddval, mulval) / baudios;
+            for (int32_t divisor = (int32_t)ideal - 2; divisor <= (int32_t)ideal + 2; divisor++) {
+                if (divisor < 1 || divisor > 0xFFFF) continue;
+                if (divaddval > 0 && divisor < 3) continue;
+                double error = fabs(error_ppm(velocidad_real(pclk, divisor, divaddval, mulval), baudios));
+                if (mejor < 0 || error < mejor) mejor = error;
+            }
+        }
+    }
+    return mejor;
+}
+
+static void probar(uint32_t pclk, uint32_t baudios, uint8_t mostrar) {
+    DivisorUart r;
+    double mejor = mejor_error_posible(pclk, baudios);
+    uint8_t alcanzable = mejor >= 0 && mejor <= DIVISOR_UART_ERROR_MAXIMO_PPM;
+
+    if (!divisor_uart_calcular(pclk, baudios, &r)) {
+        if (alcanzable) fallo(pclk, baudios, "devolvió 0 con una velocidad alcanzable");
+        if (mostrar) printf("  %7u   %-28s %-28s\n", baudios, "inalcanzable", "-");
+        return;
+    }
+    if (!alcanzable) {
+        fallo(pclk, baudios, "no devolvió 0 con una velocidad inalcanzable");
+        return;
+    }
+
+    if (r.mulval < 1 || r.mulval > 15) fallo(pclk, baudios, "MULVAL fuera de 1..15");
+    if (r.divaddval >= r.mulval) fallo(pclk, baudios, "DIVADDVAL >= MULVAL");
+    if (r.divisor == 0) fallo(pclk, baudios, "DLM:DLL en 0");
+    if (r.divaddval > 0 && r.divisor < 3) fallo(pclk, baudios, "DLM:DLL < 3 con divisor fraccional");
+    if (divisor_uart_fdr(&r) != (uint8_t)(r.mulval << 4 | r.divaddval)) {
+        fallo(pclk, baudios, "FDR mal armado");
+    }
+
+    double real = velocidad_real(pclk, r.divisor, r.divaddval, r.mulval);
+    double error = error_ppm(real, baudios);
+    if (fabs(real - r.baudios_reales) > 0.5 + 1e-6) fallo(pclk, baudios, "baudios_reales no coincide");
+    if (fabs(error - r.error_ppm) > PPM_TOLERANCIA) fallo(pclk, baudios, "error_ppm no coincide");
+    if (fabs(error) > mejor + PPM_TOLERANCIA) {
+        fallo(pclk, baudios, "hay una combinación con menos error");
+    }
+    if (!mostrar) return;
+
+    /* Cálculo anterior de bt_inicializar() */
+    uint32_t divisor_anterior = pclk / (16 * baudios);
+    char logrado[40], anterior[40];
+    snprintf(logrado, sizeof(logrado), "%5u %2u/%-2u %+8.3f %%",
+             r.divisor, r.divaddval, r.mulval, error / 1e4);
+    if (divisor_anterior > 0) {
+        double error_anterior = error_ppm(velocidad_real(pclk, divisor_anterior, 0, 1), baudios);
+        snprintf(anterior, sizeof(anterior), "%5u       %+8.3f %%", divisor_anterior, error_anterior / 1e4);
+    } else {
+        snprintf(anterior, sizeof(anterior), "    0 (no transmite)");
+    }
+    printf("  %7u   %-28s %-28s\n", baudios, logrado, anterior);
+}
+
+int main(void) {
+    DivisorUart r;
+
+    for (uint32_t i = 0; i < CANTIDAD_PCLK; i++) {
+        uint32_t pclk = CCLK_HZ / opciones_pclk[i].divisor;
+        printf("PCLK = CCLK/%u = %u Hz (PCLKSEL %u)\n", opciones_pclk[i].divisor, pclk,
+               opciones_pclk[i].pclksel);
+        printf("  %7s   %-28s %-28s\n", "bps", "DLM:DLL ADD/MUL error", "sin FDR (antes)");
+        for (uint32_t v = 0; v < CANTIDAD_VELOCIDADES; v++) {
+            probar(pclk, velocidades[v], 1);
+        }
+        probar(pclk, pclk / 16, 1);                 // DLM:DLL = 1, error 0
+        probar(pclk, pclk / 16 * 102 / 100, 1);     // Justo en el límite de error
+        probar(pclk, pclk / 16 * 103 / 100, 1);     // Ya afuera
+        for (uint32_t baudios = 110; baudios < pclk / 15; baudios += PASO_BARRIDO) {
+            probar(pclk, baudios, 0);
+        }
+        if (divisor_uart_calcular(pclk, 0, &r)) fallo(pclk, 0, "aceptó 0 bps");
+        printf("\n");
+    }
+
+    if (errores == 0) {
+        printf("OK\n");
+        return 0;
+    }
+    printf("%d fallos\n", errores);
+    return 1;
+}
@@ -0,0 +1,528 @@
+/**
+ * @file prueba_lcd_i2c.c
+ * @brief Prueba (PC) de los lotes I2C de lcd_i2c.c y del volcado del framebuffer.
+ *
+ * Compila src/lcd_i2c.c y src/lcd_framebuffer.c tal cual corren en la placa
+ * sobre los periféricos simulados de tools/simulador/ (I2C0 con su IRQ) y
+ * pasa cada transacción por el HD44780 virtual de decodificador_lcd.c.
+ * Verifica, paso por paso:
+ * - Lo que queda en la DDRAM (y en la CGRAM para los glifos).
+ * - 6 bytes de bus por carácter o comando: dos nibbles con su pulso de
+ *   enable. Se compara contra lo que el decodificador ejecutó.
+ * - Cuántas transacciones (START..STOP) sale cada operación: un lote es
+ *   una sola, salvo que pase los 128 bytes del buffer de lote o que cruce
+ *   el final de la cola circular de 1024 (sale en dos tramos; esos cortes
+ *   se cuentan aparte).
+ * - El direccionamiento: lcd_establecer_cursor() + lcd_escribir_byte() en
+ *   las 80 celdas, cada marca en su lugar de la DDRAM y sin pisar a otra;
+ *   fuera de rango (fila 4, columna 20) no tiene que salir nada al bus.
+ * - Que lcd_obtener_bytes_enviados(), lcd_obtener_transacciones_i2c() y
+ *   lcd_fb_bytes_ultimo_volcado() coincidan con lo que llegó al bus.
+ *
+ * Hasta ahí el bus termina cada transacción en el acto. Al final se repite
+ * con el bus asíncrono (sim_i2c_asincrono()): cada transacción dura su
+ * tiempo de bus a 100 kHz y el reloj virtual lo hace correr SIGALRM cada
+ * PERIODO_SENAL_US, así que I2C0_IRQHandler entra en cualquier punto del
+ * main, como en la placa. Son escrituras al azar mucho más rápidas que el
+ * bus: el main tiene que esperar lugar en la cola (i2c_enviarLote()) y la
+ * ISR tiene que tomar lo que se encoló mientras transmitía. Se verifica la
+ * DDRAM final contra lo escrito, que nunca se lance una transacción con
+ * otra en vuelo y que los bytes en vuelo no se pisen (el sumidero los lee
+ * recién al final del tiempo de bus).
+ *
+ * Límite: se reemplaza la API del driver (I2C_MasterTransferData(),
+ * I2C_MasterHandler()), no los registros de I2C0. "Un START por lote" es
+ * una llamada a I2C_MasterTransferData() por lote; la máquina de estados
+ * de lpc17xx_i2c.c (I2CONSET, I2STAT, I2DAT) no corre acá.
+ *
+ * Compilar: gcc -O2 -no-pie -Itools/simulador -Iinclude -ICMSISv2p00_LPC17xx/inc \
+ *               -ICMSISv2p00_LPC17xx/Drivers/inc -o prueba_lcd_i2c tools/prueba_lcd_i2c.c \
+ *               tools/simulador/perifericos_sim.c src/lcd_i2c.c src/lcd_framebuffer.c src/perfil_isr.c \
+ *               src/planificador.c
+ * Uso:      ./prueba_lcd_i2c   (devuelve 1 si alguna verificación falla)
+ *
+ * @date Noviembre 2025
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/time.h>
+#include "LPC17xx.h"
+#include "lpc17xx_i2c.h"
+#include "perifericos_sim.h"
+#include "lcd_i2c.h"
+#include "lcd_framebuffer.h"
+
+#define DECODIFICADOR_LCD_SIN_MAIN
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include "decodificador_lcd.c"
+#pragma GCC diagnostic pop
+
+/* === MISMOS VALORES QUE lcd_i2c.c === */
+#define BYTES_POR_OPERACION 6       // Nibble alto + pulso, nibble bajo + pulso
+#define TAM_LOTE_I2C        128
+#define TAM_COLA_I2C        1024
+#define TRANSACCIONES_MAX   32
+#define BITS_POR_BYTE_I2C   9       // 8 datos + ACK
+#define RELOJ_I2C_HZ        100000
+
+/* === BUS ASÍNCRONO === */
+#define PERIODO_SENAL_US    10      // Tiempo real entre avances del reloj
+#define PASO_RELOJ_NS       250000  // Tiempo virtual por señal
+#define ESCRITURAS_AZAR     1000
+#define CARRERAS_FIN_DE_BUS 3000
+
+static int errores = 0;
+static uint32_t largos[TRANSACCIONES_MAX];      // Bytes de cada transacción del paso
+static uint32_t transacciones_paso = 0;
+static uint32_t cortes_paso = 0;                // Transacciones que terminaron en el final de la cola
+static uint32_t posicion_cola = 0;              // Todo lo encolado pasa por el bus, en orden
+static uint32_t mayor_transaccion = 0;
+static uint32_t senales_postergadas = 0;        // Llegaron con el modelo a mitad de un cambio
+
+/* === SUMIDERO I2C === */
+
+static void recibir_i2c(uint8_t direccion, const uint8_t *bytes, uint32_t cantidad) {
+    (void)direccion;
+    for (uint32_t i = 0; i < cantidad; i++) {
+        pcf8574_escribir(bytes[i]);
+    }
+    frame.transacciones++;
+    if (transacciones_paso < TRANSACCIONES_MAX) largos[transacciones_paso] = cantidad;
+    transacciones_paso++;
+    if (cantidad > mayor_transaccion) mayor_transaccion = cantidad;
+    posicion_cola += cantidad;
+    if (posicion_cola == TAM_COLA_I2C) cortes_paso++;
+    posicion_cola %= TAM_COLA_I2C;
+}
+
+/* === VERIFICACIÓN === */
+
+static void empezar_paso(void) {
+    memset(&frame, 0, sizeof(frame));
+    transacciones_paso = 0;
+    cortes_paso = 0;
+}
+
+static uint32_t operaciones(const Contadores *c) {
+    return c->caracteres + c->cursores + c->borrados + c->cgram + c->otros;
+}
+
+/**
+ * @brief Compara lo que llegó al bus en el paso con lo esperado
+ * @param caracteres Datos escritos (DDRAM o CGRAM)
+ * @param cursores Set DDRAM address
+ * @param transacciones START..STOP esperados (sin contar los cortes de la cola)
+ */
+static void comprobar_paso(const char *prueba, uint32_t caracteres, uint32_t cursores, uint32_t transacciones) {
+    // Un lote que termina justo en el final de la cola no es un corte: se aceptan los dos casos
+    uint8_t transacciones_ok = transacciones_paso == transacciones ||
+                               transacciones_paso == transacciones + cortes_paso;
+    uint8_t ok = frame.caracteres == caracteres && frame.cursores == cursores &&
+                 frame.bytes == BYTES_POR_OPERACION * operaciones(&frame) &&
+                 transacciones_ok && frame.fuera_de_pantalla == 0;
+
+    printf("%-34s %4u bytes, %2u transacciones [", prueba, frame.bytes, transacciones_paso);
+    for (uint32_t i = 0; i < transacciones_paso && i < TRANSACCIONES_MAX; i++) {
+        printf("%s%u", i ? " " : "", largos[i]);
+    }
+    printf("]%s | chars %u, cursor %u %s\n", cortes_paso ? " (vuelta de la cola)" : "",
+           frame.caracteres, frame.cursores, ok ? "OK" : "FALLO");
+    if (!ok) {
+        printf("  esperado: chars %u, cursor %u, %u transacciones, %u bytes por operación\n",
+               caracteres, cursores, transacciones, BYTES_POR_OPERACION);
+        errores++;
+    }
+    sumar(&total, &frame);
+}
+
+/**
+ * @brief La fila del LCD virtual tiene que empezar con el texto en la columna dada
+ */
+static void comprobar_fila(const char *prueba, uint8_t fila, uint8_t columna, const char *texto) {
+    size_t largo = strlen(texto);
+    if (memcmp(&lcd.ddram[inicio_fila[fila] + columna], texto, largo) != 0) {
+        printf("%s: la fila %u no tiene \"%s\" en la columna %u\n", prueba, fila, texto, columna);
+        imprimir_pantalla();
+        errores++;
+    }
+}
+
+/**
+ * @brief Los contadores de lcd_i2c.c tienen que coincidir con lo que llegó al bus
+ */
+static void comprobar_contadores(void) {
+    uint8_t ok = lcd_obtener_bytes_enviados() == total.bytes &&
+                 lcd_obtener_transacciones_i2c() == total.transacciones;
+    printf("Contadores de lcd_i2c.c: %u bytes, %u transacciones (bus: %u, %u) %s\n",
+           lcd_obtener_bytes_enviados(), lcd_obtener_transacciones_i2c(),
+           total.bytes, total.transacciones, ok ? "OK" : "FALLO");
+    if (!ok) errores++;
+}
+
+/* === PRUEBAS === */
+
+static void probar_inicializacion(void) {
+    empezar_paso();
+    lcd_inicializar();
+    // Tres nibbles de reset sueltos, después el lote hasta el clear y el del modo de entrada
+    uint8_t ok = lcd.modo_4bits && transacciones_paso == 5 && frame.borrados == 1 &&
+                 lcd_transmision_completa();
+    printf("%-34s %4u bytes, %2u transacciones, modo 4 bits %s\n", "Inicialización",
+           frame.bytes, transacciones_paso, ok ? "OK" : "FALLO");
+    if (!ok) errores++;
+    comprobar_fila("Inicialización", 0, 0, "                    ");
+    sumar(&total, &frame);
+}
+
+static void probar_escrituras(void) {
+    // Con lote: cursor + texto en una sola transacción
+    empezar_paso();
+    lcd_iniciar_lote();
+    lcd_establecer_cursor(1, 3);
+    lcd_escribir("HOLA");
+    lcd_terminar_lote();
+    comprobar_paso("Cursor + 4 caracteres en lote", 4, 1, 1);
+    comprobar_fila("Lote", 1, 0, "   HOLA ");
+
+    // Sin lote: cada llamada cierra su propia transacción
+    empezar_paso();
+    lcd_establecer_cursor(2, 0);
+    lcd_escribir("AB");
+    lcd_escribir_byte('C');
+    comprobar_paso("Cursor, 2 y 1 caracteres sin lote", 3, 1, 3);
+    comprobar_fila("Sin lote", 2, 0, "ABC ");
+
+    // Lotes anidados: sale al cerrar el más externo
+    empezar_paso();
+    lcd_iniciar_lote();
+    lcd_establecer_cursor(3, 18);
+    lcd_iniciar_lote();
+    lcd_escribir("XY");
+    lcd_terminar_lote();
+    uint8_t pendiente = transacciones_paso == 0;
+    lcd_terminar_lote();
+    comprobar_paso("Lotes anidados", 2, 1, 1);
+    comprobar_fila("Lotes anidados", 3, 18, "XY");
+    if (!pendiente) {
+        printf("Lotes anidados: el lote interno salió antes de cerrar el externo FALLO\n");
+        errores++;
+    }
+
+    // Fila entera: cursor + 20 espacios + cursor = 132 bytes, pasa el buffer de lote
+    empezar_paso();
+    lcd_borrarFila(1);
+    comprobar_paso("Borrar fila (132 > 128 bytes)", 20, 2, 2);
+    comprobar_fila("Borrar fila", 1, 0, "                    ");
+    if (cortes_paso == 0 && largos[0] != TAM_LOTE_I2C) {
+        printf("Borrar fila: la primera transacción tiene %u bytes, no %u FALLO\n", largos[0], TAM_LOTE_I2C);
+        errores++;
+    }
+}
+
+/**
+ * @brief Marca cada celda con lcd_establecer_cursor() y lcd_escribir_byte() y
+ * busca la marca en la DDRAM virtual
+ */
+static void probar_direccionamiento(void) {
+    uint32_t celdas_mal = 0;
+
+    // Borrar antes: que una marca no coincida con lo que ya había
+    empezar_paso();
+    lcd_borrarPantalla();
+    sumar(&total, &frame);
+
+    empezar_paso();
+    for (uint8_t f = 0; f < LCD_FILAS; f++) {
+        for (uint8_t c = 0; c < LCD_COLUMNAS; c++) {
+            lcd_establecer_cursor(f, c);
+            lcd_escribir_byte('A' + (f * LCD_COLUMNAS + c) % 26);
+        }
+    }
+    // Recién al final: una celda pisada por otra posterior también cuenta
+    for (uint8_t f = 0; f < LCD_FILAS; f++) {
+        for (uint8_t c = 0; c < LCD_COLUMNAS; c++) {
+            uint8_t marca = 'A' + (f * LCD_COLUMNAS + c) % 26;
+            if (lcd.ddram[inicio_fila[f] + c] != marca) {
+                printf("Direccionamiento: la celda (%u,%u) tiene '%c', no '%c' FALLO\n",
+                       f, c, lcd.ddram[inicio_fila[f] + c], marca);
+                celdas_mal++;
+            }
+        }
+    }
+    comprobar_paso("Cursor + marca en las 80 celdas", LCD_FILAS * LCD_COLUMNAS, LCD_FILAS * LCD_COLUMNAS,
+                   2 * LCD_FILAS * LCD_COLUMNAS);
+    if (celdas_mal) {
+        imprimir_pantalla();
+        errores++;
+    }
+
+    // Fuera de rango no sale nada, ni siquiera un cursor truncado
+    empezar_paso();
+    lcd_establecer_cursor(LCD_FILAS, 0);
+    lcd_establecer_cursor(0, LCD_COLUMNAS);
+    lcd_establecer_cursor(0xFF, 0xFF);
+    comprobar_paso("Cursor (4,0), (0,20) y (255,255)", 0, 0, 0);
+}
+
+static void probar_framebuffer(void) {
+    static const char *const filas[LCD_FB_FILAS] = {
+        "DINO    000      000", "    ##      #       ", "  D          #  @  ", "####################",
+    };
+
+    empezar_paso();
+    lcd_fb_inicializar();
+    uint8_t ok = frame.borrados == 1 && lcd_fb_bytes_ultimo_volcado() == frame.bytes;
+    printf("%-34s %4u bytes %s\n", "Framebuffer: borrar pantalla", frame.bytes, ok ? "OK" : "FALLO");
+    if (!ok) errores++;
+    sumar(&total, &frame);
+
+    // Tras el clear solo salen las celdas que no son espacio, por tramos
+    for (uint8_t f = 0; f < LCD_FB_FILAS; f++) {
+        lcd_fb_escribir(f, 0, filas[f]);
+    }
+    empezar_paso();
+    lcd_fb_volcar();
+    comprobar_paso("Volcado contra pantalla borrada", 36, 8, 4);
+    for (uint8_t f = 0; f < LCD_FB_FILAS; f++) {
+        comprobar_fila("Contra pantalla borrada", f, 0, filas[f]);
+    }
+
+    // Pantalla completa: una transacción por fila (cursor + 20 = 126 bytes)
+    lcd_fb_invalidar();
+    empezar_paso();
+    lcd_fb_volcar();
+    comprobar_paso("Volcado de pantalla completa", 80, 4, 4);
+    for (uint8_t f = 0; f < LCD_FB_FILAS; f++) {
+        comprobar_fila("Pantalla completa", f, 0, filas[f]);
+    }
+    if (lcd_fb_bytes_ultimo_volcado() != frame.bytes) {
+        printf("lcd_fb_bytes_ultimo_volcado() = %u, el bus vio %u FALLO\n", lcd_fb_bytes_ultimo_volcado(), frame.bytes);
+        errores++;
+    }
+
+    // Sin cambios no sale nada
+    empezar_paso();
+    lcd_fb_volcar();
+    comprobar_paso("Volcado sin cambios", 0, 0, 0);
+
+    // Dos tramos en la fila 2, cada uno con su cursor; una transacción por fila
+    lcd_fb_escribir(2, 2, " D");
+    lcd_fb_escribir_caracter(2, 15, '@');
+    lcd_fb_escribir_caracter(2, 16, ' ');
+    lcd_fb_escribir(0, 17, "001");          // Pisa "000": solo cambia el último dígito
+    empezar_paso();
+    lcd_fb_volcar();
+    comprobar_paso("Diferencias en dos filas", 1 + 4, 1 + 2, 2);
+    comprobar_fila("Diferencias", 0, 0, "DINO    000      001");
+    comprobar_fila("Diferencias", 2, 0, "   D         # @    ");
+
+    // Glifo nuevo: 0x40 + 8 filas de patrón en CGRAM, y después la celda que lo usa
+    static const uint8_t patron[8] = {0x04, 0x0E, 0x1F, 0x15, 0x1F, 0x0A, 0x11, 0x00};
+    empezar_paso();
+    uint8_t glifo = lcd_fb_glifo(0x1234, patron);
+    lcd_fb_escribir_caracter(1, 0, glifo);
+    lcd_fb_volcar();
+    uint8_t slot = glifo & 0x07;
+    ok = frame.cgram == 1 && memcmp(&lcd.cgram[slot * 8], patron, sizeof(patron)) == 0 &&
+         lcd.ddram[inicio_fila[1]] == glifo;
+    comprobar_paso("Glifo CGRAM + celda", 8 + 1, 1, 2);
+    if (!ok) {
+        printf("Glifo: CGRAM o DDRAM no tienen el patrón del slot %u FALLO\n", slot);
+        errores++;
+    }
+}
+
+/* === BUS ASÍNCRONO === */
+
+/**
+ * @brief SIGALRM: el "hardware" avanza el reloj virtual en medio del main
+ */
+static void avanzar_reloj(int senal) {
+    static uint64_t atrasado_ns = 0;
+    (void)senal;
+    atrasado_ns += PASO_RELOJ_NS;
+    if (sim_ocupado()) {
+        senales_postergadas++;
+        return;
+    }
+    uint64_t ns = atrasado_ns;
+    atrasado_ns = 0;
+    sim_avanzar_ns(ns);
+}
+
+static void programar_senal(uint32_t periodo_us) {
+    struct itimerval t = {
+        .it_interval = { .tv_sec = 0, .tv_usec = periodo_us },
+        .it_value = { .tv_sec = 0, .tv_usec = periodo_us },
+    };
+    setitimer(ITIMER_REAL, &t, NULL);
+}
+
+static uint32_t azar(void) {
+    static uint32_t estado = 12345;
+    estado ^= estado << 13;
+    estado ^= estado >> 17;
+    estado ^= estado << 5;
+    return estado;
+}
+
+static char pantalla_esperada[LCD_FILAS][LCD_COLUMNAS];
+
+/**
+ * @brief Cursor + texto, con o sin lote, anotado en pantalla_esperada
+ */
+static void escribir_texto(uint8_t fila, uint8_t columna, const char *texto, uint8_t en_lote) {
+    memcpy(&pantalla_esperada[fila][columna], texto, strlen(texto));
+    if (en_lote) lcd_iniciar_lote();
+    lcd_establecer_cursor(fila, columna);
+    lcd_escribir(texto);
+    if (en_lote) lcd_terminar_lote();
+}
+
+static void texto_al_azar(char *texto, uint8_t largo) {
+    for (uint8_t k = 0; k < largo; k++) {
+        texto[k] = 'A' + azar() % 26;
+    }
+    texto[largo] = '\0';
+}
+
+/**
+ * @brief El main mucho más rápido que el bus: la cola se llena y
+ * i2c_enviarLote() espera lugar; la ISR toma lo que se encoló mientras
+ * transmitía
+ */
+static void escribir_mas_rapido_que_el_bus(void) {
+    char texto[LCD_COLUMNAS + 1];
+
+    for (uint32_t i = 0; i < ESCRITURAS_AZAR; i++) {
+        uint8_t fila = azar() % LCD_FILAS;
+        uint8_t columna = azar() % LCD_COLUMNAS;
+        if (i % 50 == 49) {
+            lcd_borrarFila(fila);
+            memset(pantalla_esperada[fila], ' ', LCD_COLUMNAS);
+            continue;
+        }
+        uint8_t largo = 1 + azar() % 8;
+        if (columna + largo > LCD_COLUMNAS) largo = LCD_COLUMNAS - columna;  // Sin pasar a otra fila
+        texto_al_azar(texto, largo);
+        escribir_texto(fila, columna, texto, i % 3 == 0);
+    }
+}
+
+/**
+ * @brief Una fila entera justo cuando termina la única transacción en vuelo
+ *
+ * Con el bus por vaciarse, la ISR puede encontrar la cola vacía (y dejar
+ * el bus libre) en medio de i2c_enviarLote(): es la carrera entre publicar
+ * la cabeza y mirar transferencia_activa. Si la pierde, la fila queda
+ * varada en la cola con el bus parado: lcd_transmision_completa() tiene
+ * que implicar que todo lo encolado llegó al bus. La señal cae en
+ * cualquier punto, así que cada intento la encuentra en la ventana con una
+ * probabilidad chica; por eso son muchos.
+ * @return Veces que lcd_transmision_completa() dio 1 con bytes sin salir
+ */
+static uint32_t escribir_al_ritmo_del_bus(uint32_t bytes_antes) {
+    char texto[LCD_COLUMNAS + 1];
+    uint32_t varados = 0;
+    uint64_t duracion_ns = (uint64_t)((6 + 6 + 1) * BITS_POR_BYTE_I2C + 2) * 1000000000ULL / RELOJ_I2C_HZ;
+
+    for (uint32_t i = 0; i < CARRERAS_FIN_DE_BUS; i++) {
+        while (!lcd_transmision_completa()) {
+        }
+        if (frame.bytes != lcd_obtener_bytes_enviados() - bytes_antes) varados++;
+        texto_al_azar(texto, 1);
+        escribir_texto(azar() % LCD_FILAS, azar() % LCD_COLUMNAS, texto, 1);    // 12 bytes en vuelo
+        uint64_t fin_ns = sim_ahora_ns() + duracion_ns;
+        while (sim_ahora_ns() + PASO_RELOJ_NS < fin_ns) {
+        }
+        texto_al_azar(texto, LCD_COLUMNAS);
+        escribir_texto(azar() % LCD_FILAS, 0, texto, 1);    // La próxima señal termina el bus
+    }
+    return varados;
+}
+
+static void probar_bus_asincrono(void) {
+    struct sigaction accion;
+    SimEstadisticas antes, despues;
+
+    for (uint8_t f = 0; f < LCD_FILAS; f++) {
+        memcpy(pantalla_esperada[f], &lcd.ddram[inicio_fila[f]], LCD_COLUMNAS);
+    }
+    empezar_paso();
+    mayor_transaccion = 0;
+    uint32_t bytes_antes = lcd_obtener_bytes_enviados();
+    uint64_t inicio_ns = sim_ahora_ns();
+    sim_obtener_estadisticas(&antes);
+
+    memset(&accion, 0, sizeof(accion));
+    accion.sa_handler = avanzar_reloj;
+    sigemptyset(&accion.sa_mask);
+    sigaction(SIGALRM, &accion, NULL);
+    sim_i2c_asincrono(1);
+    programar_senal(PERIODO_SENAL_US);
+
+    escribir_mas_rapido_que_el_bus();
+    uint64_t encolado_ns = sim_ahora_ns() - inicio_ns;
+    uint32_t encolados = lcd_obtener_bytes_enviados() - bytes_antes;
+    uint32_t varados = escribir_al_ritmo_del_bus(bytes_antes);
+    lcd_esperar_transmision();
+    if (frame.bytes != lcd_obtener_bytes_enviados() - bytes_antes) varados++;
+
+    programar_senal(0);
+    signal(SIGALRM, SIG_DFL);
+    sim_i2c_asincrono(0);
+    sim_obtener_estadisticas(&despues);
+
+    // Mientras el main encolaba, el bus sacó todo salvo lo que entra en la cola
+    uint64_t bus_minimo_ns = 0;
+    if (encolados > TAM_COLA_I2C - 1) {
+        bus_minimo_ns = (uint64_t)(encolados - (TAM_COLA_I2C - 1)) * BITS_POR_BYTE_I2C * 1000000000ULL / RELOJ_I2C_HZ;
+    }
+    uint32_t solapadas = despues.i2c_solapadas - antes.i2c_solapadas;
+    uint8_t ok = frame.bytes == lcd_obtener_bytes_enviados() - bytes_antes &&
+                 frame.bytes == BYTES_POR_OPERACION * operaciones(&frame) &&
+                 frame.fuera_de_pantalla == 0 && solapadas == 0 && varados == 0 &&
+                 mayor_transaccion > TAM_LOTE_I2C && encolado_ns >= bus_minimo_ns;
+    for (uint8_t f = 0; f < LCD_FILAS; f++) {
+        if (memcmp(pantalla_esperada[f], &lcd.ddram[inicio_fila[f]], LCD_COLUMNAS) != 0) {
+            printf("Bus asíncrono: la fila %u no es \"%.20s\"\n", f, pantalla_esperada[f]);
+            ok = 0;
+        }
+    }
+
+    printf("%-34s %4u bytes, %u transacciones (la mayor de %u), cola hasta %u bytes %s\n",
+           "Bus asíncrono con SIGALRM", frame.bytes, transacciones_paso, mayor_transaccion,
+           lcd_cola_maximo_ocupado(), ok ? "OK" : "FALLO");
+    printf("  encolar %u bytes llevó %.0f ms de bus (al menos %.0f), %u señales postergadas, %u solapadas, %u varados\n",
+           encolados, encolado_ns / 1e6, bus_minimo_ns / 1e6, senales_postergadas, solapadas, varados);
+    if (!ok) {
+        imprimir_pantalla();
+        errores++;
+    }
+    sumar(&total, &frame);
+}
+
+int main(void) {
+    lcd_reiniciar();
+    sim_inicializar();
+    sim_conectar(recibir_i2c, NULL, NULL);
+    I2C_Init(LPC_I2C0, 100000);
+    I2C_Cmd(LPC_I2C0, ENABLE);
+    NVIC_EnableIRQ(I2C0_IRQn);
+
+    probar_inicializacion();
+    probar_escrituras();
+    probar_direccionamiento();
+    probar_framebuffer();
+    probar_bus_asincrono();
+    comprobar_contadores();
+    printf("\n");
+    imprimir_pantalla();
+
+    printf("\n%s\n", errores ? "FALLO" : "OK: DDRAM, direccionamiento, bytes por carácter, transacciones por lote y bus asíncrono");
+    return errores ? 1 : 0;
+}
@@ -0,0 +1,216 @@
+/**
+ * @file prueba_mezclador.c
+ * @brief Prueba (PC) de amplitud y costo del mezclador de audio.
+ *
+ * Compila src/mezclador_audio.c tal cual corre en la placa y verifica:
+ * - Amplitud pico a pico de una voz para varios volúmenes (voz y maestro),
+ *   contra 1023 x volumen, con tolerancia de 2 LSB.
+ * - Sin voces activas la salida es el punto medio (512).
+ * - Con 4 voces al 100% en fase la salida se satura dentro de 0..1023 y se
+ *   cuentan las muestras recortadas.
+ * - La envolvente: el ataque sube bloque a bloque hasta el pico, el
+ *   sostenido queda en su nivel y la liberación apaga la voz a tiempo.
+ * - Cada forma de onda de formas_onda[] con una voz plena: queda dentro de
+ *   0..1023 sin saturar, y el cambio de forma no cambia el costo por muestra.
+ * - Ciclos por bloque con 0..4 voces, medidos con el contador de ciclos del
+ *   procesador (rdtsc en x86; en otras arquitecturas, clock()).
+ *
+ * Compilar: gcc -O2 -Iinclude -o prueba_mezclador tools/prueba_mezclador.c src/mezclador_audio.c src/formas_onda.c
+ * Uso:      ./prueba_mezclador   (devuelve 1 si alguna verificación falla)
+ *
+ * @date Noviembre 2025
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include "mezclador_audio.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LEER_CICLOS()  __rdtsc()
+#define UNIDAD_CICLOS  "ciclos TSC"
+#else
+#define LEER_CICLOS()  ((uint64_t)clock())
+#define UNIDAD_CICLOS  "ticks de clock()"
+#endif
+
+/* === MISMA FORMA DE ONDA INICIAL QUE melodias_dac.c === */
+#define TRIANGULAR  formas_onda[MELODIAS_FORMA_TRIANGULAR][0]
+
+/* 625 Hz a 20 kHz avanza exactamente 8 entradas de tabla por muestra, así
+   que se pasa por el pico (muestra 64) y el valle (192) de la triangular */
+#define FRECUENCIA_PRUEBA_HZ  625
+#define BLOQUES_MEDICION      20000
+#define TOLERANCIA_LSB        2
+
+static int errores = 0;
+
+static uint16_t valor_dac(uint32_t palabra) {
+    return (uint16_t)((palabra >> 6) & 0x3FF);
+}
+
+/**
+ * @brief Renderiza varios bloques y devuelve el mínimo y el máximo.
+ */
+static void medir_rango(int bloques, uint16_t *minimo, uint16_t *maximo) {
+    uint32_t bloque[MELODIAS_MUESTRAS_BLOQUE];
+    *minimo = 0xFFFF;
+    *maximo = 0;
+    for (int b = 0; b < bloques; b++) {
+        mezclador_renderizar(bloque);
+        for (int i = 0; i < MELODIAS_MUESTRAS_BLOQUE; i++) {
+            uint16_t v = valor_dac(bloque[i]);
+            if (v < *minimo) *minimo = v;
+            if (v > *maximo) *maximo = v;
+        }
+    }
+}
+
+static void verificar_amplitud(uint8_t volumen_voz, uint8_t volumen_maestro) {
+    uint16_t minimo, maximo;
+
+    mezclador_inicializar(TRIANGULAR);
+    mezclador_establecer_volumen_maestro(volumen_maestro);
+    mezclador_establecer_volumen_voz(0, volumen_voz);
+    mezclador_establecer_incremento(0, mezclador_incremento_fase(FRECUENCIA_PRUEBA_HZ));
+    medir_rango(8, &minimo, &maximo);
+
+    int esperado = (MEZCLADOR_MAXIMO_DAC * volumen_voz * volumen_maestro) / 10000;
+    int medido = maximo - minimo;
+    int ok = abs(medido - esperado) <= TOLERANCIA_LSB;
+    printf("Voz %3u%% x maestro %3u%%: pico a pico %4d (esperado %4d) [%4u..%4u] %s\n",
+           volumen_voz, volumen_maestro, medido, esperado, minimo, maximo, ok ? "OK" : "FALLO");
+    if (!ok) errores++;
+}
+
+static void verificar_silencio(void) {
+    uint16_t minimo, maximo;
+
+    mezclador_inicializar(TRIANGULAR);
+    medir_rango(4, &minimo, &maximo);
+    int ok = (minimo == MEZCLADOR_MEDIO_DAC && maximo == MEZCLADOR_MEDIO_DAC);
+    printf("Silencio: [%u..%u] %s\n", minimo, maximo, ok ? "OK" : "FALLO");
+    if (!ok) errores++;
+}
+
+static void verificar_saturacion(void) {
+    uint16_t minimo, maximo;
+
+    mezclador_inicializar(TRIANGULAR);
+    for (uint8_t v = 0; v < MELODIAS_VOCES; v++) {
+        mezclador_establecer_incremento(v, mezclador_incremento_fase(FRECUENCIA_PRUEBA_HZ));
+    }
+    medir_rango(4, &minimo, &maximo);
+    uint32_t saturadas = mezclador_obtener_saturadas();
+    int ok = (minimo == 0 && maximo == MEZCLADOR_MAXIMO_DAC && saturadas > 0);
+    printf("%d voces al 100%%: [%u..%u], %u muestras saturadas %s\n",
+           MELODIAS_VOCES, minimo, maximo, saturadas, ok ? "OK" : "FALLO");
+    if (!ok) errores++;
+}
+
+static void verificar_envolvente(void) {
+    // 32 ms = 10 bloques de 3.2 ms por etapa
+    static const EnvolventeADSR envolvente = { 32, 32, 50, 32 };
+    uint16_t minimo, maximo;
+    int anterior = -1, sube = 1, baja = 1, bloques_liberacion = 0;
+
+    mezclador_inicializar(TRIANGULAR);
+    mezclador_disparar(0, mezclador_incremento_fase(FRECUENCIA_PRUEBA_HZ), &envolvente);
+
+    for (int b = 0; b < 10; b++) {
+        medir_rango(1, &minimo, &maximo);
+        if (maximo - minimo < anterior) sube = 0;
+        anterior = maximo - minimo;
+    }
+    int pico = anterior;
+
+    medir_rango(20, &minimo, &maximo);     // Decaimiento y sostenido
+    medir_rango(1, &minimo, &maximo);
+    int sostenido = maximo - minimo;
+
+    mezclador_liberar(0);
+    anterior = sostenido;
+    while (mezclador_voz_activa(0) && bloques_liberacion < 100) {
+        medir_rango(1, &minimo, &maximo);
+        if (maximo - minimo > anterior) baja = 0;
+        anterior = maximo - minimo;
+        bloques_liberacion++;
+    }
+
+    int ok = sube && baja && abs(pico - MEZCLADOR_MAXIMO_DAC) <= TOLERANCIA_LSB &&
+             abs(sostenido - MEZCLADOR_MAXIMO_DAC / 2) <= TOLERANCIA_LSB &&
+             bloques_liberacion <= 11 && !mezclador_voz_activa(0);
+    printf("Envolvente: pico %d, sostenido %d, liberación en %d bloques %s\n",
+           pico, sostenido, bloques_liberacion, ok ? "OK" : "FALLO");
+    if (!ok) errores++;
+}
+
+static void verificar_formas(void) {
+    static const char *nombres[MELODIAS_FORMAS] = {
+        "triangular", "seno", "sierra", "cuadrada 50%", "cuadrada 25%", "cuadrada 12.5%", "ruido"
+    };
+    uint16_t minimo, maximo;
+
+    for (uint8_t f = 0; f < MELODIAS_FORMAS; f++) {
+        for (uint8_t b = 0; b < MELODIAS_BANDAS_FORMA; b++) {
+            mezclador_inicializar(TRIANGULAR);
+            mezclador_establecer_forma(0, formas_onda[f][b]);
+            mezclador_establecer_incremento(0, mezclador_incremento_fase(LA_4));
+            medir_rango(8, &minimo, &maximo);
+
+            // Las formas están normalizadas a ±127: un extremo toca 0 o 1023
+            int ok = mezclador_obtener_saturadas() == 0 &&
+                     (minimo == 0 || maximo == MEZCLADOR_MAXIMO_DAC);
+            if (b == 0 || !ok) {
+                printf("Forma %-15s banda %u: [%4u..%4u] %s\n", nombres[f], b, minimo, maximo,
+                       ok ? "OK" : "FALLO");
+            }
+            if (!ok) errores++;
+        }
+    }
+}
+
+static void medir_ciclos(void) {
+    uint32_t bloque[MELODIAS_MUESTRAS_BLOQUE];
+    static const uint16_t frecuencias[MELODIAS_VOCES] = {440, 659, 784, 988};
+
+    printf("\nCosto por bloque de %d muestras (%s):\n", MELODIAS_MUESTRAS_BLOQUE, UNIDAD_CICLOS);
+    for (uint8_t activas = 0; activas <= MELODIAS_VOCES; activas++) {
+        mezclador_inicializar(TRIANGULAR);
+        for (uint8_t v = 0; v < activas; v++) {
+            mezclador_establecer_incremento(v, mezclador_incremento_fase(frecuencias[v]));
+        }
+
+        uint64_t peor = 0, total = 0;
+        for (int b = 0; b < BLOQUES_MEDICION; b++) {
+            uint64_t inicio = LEER_CICLOS();
+            mezclador_renderizar(bloque);
+            uint64_t ciclos = LEER_CICLOS() - inicio;
+            total += ciclos;
+            if (ciclos > peor) peor = ciclos;
+        }
+        printf("  %u voces: promedio %6.1f, peor %6llu, %.2f por muestra\n",
+               activas, (double)total / BLOQUES_MEDICION, (unsigned long long)peor,
+               (double)total / BLOQUES_MEDICION / MELODIAS_MUESTRAS_BLOQUE);
+    }
+}
+
+int main(void) {
+    static const uint8_t volumenes[] = {100, 75, 50, 25, 10, 0};
+
+    for (size_t i = 0; i < sizeof(volumenes); i++) {
+        verificar_amplitud(volumenes[i], 100);
+    }
+    verificar_amplitud(100, 50);
+    verificar_amplitud(50, 50);
+    verificar_silencio();
+    verificar_saturacion();
+    verificar_envolvente();
+    verificar_formas();
+    medir_ciclos();
+
+    printf("\n%s\n", errores ? "FALLO" : "OK: amplitud, silencio, saturación, envolvente y formas");
+    return errores ? 1 : 0;
+}
@@ -0,0 +1,174 @@
+/**
+ * @file rendimiento_serpiente.c
+ * @brief Medición (PC) del costo por tick de mover_serpiente() según la longitud.
+ *
+ * Incluye src/snake_game.c tal cual (con el mundo agrandado a 255x255, el
+ * máximo que admiten las coordenadas de 8 bits) para llegar a las
+ * funciones static: la cola circular del cuerpo y el mapa de ocupación.
+ *
+ * La serpiente se arma sobre un ciclo hamiltoniano de 255x254 celdas (fila
+ * 0 hacia la derecha, zigzag por las columnas 1..254 y vuelta por la
+ * columna 0), así que puede avanzar para siempre sin chocar con cualquier
+ * longitud hasta 64769 segmentos. La comida queda fuera del tablero
+ * (POSICION_INVALIDA) para que cada paso sea un movimiento simple: cabeza
+ * nueva, cola soltada, dos bits del mapa y la vista.
+ *
+ * Para cada longitud mide el mejor de varios intentos de PASOS_MEDIDOS
+ * movimientos y, al final, comprueba que el cuerpo siga consistente (mapa
+ * de ocupación con snake_length celdas, cabeza donde corresponde). Si el
+ * costo por paso crece más que FACTOR_MAXIMO entre la longitud más barata
+ * y la más cara, falla: mover tiene que ser O(1).
+ *
+ * Compilar: gcc -O2 -no-pie -Itools/simulador -Iinclude -ICMSISv2p00_LPC17xx/inc \
+ *               -ICMSISv2p00_LPC17xx/Drivers/inc -DCOLUMNAS_MUNDO_SERPIENTE=255 \
+ *               -DFILAS_MUNDO_SERPIENTE=255 -o rendimiento_serpiente tools/rendimiento_serpiente.c \
+ *               tools/simulador/perifericos_sim.c $(ls src/[a-z]*.c | grep -v -e main.c -e snake_game.c)
+ *           (el resto de src/ solo está para que enlace: el camino medido no lo llama)
+ * Uso:      ./rendimiento_serpiente   (devuelve 1 si el costo no queda plano)
+ *
+ * @date Noviembre 2025
+ */
+
+#include "../src/snake_game.c"
+#include <stdio.h>
+#include <time.h>
+
+#if COLUMNAS_MUNDO_SERPIENTE != 255 || FILAS_MUNDO_SERPIENTE != 255
+#error "Compilar con -DCOLUMNAS_MUNDO_SERPIENTE=255 -DFILAS_MUNDO_SERPIENTE=255"
+#endif
+
+#define COLUMNAS_CICLO  COLUMNAS_MUNDO_SERPIENTE
+#define FILAS_CICLO     (FILAS_MUNDO_SERPIENTE - 1)     // Par: el zigzag vuelve a la columna 0
+#define LARGO_CICLO     ((uint32_t)COLUMNAS_CICLO * FILAS_CICLO)
+#define PASOS_MEDIDOS   2000000
+#define INTENTOS        5
+#define FACTOR_MAXIMO   3.0
+
+static const uint16_t longitudes[] = {3, 30, 300, 3000, 10000, 30000, LARGO_CICLO - 1};
+#define CANTIDAD_LONGITUDES (sizeof(longitudes) / sizeof(longitudes[0]))
+
+static Posicion ciclo[LARGO_CICLO];             // Celda i del recorrido
+static uint8_t direccion_ciclo[LARGO_CICLO];    // De la celda i a la i + 1
+static uint32_t indice_ciclo = 0;               // Dónde está la cabeza en el recorrido
+
+/* === CICLO HAMILTONIANO === */
+
+static void armar_ciclo(void) {
+    uint32_t n = 0;
+    for (uint8_t x = 0; x < COLUMNAS_CICLO; x++) {
+        ciclo[n++] = (Posicion){x, 0};
+    }
+    for (uint8_t y = 1; y < FILAS_CICLO; y++) {
+        for (uint8_t i = 1; i < COLUMNAS_CICLO; i++) {
+            uint8_t x = (y & 1) ? (uint8_t)(COLUMNAS_CICLO - i) : i;
+            ciclo[n++] = (Posicion){x, y};
+        }
+    }
+    for (uint8_t y = FILAS_CICLO - 1; y >= 1; y--) {
+        ciclo[n++] = (Posicion){0, y};
+    }
+
+    for (uint32_t i = 0; i < LARGO_CICLO; i++) {
+        Posicion a = ciclo[i];
+        Posicion b = ciclo[(i + 1) % LARGO_CICLO];
+        direccion_ciclo[i] = (b.y < a.y) ? DIR_ARRIBA : (b.y > a.y) ? DIR_ABAJO :
+                             (b.x < a.x) ? DIR_IZQUIERDA : DIR_DERECHA;
+    }
+}
+
+/**
+ * @brief Deja una serpiente de la longitud dada sobre el ciclo, con la cabeza en la celda 'cabeza'
+ */
+static void armar_serpiente(uint16_t longitud, uint32_t cabeza) {
+    memset(ocupacion, 0, sizeof(ocupacion));
+    indice_cabeza = 0;
+    for (uint32_t i = longitud; i-- > 0;) {        // De la cola a la cabeza
+        Posicion p = ciclo[(cabeza + LARGO_CICLO - i) % LARGO_CICLO];
+        agregar_cabeza(p);
+        ocupar_celda(p);
+    }
+    snake_length = longitud;
+    comida.x = POSICION_INVALIDA;
+    comida.y = POSICION_INVALIDA;
+    vista_x = centrar_vista(ciclo[cabeza].x, COLUMNAS_LCD_SERPIENTE, COLUMNAS_MUNDO_SERPIENTE);
+    vista_y = centrar_vista(ciclo[cabeza].y, FILAS_VISTA_SERPIENTE, FILAS_MUNDO_SERPIENTE);
+    direccion_actual = direccion_siguiente = (Direccion)direccion_ciclo[cabeza];
+    game_over = 0;
+    indice_ciclo = cabeza;
+}
+
+/* === MEDICIÓN === */
+
+static uint64_t reloj_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+/**
+ * @brief Avanza la serpiente por el ciclo, como si el jugador la guiara
+ */
+static void avanzar(uint32_t pasos) {
+    for (uint32_t i = 0; i < pasos; i++) {
+        direccion_siguiente = (Direccion)direccion_ciclo[indice_ciclo];
+        mover_serpiente();
+        indice_ciclo = (indice_ciclo + 1 == LARGO_CICLO) ? 0 : indice_ciclo + 1;
+    }
+}
+
+/**
+ * @return 1 si el cuerpo, el mapa y la cabeza siguen de acuerdo
+ */
+static int cuerpo_consistente(void) {
+    uint32_t ocupadas = 0;
+    for (uint16_t y = 0; y < FILAS_MUNDO_SERPIENTE; y++) {
+        for (uint8_t w = 0; w < PALABRAS_FILA_SERPIENTE; w++) {
+            ocupadas += contar_bits(ocupacion[y][w]);
+        }
+    }
+    Posicion cabeza = segmento(0);
+    Posicion cola = segmento(snake_length - 1);
+    Posicion cola_esperada = ciclo[(indice_ciclo + LARGO_CICLO - (snake_length - 1)) % LARGO_CICLO];
+    return !game_over && ocupadas == snake_length &&
+           cabeza.x == ciclo[indice_ciclo].x && cabeza.y == ciclo[indice_ciclo].y &&
+           cola.x == cola_esperada.x && cola.y == cola_esperada.y;
+}
+
+int main(void) {
+    double costo[CANTIDAD_LONGITUDES];
+    double minimo = 0, maximo = 0;
+    int errores = 0;
+
+    armar_ciclo();
+    printf("Mundo %ux%u, ciclo de %u celdas, %u pasos por intento (mejor de %u)\n\n",
+           COLUMNAS_MUNDO_SERPIENTE, FILAS_MUNDO_SERPIENTE, LARGO_CICLO, PASOS_MEDIDOS, INTENTOS);
+    printf("%8s  %10s  %s\n", "Longitud", "ns/tick", "Cuerpo");
+
+    for (uint32_t l = 0; l < CANTIDAD_LONGITUDES; l++) {
+        armar_serpiente(longitudes[l], (uint32_t)longitudes[l] * 7919u % LARGO_CICLO);
+        avanzar(PASOS_MEDIDOS / 10);        // Calentar caché y predictor
+
+        uint64_t mejor = UINT64_MAX;
+        for (uint32_t intento = 0; intento < INTENTOS; intento++) {
+            uint64_t inicio = reloj_ns();
+            avanzar(PASOS_MEDIDOS);
+            uint64_t transcurrido = reloj_ns() - inicio;
+            if (transcurrido < mejor) mejor = transcurrido;
+        }
+        int ok = cuerpo_consistente();
+        if (!ok) errores++;
+
+        costo[l] = (double)mejor / PASOS_MEDIDOS;
+        if (l == 0 || costo[l] < minimo) minimo = costo[l];
+        if (l == 0 || costo[l] > maximo) maximo = costo[l];
+        printf("%8u  %10.2f  %s\n", longitudes[l], costo[l], ok ? "OK" : "FALLO");
+    }
+
+    double factor = maximo / minimo;
+    int plano = factor <= FACTOR_MAXIMO;
+    printf("\nMás caro / más barato: %.2fx (máximo %.1fx) %s\n", factor, FACTOR_MAXIMO, plano ? "OK" : "FALLO");
+    if (!plano) errores++;
+
+    printf("\n%s\n", errores ? "FALLO" : "OK: costo por tick independiente de la longitud");
+    return errores ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file LPC17xx.h
+ * @brief LPC17xx.h del simulador: los tipos de CMSIS con los periféricos en RAM.
+ *
+ * Toma los structs, los IRQn y los bits de CMSISv2p00_LPC17xx/inc/LPC17xx.h
+ * tal cual y después reapunta cada LPC_xxx a una variable de
+ * perifericos_sim.c, así src/ compila sin tocarse. Las funciones del núcleo
+ * que en la placa son instrucciones (NVIC, PRIMASK, reset) pasan al modelo
+ * de NVIC del simulador.
+ *
+ * Tiene que ir antes que CMSIS en el camino de includes (-Itools/simulador).
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef SIMULADOR_LPC17XX_H
+#define SIMULADOR_LPC17XX_H
+
+#include_next "LPC17xx.h"
+
+/* === PERIFÉRICOS (perifericos_sim.c) === */
+extern LPC_SC_TypeDef        sim_sc;
+extern LPC_GPIO_TypeDef      sim_gpio[5];
+extern LPC_TIM_TypeDef       sim_tim[4];
+extern LPC_I2C_TypeDef       sim_i2c[3];
+extern LPC_ADC_TypeDef       sim_adc;
+extern LPC_DAC_TypeDef       sim_dac;
+extern LPC_PINCON_TypeDef    sim_pincon;
+extern LPC_GPIOINT_TypeDef   sim_gpioint;
+extern LPC_GPDMA_TypeDef     sim_gpdma;
+extern LPC_GPDMACH_TypeDef   sim_gpdmach[8];
+extern CoreDebug_Type        sim_core_debug;
+extern volatile uint32_t     sim_dwt_ctrl;
+
+LPC_UART0_TypeDef *sim_uart0(void);
+uint32_t sim_dwt_ciclos(void);
+
+#undef LPC_SC
+#undef LPC_GPIO0
+#undef LPC_GPIO1
+#undef LPC_GPIO2
+#undef LPC_GPIO3
+#undef LPC_GPIO4
+#undef LPC_TIM0
+#undef LPC_TIM1
+#undef LPC_TIM2
+#undef LPC_TIM3
+#undef LPC_UART0
+#undef LPC_I2C0
+#undef LPC_I2C1
+#undef LPC_I2C2
+#undef LPC_ADC
+#undef LPC_DAC
+#undef LPC_PINCON
+#undef LPC_GPIOINT
+#undef LPC_GPDMA
+#undef LPC_GPDMACH0
+#undef LPC_GPDMACH1
+#undef LPC_GPDMACH2
+#undef LPC_GPDMACH3
+#undef LPC_GPDMACH4
+#undef LPC_GPDMACH5
+#undef LPC_GPDMACH6
+#undef LPC_GPDMACH7
+#undef CoreDebug
+
+#define LPC_SC          (&sim_sc)
+#define LPC_GPIO0       (&sim_gpio[0])
+#define LPC_GPIO1       (&sim_gpio[1])
+#define LPC_GPIO2       (&sim_gpio[2])
+#define LPC_GPIO3       (&sim_gpio[3])
+#define LPC_GPIO4       (&sim_gpio[4])
+#define LPC_TIM0        (&sim_tim[0])
+#define LPC_TIM1        (&sim_tim[1])
+#define LPC_TIM2        (&sim_tim[2])
+#define LPC_TIM3        (&sim_tim[3])
+#define LPC_UART0       (sim_uart0())   // Función: leer LSR/RBR avanza el FIFO de recepción
+#define LPC_I2C0        (&sim_i2c[0])
+#define LPC_I2C1        (&sim_i2c[1])
+#define LPC_I2C2        (&sim_i2c[2])
+#define LPC_ADC         (&sim_adc)
+#define LPC_DAC         (&sim_dac)
+#define LPC_PINCON      (&sim_pincon)
+#define LPC_GPIOINT     (&sim_gpioint)
+#define LPC_GPDMA       (&sim_gpdma)
+#define LPC_GPDMACH0    (&sim_gpdmach[0])
+#define LPC_GPDMACH1    (&sim_gpdmach[1])
+#define LPC_GPDMACH2    (&sim_gpdmach[2])
+#define LPC_GPDMACH3    (&sim_gpdmach[3])
+#define LPC_GPDMACH4    (&sim_gpdmach[4])
+#define LPC_GPDMACH5    (&sim_gpdmach[5])
+#define LPC_GPDMACH6    (&sim_gpdmach[6])
+#define LPC_GPDMACH7    (&sim_gpdmach[7])
+#define CoreDebug       (&sim_core_debug)
+
+/* === CONTADOR DE CICLOS (perfil_isr.h): tiempo del host a SystemCoreClock === */
+#define PERFIL_DWT_CTRL    (sim_dwt_ctrl)
+#define PERFIL_DWT_CYCCNT  (sim_dwt_ciclos())
+
+/* === NÚCLEO: NVIC y PRIMASK del modelo === */
+void sim_nvic_habilitar(IRQn_Type irq);
+void sim_nvic_deshabilitar(IRQn_Type irq);
+void sim_nvic_prioridad(IRQn_Type irq, uint32_t prioridad);
+void sim_reset(void);
+uint32_t sim_leer_primask(void);
+void sim_escribir_primask(uint32_t primask);
+
+#define NVIC_EnableIRQ(irq)               sim_nvic_habilitar(irq)
+#define NVIC_DisableIRQ(irq)              sim_nvic_deshabilitar(irq)
+#define NVIC_SetPriority(irq, prioridad)  sim_nvic_prioridad((irq), (prioridad))
+#define NVIC_SystemReset()                sim_reset()
+#define __get_PRIMASK()                   sim_leer_primask()
+#define __set_PRIMASK(primask)            sim_escribir_primask(primask)
+#define __disable_irq()                   sim_escribir_primask(1)
+#define __enable_irq()                    sim_escribir_primask(0)
+
+#endif // SIMULADOR_LPC17XX_H
@@ -0,0 +1,9 @@
+/**
+ * @file lpc17xx.h
+ * @brief Los drivers de CMSIS incluyen "lpc17xx.h" en minúsculas: en Linux
+ * el nombre distingue mayúsculas, así que se redirige al LPC17xx.h del simulador.
+ *
+ * @date Noviembre 2025
+ */
+
+#include "LPC17xx.h"
@@ -0,0 +1,46 @@
+/**
+ * @file lpc17xx_i2c.h
+ * @brief Declaraciones del driver I2C que usa src/ (lo implementa perifericos_sim.c).
+ *
+ * El lpc17xx_i2c.h de CMSISv2p00_LPC17xx/Drivers/inc tiene un comentario
+ * cortado a la mitad de I2C_OWNSLAVEADDR_CFG_Type y no compila con gcc;
+ * acá están solo los tipos y funciones del maestro que aparecen en src/,
+ * con los mismos nombres y valores que el header del repo.
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef LPC17XX_I2C_H_
+#define LPC17XX_I2C_H_
+
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#define I2C_I2CONSET_I2EN   ((0x40))    // Habilita la interfaz I2C
+
+typedef struct {
+    uint32_t sl_addr7bit;
+    uint8_t *tx_data;
+    uint32_t tx_length;
+    uint32_t tx_count;
+    uint8_t *rx_data;
+    uint32_t rx_length;
+    uint32_t rx_count;
+    uint32_t retransmissions_max;
+    uint32_t retransmissions_count;
+    uint32_t status;
+    void (*callback)(void);
+} I2C_M_SETUP_Type;
+
+typedef enum {
+    I2C_TRANSFER_POLLING = 0,
+    I2C_TRANSFER_INTERRUPT
+} I2C_TRANSFER_OPT_Type;
+
+void I2C_Init(LPC_I2C_TypeDef *I2Cx, uint32_t clockrate);
+void I2C_Cmd(LPC_I2C_TypeDef *I2Cx, FunctionalState NewState);
+Status I2C_MasterTransferData(LPC_I2C_TypeDef *I2Cx, I2C_M_SETUP_Type *TransferCfg, I2C_TRANSFER_OPT_Type Opt);
+uint32_t I2C_MasterTransferComplete(LPC_I2C_TypeDef *I2Cx);
+void I2C_MasterHandler(LPC_I2C_TypeDef *I2Cx);
+
+#endif // LPC17XX_I2C_H_
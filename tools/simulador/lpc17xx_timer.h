@@ -0,0 +1,68 @@
+/**
+ * @file lpc17xx_timer.h
+ * @brief Declaraciones del driver TIMER que usa src/ (lo implementa perifericos_sim.c).
+ *
+ * El lpc17xx_timer.h de CMSISv2p00_LPC17xx/Drivers/inc mezcla dos versiones
+ * del header (las dos guardas, los dos juegos de enums y structs) y no
+ * compila con gcc; como el simulador no usa el driver real sino el modelo
+ * de perifericos_sim.c, acá están solo los tipos y funciones que aparecen
+ * en src/, con los mismos nombres y valores que el header del repo.
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef LPC17XX_TIMER_H_
+#define LPC17XX_TIMER_H_
+
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+typedef enum {
+    TIM_MR0_INT = 0,
+    TIM_MR1_INT,
+    TIM_MR2_INT,
+    TIM_MR3_INT,
+    TIM_CR0_INT,
+    TIM_CR1_INT
+} TIM_INT_TYPE;
+
+typedef enum {
+    TIM_TIMER_MODE = 0,
+    TIM_COUNTER_RISING_MODE,
+    TIM_COUNTER_FALLING_MODE,
+    TIM_COUNTER_ANY_MODE
+} TIM_MODE_OPT;
+
+typedef enum {
+    TIM_TICKVAL = 0,
+    TIM_USVAL
+} TIM_PRESCALE_OPT;
+
+typedef enum {
+    TIM_NOTHING = 0,
+    TIM_LOW,
+    TIM_HIGH,
+    TIM_TOGGLE
+} TIM_EXTMATCH_OPT;
+
+typedef struct {
+    TIM_PRESCALE_OPT prescaleOption;
+    uint32_t prescaleValue;
+} TIM_TIMERCFG_Type;
+
+typedef struct {
+    uint8_t matchChannel;
+    FunctionalState intOnMatch;
+    FunctionalState stopOnMatch;
+    FunctionalState resetOnMatch;
+    TIM_EXTMATCH_OPT extMatchOutputType;
+    uint32_t matchValue;
+} TIM_MATCHCFG_Type;
+
+void TIM_Init(LPC_TIM_TypeDef *TIMx, TIM_MODE_OPT timerCounterMode, void *TIM_ConfigStruct);
+void TIM_ConfigMatch(LPC_TIM_TypeDef *TIMx, TIM_MATCHCFG_Type *TIM_MatchConfigStruct);
+void TIM_Cmd(LPC_TIM_TypeDef *TIMx, FunctionalState NewState);
+FlagStatus TIM_GetIntStatus(LPC_TIM_TypeDef *TIMx, TIM_INT_TYPE IntFlag);
+void TIM_ClearIntPending(LPC_TIM_TypeDef *TIMx, TIM_INT_TYPE IntFlag);
+
+#endif // LPC17XX_TIMER_H_
@@ -0,0 +1,874 @@
+/**
+ * @file perifericos_sim.c
+ * @brief Periféricos del LPC1769 en RAM, NVIC y reloj virtual (simulador).
+ *
+ * Los registros son structs con el layout de CMSIS; lo que en la placa es
+ * hardware se modela solo hasta donde lo usa src/:
+ * - NVIC: habilitación, pendientes, prioridad y PRIMASK. Una IRQ pendiente
+ *   entra apenas su prioridad supera a la que corre (o al reabrir PRIMASK).
+ * - SysTick y TIMER0-3: match 0 con reset, prescaler en µs o en ticks.
+ *   TC se actualiza con el reloj virtual (melodias_dac.c lo lee).
+ * - ADC: ADDR0/ADDR1 siempre con DONE y el valor de sim_joystick().
+ * - DAC + GPDMA: cada vencimiento de DACCNTVAL pide una transferencia al
+ *   canal habilitado con destino DAC. Se recorre la cadena de LLI igual
+ *   que el controlador (SrcAddr, LLI y TransferSize quedan en el canal),
+ *   con escrituras de byte, media palabra o palabra sobre DACR.
+ * - UART0: RX con FIFO de 16 bytes, nivel de disparo de FCR y timeout de
+ *   caracter (CTI); TX por pedidos al GPDMA, un byte por tiempo de
+ *   caracter a BT_VELOCIDAD_UART0.
+ * - I2C: se reemplaza la API del driver, no los registros.
+ *   I2C_MasterTransferData() entrega la transacción al sumidero y la da por
+ *   terminada en el acto (levanta la IRQ); el tiempo de bus se cuenta
+ *   aparte. lcd_i2c.c espera a la ISR en lazos vacíos, así que el bus no
+ *   puede quedar "en vuelo" sin que corra el reloj. Con
+ *   sim_i2c_asincrono() la transacción termina recién después de su
+ *   tiempo de bus, para quien hace correr el reloj desde afuera del
+ *   firmware (una señal, como en tools/prueba_lcd_i2c.c).
+ *
+ * Los drivers de CMSIS que usa el firmware se reemplazan acá por versiones
+ * que actúan sobre estos registros.
+ *
+ * @date Noviembre 2025
+ */
+
+#include <LPC17xx.h>
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_dac.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_gpio.h"
+#include "lpc17xx_i2c.h"
+#include "lpc17xx_pinsel.h"
+#include "lpc17xx_systick.h"
+#include "lpc17xx_timer.h"
+#include "lpc17xx_uart.h"
+#include "bluetooth_uart.h"     // BT_VELOCIDAD_UART0
+#include "perifericos_sim.h"
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Registros de solo lectura (__I) que escribe el modelo */
+#define ESCRIBIR_8(reg, valor)   (*(volatile uint8_t *)&(reg) = (uint8_t)(valor))
+#define ESCRIBIR_32(reg, valor)  (*(volatile uint32_t *)&(reg) = (uint32_t)(valor))
+
+#define NS_POR_S                1000000000ULL
+#define NUNCA                   UINT64_MAX
+#define VECTORES                (16 + 35)               // Excepciones del núcleo + IRQ del LPC1769
+#define VECTOR(irq)             ((irq) + 16)
+#define SIN_ISR                 0x100                   // Prioridad del hilo (main)
+
+#define ADC_DONE                (1UL << 31)
+#define DMA_CONFIG_E            (1UL << 0)
+#define DMA_CONFIG_DEST(c)      (((c) >> 6) & 0x1F)
+#define DMA_CONFIG_IE           (1UL << 14)
+#define DMA_CONFIG_ITC          (1UL << 15)
+#define DMA_CONTROL_DI          (1UL << 27)
+#define FIFO_UART               16
+#define CARACTERES_CTI          4                       // Timeout de caracter: entre 3.5 y 4.5
+#define BITS_UART               10                      // 8N1
+#define ENTRADA_UART            4096                    // Bytes que esperan llegar por RX
+
+/* === REGISTROS === */
+LPC_SC_TypeDef        sim_sc;
+LPC_GPIO_TypeDef      sim_gpio[5];
+LPC_TIM_TypeDef       sim_tim[4];
+LPC_I2C_TypeDef       sim_i2c[3];
+LPC_ADC_TypeDef       sim_adc;
+LPC_DAC_TypeDef       sim_dac;
+LPC_PINCON_TypeDef    sim_pincon;
+LPC_GPIOINT_TypeDef   sim_gpioint;
+LPC_GPDMA_TypeDef     sim_gpdma;
+LPC_GPDMACH_TypeDef   sim_gpdmach[8];
+CoreDebug_Type        sim_core_debug;
+volatile uint32_t     sim_dwt_ctrl;
+uint32_t SystemCoreClock = 100000000;   // 100 MHz, como deja SystemInit() en la placa
+
+static LPC_UART0_TypeDef uart0;
+
+/* === HANDLERS DEL FIRMWARE (débiles: los que no existen quedan en NULL) === */
+extern void SysTick_Handler(void) __attribute__((weak));
+extern void TIMER0_IRQHandler(void) __attribute__((weak));
+extern void TIMER1_IRQHandler(void) __attribute__((weak));
+extern void TIMER2_IRQHandler(void) __attribute__((weak));
+extern void TIMER3_IRQHandler(void) __attribute__((weak));
+extern void UART0_IRQHandler(void) __attribute__((weak));
+extern void I2C0_IRQHandler(void) __attribute__((weak));
+extern void I2C1_IRQHandler(void) __attribute__((weak));
+extern void I2C2_IRQHandler(void) __attribute__((weak));
+extern void EINT3_IRQHandler(void) __attribute__((weak));
+extern void GPDMA_IRQHandler(void) __attribute__((weak));
+
+/* === ESTADO DEL MODELO === */
+static uint64_t ahora_ns = 0;
+
+static uint8_t nvic_habilitada[VECTORES];
+static uint8_t nvic_pendiente[VECTORES];
+static uint8_t nvic_prioridad[VECTORES];
+static uint32_t primask = 0;
+static uint32_t prioridad_en_curso = SIN_ISR;
+static int vector_en_curso = -1;
+
+static uint64_t systick_periodo_ns = 0;
+static uint64_t systick_proximo_ns = NUNCA;
+
+typedef struct {
+    uint64_t tick_ns;           // Un conteo de TC
+    uint32_t match0;
+    uint8_t interrumpe;
+    uint8_t reinicia;
+    uint64_t inicio_ns;         // Último reset de TC
+    uint64_t proximo_ns;        // Próximo match 0 (NUNCA si parado)
+} Temporizador;
+static Temporizador temporizadores[4] = {
+    { .proximo_ns = NUNCA }, { .proximo_ns = NUNCA }, { .proximo_ns = NUNCA }, { .proximo_ns = NUNCA }
+};
+
+static uint64_t dac_proximo_ns = NUNCA;
+
+static uint8_t rx_fifo[FIFO_UART];
+static uint8_t rx_cantidad = 0;
+static uint8_t rx_presentado = 0;           // RBR tiene rx_fifo[0] a la vista
+static uint32_t rx_accesos = 0;             // Accesos a LPC_UART0 dentro de la ISR
+static uint64_t rx_ultimo_ns = 0;           // Llegada del último byte al FIFO
+static uint8_t rx_cti_avisado = 0;
+static uint8_t rx_overrun = 0;              // OE hasta la próxima lectura de LSR
+static uint8_t entrada[ENTRADA_UART];
+static uint32_t entrada_primero = 0, entrada_cantidad = 0;
+static uint64_t entrada_proximo_ns = NUNCA;
+static uint64_t tx_proximo_ns = NUNCA;
+
+static uint32_t i2c_reloj_hz[3] = {100000, 100000, 100000};
+static uint8_t i2c_completa[3];
+static uint8_t i2c_asincrono = 0;
+static I2C_M_SETUP_Type *i2c_en_vuelo[3];  // Modo asíncrono: transacción hasta i2c_fin_ns
+static uint64_t i2c_fin_ns[3] = {NUNCA, NUNCA, NUNCA};
+
+// > 0 mientras se modifica el estado del modelo: quien avanza el reloj
+// desde un manejador de señal no puede entrar (ver sim_ocupado())
+static volatile sig_atomic_t dentro_del_modelo = 0;
+
+static SimSumideroI2c sumidero_i2c = NULL;
+static SimSumideroUart sumidero_uart = NULL;
+static SimSumideroDac sumidero_dac = NULL;
+static SimEstadisticas estadisticas;
+
+/* ==================== NVIC ================================================ */
+
+static void entrar_modelo(void) {
+    dentro_del_modelo++;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+static void salir_modelo(void) {
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    dentro_del_modelo--;
+}
+
+static void (*manejador(int vector))(void) {
+    switch (vector - 16) {
+        case SysTick_IRQn:  return SysTick_Handler;
+        case TIMER0_IRQn:   return TIMER0_IRQHandler;
+        case TIMER1_IRQn:   return TIMER1_IRQHandler;
+        case TIMER2_IRQn:   return TIMER2_IRQHandler;
+        case TIMER3_IRQn:   return TIMER3_IRQHandler;
+        case UART0_IRQn:    return UART0_IRQHandler;
+        case I2C0_IRQn:     return I2C0_IRQHandler;
+        case I2C1_IRQn:     return I2C1_IRQHandler;
+        case I2C2_IRQn:     return I2C2_IRQHandler;
+        case EINT3_IRQn:    return EINT3_IRQHandler;
+        case DMA_IRQn:      return GPDMA_IRQHandler;
+        default:            return NULL;
+    }
+}
+
+static void contar_entrada(int vector) {
+    switch (vector - 16) {
+        case SysTick_IRQn:  estadisticas.isr_systick++; break;
+        case TIMER1_IRQn:   estadisticas.isr_timer1++; break;
+        case UART0_IRQn:    estadisticas.isr_uart0++; break;
+        case I2C0_IRQn:     estadisticas.isr_i2c0++; break;
+        case DMA_IRQn:      estadisticas.isr_gpdma++; break;
+        default:            break;
+    }
+}
+
+static void terminar_lectura_uart(void);
+
+/**
+ * @brief Entra a todas las IRQ pendientes que puedan desalojar a lo que corre
+ *
+ * Entre iguales gana el número de IRQ más bajo, como en el NVIC. Una IRQ
+ * que se pide desde su propia ISR queda pendiente y entra al terminar
+ * (tail-chaining), sin recursión.
+ */
+static void despachar(void) {
+    entrar_modelo();
+    while (!primask) {
+        int elegido = -1;
+        for (int v = 0; v < VECTORES; v++) {
+            if (!nvic_pendiente[v] || !nvic_habilitada[v]) continue;
+            if (nvic_prioridad[v] >= prioridad_en_curso) continue;
+            if (elegido < 0 || nvic_prioridad[v] < nvic_prioridad[elegido]) elegido = v;
+        }
+        if (elegido < 0) break;
+
+        nvic_pendiente[elegido] = 0;
+        void (*isr)(void) = manejador(elegido);
+        if (isr == NULL) continue;
+
+        uint32_t prioridad_previa = prioridad_en_curso;
+        int vector_previo = vector_en_curso;
+        prioridad_en_curso = nvic_prioridad[elegido];
+        vector_en_curso = elegido;
+        if (elegido == VECTOR(UART0_IRQn)) rx_accesos = 0;
+        contar_entrada(elegido);
+
+        isr();
+
+        if (elegido == VECTOR(UART0_IRQn)) terminar_lectura_uart();
+        prioridad_en_curso = prioridad_previa;
+        vector_en_curso = vector_previo;
+    }
+    salir_modelo();
+}
+
+static void pedir_irq(IRQn_Type irq) {
+    nvic_pendiente[VECTOR(irq)] = 1;
+    despachar();
+}
+
+void sim_nvic_habilitar(IRQn_Type irq) {
+    nvic_habilitada[VECTOR(irq)] = 1;
+    despachar();
+}
+
+void sim_nvic_deshabilitar(IRQn_Type irq) {
+    nvic_habilitada[VECTOR(irq)] = 0;
+}
+
+void sim_nvic_prioridad(IRQn_Type irq, uint32_t prioridad) {
+    nvic_prioridad[VECTOR(irq)] = (uint8_t)(prioridad & 0x1F);  // 5 bits en el LPC17xx
+}
+
+uint32_t sim_leer_primask(void) {
+    return primask;
+}
+
+void sim_escribir_primask(uint32_t valor) {
+    primask = valor & 1;
+    despachar();
+}
+
+void sim_reset(void) {
+    fprintf(stderr, "simulador: NVIC_SystemReset() a los %.3f ms\n", ahora_ns / 1e6);
+    exit(2);
+}
+
+uint32_t sim_dwt_ciclos(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    uint64_t ns = (uint64_t)t.tv_sec * NS_POR_S + (uint64_t)t.tv_nsec;
+    return (uint32_t)(ns * (SystemCoreClock / 1000000) / 1000);
+}
+
+void SystemInit(void) {
+}
+
+/* ==================== RELOJES Y PCLK ====================================== */
+
+uint32_t CLKPWR_GetPCLK(uint32_t tipo) {
+    static const uint8_t divisores[4] = {4, 1, 2, 8};
+    uint32_t sel = (tipo < 32) ? (sim_sc.PCLKSEL0 >> tipo) : (sim_sc.PCLKSEL1 >> (tipo - 32));
+    return SystemCoreClock / divisores[sel & 3];
+}
+
+static uint64_t caracter_uart_ns(void) {
+    return (uint64_t)BITS_UART * NS_POR_S / BT_VELOCIDAD_UART0;
+}
+
+/* ==================== SYSTICK ============================================= */
+
+void SYSTICK_InternalInit(uint32_t ms) {
+    systick_periodo_ns = (uint64_t)ms * 1000000ULL;
+}
+
+void SYSTICK_Cmd(FunctionalState estado) {
+    systick_proximo_ns = (estado == ENABLE && systick_periodo_ns) ? ahora_ns + systick_periodo_ns : NUNCA;
+}
+
+void SYSTICK_IntCmd(FunctionalState estado) {
+    nvic_habilitada[VECTOR(SysTick_IRQn)] = (estado == ENABLE);
+}
+
+/* ==================== TIMER0-3 ============================================ */
+
+static uint8_t indice_timer(LPC_TIM_TypeDef *tim) {
+    return (uint8_t)(tim - sim_tim);
+}
+
+void TIM_Init(LPC_TIM_TypeDef *tim, TIM_MODE_OPT modo, void *configuracion) {
+    Temporizador *t = &temporizadores[indice_timer(tim)];
+    const TIM_TIMERCFG_Type *cfg = configuracion;
+    (void)modo;     // Solo modo timer
+    if (cfg->prescaleOption == TIM_USVAL) {
+        t->tick_ns = (uint64_t)cfg->prescaleValue * 1000;
+    } else {
+        t->tick_ns = (uint64_t)cfg->prescaleValue * NS_POR_S / CLKPWR_GetPCLK(CLKPWR_PCLKSEL_TIMER0);
+    }
+    if (t->tick_ns == 0) t->tick_ns = 1;
+    t->proximo_ns = NUNCA;
+    tim->TC = 0;
+    tim->IR = 0;
+}
+
+void TIM_ConfigMatch(LPC_TIM_TypeDef *tim, TIM_MATCHCFG_Type *cfg) {
+    Temporizador *t = &temporizadores[indice_timer(tim)];
+    if (cfg->matchChannel != 0) return;   // El firmware usa solo MR0
+    t->match0 = cfg->matchValue;
+    t->interrumpe = (cfg->intOnMatch == ENABLE);
+    t->reinicia = (cfg->resetOnMatch == ENABLE);
+    tim->MR0 = cfg->matchValue;
+}
+
+void TIM_Cmd(LPC_TIM_TypeDef *tim, FunctionalState estado) {
+    Temporizador *t = &temporizadores[indice_timer(tim)];
+    if (estado == ENABLE && t->match0) {
+        t->inicio_ns = ahora_ns;
+        t->proximo_ns = ahora_ns + t->match0 * t->tick_ns;
+        tim->TCR = 1;
+    } else {
+        t->proximo_ns = NUNCA;
+        tim->TCR = 0;
+    }
+}
+
+FlagStatus TIM_GetIntStatus(LPC_TIM_TypeDef *tim, TIM_INT_TYPE bandera) {
+    return (tim->IR & (1UL << bandera)) ? SET : RESET;
+}
+
+void TIM_ClearIntPending(LPC_TIM_TypeDef *tim, TIM_INT_TYPE bandera) {
+    tim->IR &= ~(1UL << bandera);
+}
+
+static void actualizar_tc(void) {
+    for (uint8_t i = 0; i < 4; i++) {
+        Temporizador *t = &temporizadores[i];
+        if (t->proximo_ns != NUNCA) {
+            sim_tim[i].TC = (uint32_t)((ahora_ns - t->inicio_ns) / t->tick_ns);
+        }
+    }
+}
+
+static void vencer_timer(uint8_t i) {
+    Temporizador *t = &temporizadores[i];
+    t->inicio_ns = t->proximo_ns;
+    t->proximo_ns = t->reinicia ? t->proximo_ns + t->match0 * t->tick_ns : NUNCA;
+    sim_tim[i].IR |= 1UL << TIM_MR0_INT;
+    actualizar_tc();
+    if (t->interrumpe) pedir_irq((IRQn_Type)(TIMER0_IRQn + i));
+}
+
+/* ==================== GPIO, PINSEL Y ADC ================================== */
+
+void GPIO_SetDir(GPIO_PORT puerto, uint32_t pines, GPIO_DIR direccion) {
+    if (direccion) sim_gpio[puerto].FIODIR |= pines;
+    else sim_gpio[puerto].FIODIR &= ~pines;
+}
+
+void GPIO_SetPins(GPIO_PORT puerto, uint32_t pines) {
+    sim_gpio[puerto].FIOPIN |= pines & sim_gpio[puerto].FIODIR;
+}
+
+void GPIO_ClearPins(GPIO_PORT puerto, uint32_t pines) {
+    sim_gpio[puerto].FIOPIN &= ~(pines & sim_gpio[puerto].FIODIR);
+}
+
+void PINSEL_ConfigPin(const PINSEL_CFG_Type *cfg) {
+    volatile uint32_t *pinsel = &sim_pincon.PINSEL0 + cfg->portNum * 2 + cfg->pinNum / 16;
+    uint32_t desplazamiento = (cfg->pinNum % 16) * 2;
+    *pinsel = (*pinsel & ~(3UL << desplazamiento)) | ((uint32_t)cfg->funcNum << desplazamiento);
+}
+
+void sim_joystick(uint16_t x, uint16_t y) {
+    ESCRIBIR_32(sim_adc.ADDR0, ADC_DONE | ((uint32_t)(x & 0xFFF) << 4));
+    ESCRIBIR_32(sim_adc.ADDR1, ADC_DONE | ((uint32_t)(y & 0xFFF) << 4));
+}
+
+void sim_boton(uint8_t presionado) {
+    if (presionado) sim_gpio[0].FIOPIN &= ~(1UL << 4);
+    else sim_gpio[0].FIOPIN |= 1UL << 4;
+}
+
+/* ==================== DAC ================================================= */
+
+void DAC_Init(void) {
+    sim_dac.DACR = 0;
+}
+
+void DAC_UpdateValue(uint32_t valor) {
+    sim_dac.DACR = (sim_dac.DACR & ~(0x3FFUL << 6)) | ((valor & 0x3FF) << 6);
+}
+
+void DAC_SetBias(DAC_MAX_CURRENT corriente) {
+    sim_dac.DACR = (sim_dac.DACR & ~(1UL << 16)) | ((uint32_t)corriente << 16);
+}
+
+void DAC_SetDMATimeOut(uint32_t cuentas) {
+    sim_dac.DACCNTVAL = cuentas & 0xFFFF;
+}
+
+void DAC_ConfigDAConverterControl(const DAC_CONVERTER_CFG_Type *cfg) {
+    sim_dac.DACCTRL = ((uint32_t)cfg->doubleBufferEnable << 1) |
+                      ((uint32_t)cfg->counterEnable << 2) |
+                      ((uint32_t)cfg->dmaEnable << 3);
+    if ((sim_dac.DACCTRL & DAC_CNT_ENA) && sim_dac.DACCNTVAL) {
+        dac_proximo_ns = ahora_ns;
+    }
+}
+
+static uint64_t periodo_dac_ns(void) {
+    return (uint64_t)sim_dac.DACCNTVAL * NS_POR_S / CLKPWR_GetPCLK(CLKPWR_PCLKSEL_DAC);
+}
+
+/* ==================== GPDMA =============================================== */
+
+static uint32_t tc_pendiente = 0;       // DMACIntTCStat
+static uint32_t error_pendiente = 0;    // DMACIntErrStat
+
+static void actualizar_estado_dma(void) {
+    ESCRIBIR_32(sim_gpdma.DMACIntTCStat, tc_pendiente);
+    ESCRIBIR_32(sim_gpdma.DMACIntErrStat, error_pendiente);
+    ESCRIBIR_32(sim_gpdma.DMACIntStat, tc_pendiente | error_pendiente);
+    uint32_t habilitados = 0;
+    for (uint8_t n = 0; n < 8; n++) {
+        if (sim_gpdmach[n].DMACCConfig & DMA_CONFIG_E) habilitados |= 1UL << n;
+    }
+    ESCRIBIR_32(sim_gpdma.DMACEnbldChns, habilitados);
+}
+
+static uint32_t direccion_periferico(GPDMA_CONNECTION conexion) {
+    switch (conexion) {
+        case GPDMA_DAC:      return (uint32_t)(uintptr_t)&sim_dac.DACR;
+        case GPDMA_UART0_Tx: return (uint32_t)(uintptr_t)&uart0.THR;
+        default:             return 0;
+    }
+}
+
+void GPDMA_Init(void) {
+    sim_sc.PCONP |= CLKPWR_PCONP_PCGPDMA;
+    memset(sim_gpdmach, 0, sizeof(sim_gpdmach));
+    tc_pendiente = 0;
+    error_pendiente = 0;
+    sim_gpdma.DMACConfig = 1;
+    actualizar_estado_dma();
+}
+
+/**
+ * @brief Igual que el driver: en M2P el destino y el ancho salen de la
+ * tabla de periféricos (byte para el DAC y para UART0)
+ */
+Status GPDMA_Setup(const GPDMA_Channel_CFG_Type *cfg) {
+    LPC_GPDMACH_TypeDef *canal = &sim_gpdmach[cfg->channelNum];
+    if (canal->DMACCConfig & DMA_CONFIG_E) return ERROR;
+
+    tc_pendiente &= ~(1UL << cfg->channelNum);
+    error_pendiente &= ~(1UL << cfg->channelNum);
+    canal->DMACCLLI = cfg->linkedList;
+
+    uint32_t control = GPDMA_DMACCxControl_TransferSize(cfg->transferSize) | GPDMA_DMACCxControl_I;
+    uint32_t config = DMA_CONFIG_IE | DMA_CONFIG_ITC | ((uint32_t)cfg->transferType << 11);
+    if (cfg->transferType == GPDMA_M2P) {
+        canal->DMACCSrcAddr = cfg->srcMemAddr;
+        canal->DMACCDestAddr = direccion_periferico(cfg->dstConn);
+        control |= GPDMA_DMACCxControl_SWidth(GPDMA_BYTE) | GPDMA_DMACCxControl_DWidth(GPDMA_BYTE) |
+                   GPDMA_DMACCxControl_SI;
+        config |= (uint32_t)cfg->dstConn << 6;
+    } else if (cfg->transferType == GPDMA_M2M) {
+        canal->DMACCSrcAddr = cfg->srcMemAddr;
+        canal->DMACCDestAddr = cfg->dstMemAddr;
+        control |= GPDMA_DMACCxControl_SWidth(cfg->transferWidth) |
+                   GPDMA_DMACCxControl_DWidth(cfg->transferWidth) |
+                   GPDMA_DMACCxControl_SI | DMA_CONTROL_DI;
+    } else {
+        return ERROR;   // P2M/P2P: el firmware no los usa
+    }
+    canal->DMACCControl = control;
+    canal->DMACCConfig = config;
+    actualizar_estado_dma();
+    return SUCCESS;
+}
+
+void GPDMA_ChannelCmd(GPDMA_CHANNEL numero, FunctionalState estado) {
+    LPC_GPDMACH_TypeDef *canal = &sim_gpdmach[numero];
+    if (estado == ENABLE) {
+        canal->DMACCConfig |= DMA_CONFIG_E;
+        if (DMA_CONFIG_DEST(canal->DMACCConfig) == GPDMA_UART0_Tx && tx_proximo_ns == NUNCA) {
+            tx_proximo_ns = ahora_ns + caracter_uart_ns();
+        }
+    } else {
+        canal->DMACCConfig &= ~DMA_CONFIG_E;
+    }
+    actualizar_estado_dma();
+}
+
+IntStatus GPDMA_IntGetStatus(GPDMA_STATUS_TYPE tipo, GPDMA_CHANNEL numero) {
+    uint32_t bits;
+    switch (tipo) {
+        case GPDMA_INT:          bits = tc_pendiente | error_pendiente; break;
+        case GPDMA_INTTC:
+        case GPDMA_RAW_INTTC:    bits = tc_pendiente; break;
+        case GPDMA_INTERR:
+        case GPDMA_RAW_INTERR:   bits = error_pendiente; break;
+        default:                 bits = sim_gpdma.DMACEnbldChns; break;
+    }
+    return (bits & (1UL << numero)) ? SET : RESET;
+}
+
+void GPDMA_ClearIntPending(GPDMA_CLEAR_INT tipo, GPDMA_CHANNEL numero) {
+    if (tipo == GPDMA_CLR_INTTC) tc_pendiente &= ~(1UL << numero);
+    else error_pendiente &= ~(1UL << numero);
+    actualizar_estado_dma();
+}
+
+/**
+ * @brief Primer canal habilitado que atiende pedidos de ese periférico
+ * (el de número más bajo tiene prioridad, como en el controlador)
+ */
+static int canal_para(GPDMA_CONNECTION conexion) {
+    for (uint8_t n = 0; n < 8; n++) {
+        uint32_t config = sim_gpdmach[n].DMACCConfig;
+        if ((config & DMA_CONFIG_E) && DMA_CONFIG_DEST(config) == conexion) return n;
+    }
+    return -1;
+}
+
+static void escribir_destino(uint32_t direccion, uint32_t dato, uint32_t ancho) {
+    uintptr_t dac = (uintptr_t)&sim_dac.DACR;
+    uintptr_t thr = (uintptr_t)&uart0.THR;
+    if (direccion == thr) {
+        estadisticas.bytes_tx++;
+        if (sumidero_uart) sumidero_uart((uint8_t)dato);
+    } else if (direccion >= dac && direccion + ancho <= dac + sizeof(sim_dac.DACR)) {
+        memcpy((uint8_t *)&sim_dac.DACR + (direccion - dac), &dato, ancho);     // Carril de byte o media palabra
+    } else {
+        memcpy((void *)(uintptr_t)direccion, &dato, ancho);
+    }
+}
+
+/**
+ * @brief Terminó el tramo del canal: bandera TC y carga del LLI siguiente
+ */
+static void terminar_tramo(uint8_t numero, uint32_t control) {
+    LPC_GPDMACH_TypeDef *canal = &sim_gpdmach[numero];
+    uint32_t siguiente = canal->DMACCLLI & ~0x3UL;
+    if (siguiente) {
+        const GPDMA_LLI_Type *lli = (const GPDMA_LLI_Type *)(uintptr_t)siguiente;
+        canal->DMACCSrcAddr = lli->srcAddr;
+        canal->DMACCDestAddr = lli->dstAddr;
+        canal->DMACCLLI = lli->nextLLI;
+        canal->DMACCControl = lli->control;
+    } else {
+        canal->DMACCConfig &= ~DMA_CONFIG_E;
+    }
+    if ((control & GPDMA_DMACCxControl_I) && (canal->DMACCConfig & DMA_CONFIG_ITC)) {
+        tc_pendiente |= 1UL << numero;
+    }
+    actualizar_estado_dma();
+    if (tc_pendiente & (1UL << numero)) pedir_irq(DMA_IRQn);
+}
+
+/**
+ * @brief Un pedido del periférico: una transferencia de un elemento
+ */
+static void transferir_elemento(uint8_t numero) {
+    LPC_GPDMACH_TypeDef *canal = &sim_gpdmach[numero];
+    uint32_t control = canal->DMACCControl;
+    uint32_t restantes = control & 0xFFF;
+    uint32_t ancho_fuente = 1UL << ((control >> 18) & 0x7);
+    uint32_t ancho_destino = 1UL << ((control >> 21) & 0x7);
+    uint32_t dato = 0;
+
+    if (restantes == 0) {
+        terminar_tramo(numero, control);
+        return;
+    }
+    memcpy(&dato, (const void *)(uintptr_t)canal->DMACCSrcAddr, ancho_fuente);
+    escribir_destino(canal->DMACCDestAddr, dato, ancho_destino);
+    if (control & GPDMA_DMACCxControl_SI) canal->DMACCSrcAddr += ancho_fuente;
+    if (control & DMA_CONTROL_DI) canal->DMACCDestAddr += ancho_destino;
+
+    canal->DMACCControl = (control & ~0xFFFUL) | (restantes - 1);
+    if (restantes == 1) {
+        terminar_tramo(numero, control);
+    }
+}
+
+/**
+ * @brief Vencimiento de DACCNTVAL: sale la muestra cargada y se pide la siguiente
+ */
+static void vencer_dac(void) {
+    dac_proximo_ns += periodo_dac_ns();
+    if (!(sim_dac.DACCTRL & DAC_CNT_ENA)) {
+        dac_proximo_ns = NUNCA;
+        return;
+    }
+    estadisticas.muestras_dac++;
+    if (sumidero_dac) sumidero_dac((uint16_t)((sim_dac.DACR >> 6) & 0x3FF));
+    if (sim_dac.DACCTRL & DAC_DMA_ENA) {
+        int numero = canal_para(GPDMA_DAC);
+        if (numero >= 0) transferir_elemento((uint8_t)numero);
+    }
+}
+
+/* ==================== UART0 =============================================== */
+
+/**
+ * @brief LPC_UART0 del firmware
+ *
+ * En la placa leer RBR saca un byte del FIFO; con registros en RAM eso no
+ * se ve, así que la lectura se sigue por la secuencia de UART0_IRQHandler:
+ * dentro de la ISR los accesos alternan LSR y RBR. En cada lectura de LSR
+ * sale el byte que se leyó antes por RBR y se presenta el siguiente.
+ */
+LPC_UART0_TypeDef *sim_uart0(void) {
+    if (vector_en_curso == VECTOR(UART0_IRQn) && (rx_accesos++ & 1) == 0) {
+        uint8_t lsr = UART_LSR_THRE | UART_LSR_TEMT;
+        if (rx_presentado) {
+            memmove(rx_fifo, rx_fifo + 1, --rx_cantidad);
+            rx_presentado = 0;
+            rx_cti_avisado = 0;
+        }
+        if (rx_cantidad > 0) {
+            ESCRIBIR_8(uart0.RBR, rx_fifo[0]);
+            lsr |= UART_LSR_RDR;
+            rx_presentado = 1;
+        }
+        if (rx_overrun) {
+            lsr |= UART_LSR_OE;     // Leer LSR lo limpia
+            rx_overrun = 0;
+        }
+        ESCRIBIR_8(uart0.LSR, lsr);
+    }
+    return &uart0;
+}
+
+static void terminar_lectura_uart(void) {
+    if (rx_presentado) {
+        memmove(rx_fifo, rx_fifo + 1, --rx_cantidad);   // La ISR leyó RBR y salió sin releer LSR
+        rx_presentado = 0;
+    }
+}
+
+static uint8_t nivel_disparo_rx(void) {
+    static const uint8_t niveles[4] = {1, 4, 8, 14};
+    return niveles[(uart0.FCR >> 6) & 0x3];
+}
+
+static void llegar_byte(void) {
+    uint8_t byte = entrada[entrada_primero];
+    entrada_primero = (entrada_primero + 1) % ENTRADA_UART;
+    entrada_cantidad--;
+    entrada_proximo_ns = entrada_cantidad ? entrada_proximo_ns + caracter_uart_ns() : NUNCA;
+
+    estadisticas.bytes_rx++;
+    if (rx_cantidad == FIFO_UART) {
+        estadisticas.perdidos_rx++;
+        rx_overrun = 1;
+        return;
+    }
+    rx_fifo[rx_cantidad++] = byte;
+    rx_ultimo_ns = ahora_ns;
+    rx_cti_avisado = 0;
+    if ((uart0.IER & UART_IER_RBRINT_EN) && rx_cantidad >= nivel_disparo_rx()) {
+        pedir_irq(UART0_IRQn);
+    }
+}
+
+static uint64_t proximo_cti_ns(void) {
+    if (rx_cantidad == 0 || rx_cti_avisado || !(uart0.IER & UART_IER_RBRINT_EN)) return NUNCA;
+    return rx_ultimo_ns + CARACTERES_CTI * caracter_uart_ns();
+}
+
+static void vencer_cti(void) {
+    rx_cti_avisado = 1;
+    pedir_irq(UART0_IRQn);
+}
+
+void sim_uart_recibir(const uint8_t *bytes, uint32_t cantidad) {
+    for (uint32_t i = 0; i < cantidad && entrada_cantidad < ENTRADA_UART; i++) {
+        entrada[(entrada_primero + entrada_cantidad) % ENTRADA_UART] = bytes[i];
+        if (entrada_cantidad++ == 0) {
+            entrada_proximo_ns = ahora_ns + caracter_uart_ns();
+        }
+    }
+}
+
+/**
+ * @brief THR libre otra vez: el canal TX recibe otro pedido
+ */
+static void vencer_tx(void) {
+    int numero = canal_para(GPDMA_UART0_Tx);
+    if (numero >= 0) transferir_elemento((uint8_t)numero);
+    tx_proximo_ns = (canal_para(GPDMA_UART0_Tx) >= 0) ? tx_proximo_ns + caracter_uart_ns() : NUNCA;
+}
+
+/* ==================== I2C ================================================= */
+
+static uint8_t indice_i2c(LPC_I2C_TypeDef *i2c) {
+    return (uint8_t)(i2c - sim_i2c);
+}
+
+void I2C_Init(LPC_I2C_TypeDef *i2c, uint32_t reloj_hz) {
+    i2c_reloj_hz[indice_i2c(i2c)] = reloj_hz ? reloj_hz : 100000;
+}
+
+void I2C_Cmd(LPC_I2C_TypeDef *i2c, FunctionalState estado) {
+    i2c->I2CONSET = (estado == ENABLE) ? I2C_I2CONSET_I2EN : 0;
+}
+
+static uint64_t duracion_i2c_ns(uint8_t bus, uint32_t cantidad) {
+    uint32_t bits = (cantidad + 1) * 9 + 2;     // Dirección y datos con ACK, START y STOP
+    return (uint64_t)bits * NS_POR_S / i2c_reloj_hz[bus];
+}
+
+/**
+ * @brief Pone la transacción en el bus: la cuenta y se la pasa al sumidero
+ *
+ * En modo asíncrono se llama al final del tiempo de bus y lee tx_data
+ * recién entonces: si el firmware pisó los bytes en vuelo, el sumidero ve
+ * los pisados.
+ */
+static void transmitir_i2c(uint8_t bus, I2C_M_SETUP_Type *cfg) {
+    estadisticas.transacciones_i2c++;
+    estadisticas.bytes_i2c += cfg->tx_length;
+    estadisticas.bus_i2c_ns += duracion_i2c_ns(bus, cfg->tx_length);
+    if (sumidero_i2c) sumidero_i2c(cfg->sl_addr7bit, cfg->tx_data, cfg->tx_length);
+    cfg->tx_count = cfg->tx_length;
+    cfg->rx_count = 0;
+}
+
+static void vencer_i2c(uint8_t bus) {
+    I2C_M_SETUP_Type *cfg = i2c_en_vuelo[bus];
+    i2c_en_vuelo[bus] = NULL;
+    i2c_fin_ns[bus] = NUNCA;
+    transmitir_i2c(bus, cfg);
+    i2c_completa[bus] = 1;
+    pedir_irq((IRQn_Type)(I2C0_IRQn + bus));
+}
+
+Status I2C_MasterTransferData(LPC_I2C_TypeDef *i2c, I2C_M_SETUP_Type *cfg, I2C_TRANSFER_OPT_Type opcion) {
+    uint8_t bus = indice_i2c(i2c);
+
+    if (opcion != I2C_TRANSFER_INTERRUPT) {
+        transmitir_i2c(bus, cfg);
+        return SUCCESS;
+    }
+
+    entrar_modelo();
+    nvic_habilitada[VECTOR(I2C0_IRQn + bus)] = 1;   // El driver habilita la IRQ al arrancar
+    if (i2c_asincrono) {
+        if (i2c_en_vuelo[bus]) estadisticas.i2c_solapadas++;    // En la placa pisaría la anterior
+        i2c_en_vuelo[bus] = cfg;
+        i2c_fin_ns[bus] = ahora_ns + duracion_i2c_ns(bus, cfg->tx_length);
+    } else {
+        transmitir_i2c(bus, cfg);
+        i2c_completa[bus] = 1;
+        pedir_irq((IRQn_Type)(I2C0_IRQn + bus));
+    }
+    salir_modelo();
+    return SUCCESS;
+}
+
+void I2C_MasterHandler(LPC_I2C_TypeDef *i2c) {
+    (void)i2c;      // La transacción ya terminó en I2C_MasterTransferData()
+}
+
+uint32_t I2C_MasterTransferComplete(LPC_I2C_TypeDef *i2c) {
+    uint8_t bus = indice_i2c(i2c);
+    uint32_t completa = i2c_completa[bus];
+    i2c_completa[bus] = 0;
+    return completa;
+}
+
+/* ==================== RELOJ VIRTUAL ======================================= */
+
+void sim_inicializar(void) {
+    // El firmware guarda direcciones en uint32_t (LLI, DMACCSrcAddr): con
+    // un binario PIE las variables quedan arriba de 4 GB y se truncan
+    if ((uintptr_t)&sim_dac > UINT32_MAX || (uintptr_t)&ahora_ns > UINT32_MAX) {
+        fprintf(stderr, "simulador: las variables quedaron arriba de 4 GB, compilar con -no-pie\n");
+        exit(2);
+    }
+    memset(sim_gpio, 0, sizeof(sim_gpio));
+    sim_boton(0);                       // Pull-up: suelto se lee 1
+    sim_gpio[2].FIOPIN |= 1UL << 10;    // Botón de reset (EINT3) suelto
+    sim_joystick(2048, 2048);
+    ESCRIBIR_8(uart0.LSR, UART_LSR_THRE | UART_LSR_TEMT);
+    sim_sc.PCONP = 0x042887DE;          // Valor de reset del LPC1769
+}
+
+void sim_conectar(SimSumideroI2c i2c, SimSumideroUart uart, SimSumideroDac dac) {
+    sumidero_i2c = i2c;
+    sumidero_uart = uart;
+    sumidero_dac = dac;
+}
+
+uint64_t sim_ahora_ns(void) {
+    return ahora_ns;
+}
+
+static uint64_t minimo(uint64_t a, uint64_t b) {
+    return a < b ? a : b;
+}
+
+void sim_avanzar_ns(uint64_t ns) {
+    uint64_t destino = ahora_ns + ns;
+    entrar_modelo();
+    for (;;) {
+        uint64_t cti_ns = proximo_cti_ns();
+        uint64_t proximo = minimo(minimo(systick_proximo_ns, dac_proximo_ns),
+                                  minimo(minimo(entrada_proximo_ns, cti_ns), tx_proximo_ns));
+        for (uint8_t i = 0; i < 4; i++) {
+            proximo = minimo(proximo, temporizadores[i].proximo_ns);
+        }
+        for (uint8_t i = 0; i < 3; i++) {
+            proximo = minimo(proximo, i2c_fin_ns[i]);
+        }
+        if (proximo > destino) break;
+        if (proximo > ahora_ns) ahora_ns = proximo;     // Lo vencido mientras tanto se atiende ya
+        actualizar_tc();
+
+        /* En el mismo instante: primero lo que pide DMA, después los relojes */
+        if (dac_proximo_ns <= ahora_ns) vencer_dac();
+        if (tx_proximo_ns <= ahora_ns) vencer_tx();
+        if (entrada_proximo_ns <= ahora_ns) llegar_byte();
+        if (cti_ns <= ahora_ns) vencer_cti();
+        for (uint8_t i = 0; i < 3; i++) {
+            if (i2c_fin_ns[i] <= ahora_ns) vencer_i2c(i);
+        }
+        for (uint8_t i = 0; i < 4; i++) {
+            if (temporizadores[i].proximo_ns <= ahora_ns) vencer_timer(i);
+        }
+        if (systick_proximo_ns <= ahora_ns) {
+            systick_proximo_ns += systick_periodo_ns;
+            pedir_irq(SysTick_IRQn);
+        }
+    }
+    ahora_ns = destino;
+    actualizar_tc();
+    salir_modelo();
+}
+
+void sim_i2c_asincrono(uint8_t activo) {
+    i2c_asincrono = activo;
+}
+
+uint8_t sim_ocupado(void) {
+    return dentro_del_modelo != 0;
+}
+
+void sim_obtener_estadisticas(SimEstadisticas *e) {
+    *e = estadisticas;
+}
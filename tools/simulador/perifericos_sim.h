@@ -0,0 +1,92 @@
+/**
+ * @file perifericos_sim.h
+ * @brief Capa de periféricos simulados para correr el firmware en una PC.
+ *
+ * El firmware de src/ compila contra el LPC17xx.h de esta carpeta, que
+ * reapunta los registros a structs en RAM (perifericos_sim.c). Acá están
+ * el reloj virtual, las entradas (joystick, botón P0.4, bytes que llegan
+ * por UART0) y los sumideros de salida (bytes I2C del LCD, bytes que salen
+ * por UART0, muestras del DAC).
+ *
+ * El tiempo solo avanza con sim_avanzar_ns(): SysTick, TIMER0-3, los
+ * pedidos del DAC y de UART0 al GPDMA y la llegada de bytes por UART0
+ * ocurren en orden, y cada interrupción se despacha según el NVIC
+ * (prioridad, habilitación y PRIMASK). Con las mismas entradas, la misma
+ * corrida.
+ *
+ * @date Noviembre 2025
+ */
+
+#ifndef PERIFERICOS_SIM_H
+#define PERIFERICOS_SIM_H
+
+#include <stdint.h>
+
+/* === SUMIDEROS === */
+typedef void (*SimSumideroI2c)(uint8_t direccion, const uint8_t *bytes, uint32_t cantidad);
+typedef void (*SimSumideroUart)(uint8_t byte);
+typedef void (*SimSumideroDac)(uint16_t valor);     // 10 bits, una por vencimiento de DACCNTVAL
+
+typedef struct {
+    uint32_t isr_systick;
+    uint32_t isr_timer1;
+    uint32_t isr_uart0;
+    uint32_t isr_i2c0;
+    uint32_t isr_gpdma;
+    uint32_t transacciones_i2c;
+    uint32_t bytes_i2c;
+    uint64_t bus_i2c_ns;        // START + dirección + datos + STOP al reloj de I2C_Init()
+    uint32_t i2c_solapadas;     // Modo asíncrono: I2C_MasterTransferData() con otra en vuelo
+    uint32_t bytes_rx;          // Llegaron por UART0
+    uint32_t perdidos_rx;       // FIFO de 16 bytes lleno (overrun)
+    uint32_t bytes_tx;
+    uint32_t muestras_dac;
+} SimEstadisticas;
+
+/**
+ * @brief Deja los pines de entrada en reposo (botón suelto, joystick al centro)
+ */
+void sim_inicializar(void);
+
+/**
+ * @brief Conecta los sumideros de salida (NULL: se descartan)
+ */
+void sim_conectar(SimSumideroI2c i2c, SimSumideroUart uart, SimSumideroDac dac);
+
+/**
+ * @brief Tiempo virtual desde el arranque
+ */
+uint64_t sim_ahora_ns(void);
+
+/**
+ * @brief Avanza el reloj virtual y atiende todo lo que vence en el camino
+ */
+void sim_avanzar_ns(uint64_t ns);
+
+/**
+ * @brief Las transacciones I2C por interrupción terminan después de su
+ * tiempo de bus, dentro de sim_avanzar_ns(), en lugar de en el acto
+ *
+ * Los lazos de espera de lcd_i2c.c solo salen si el reloj corre mientras
+ * tanto, así que sirve para quien llama a sim_avanzar_ns() desde un
+ * manejador de señal (tools/prueba_lcd_i2c.c), no para el simulador.
+ */
+void sim_i2c_asincrono(uint8_t activo);
+
+/**
+ * @brief 1 si el modelo está a mitad de un cambio de estado
+ *
+ * Un manejador de señal que avanza el reloj tiene que postergar el avance
+ * cuando esto da 1: interrumpió al firmware adentro del modelo (NVIC,
+ * PRIMASK o I2C_MasterTransferData()).
+ */
+uint8_t sim_ocupado(void);
+
+/* === ENTRADAS === */
+void sim_joystick(uint16_t x, uint16_t y);          // Lo que convierten AD0.0 y AD0.1 (0..4095)
+void sim_boton(uint8_t presionado);                 // P0.4, activo bajo con pull-up
+void sim_uart_recibir(const uint8_t *bytes, uint32_t cantidad);  // Llegan uno por vez a BT_VELOCIDAD_UART0
+
+void sim_obtener_estadisticas(SimEstadisticas *estadisticas);
+
+#endif // PERIFERICOS_SIM_H
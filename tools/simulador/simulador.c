@@ -0,0 +1,457 @@
+/**
+ * @file simulador.c
+ * @brief Simulador (PC) del arcade completo sobre periféricos simulados.
+ *
+ * Compila todo src/ (juegos, menú, audio, Bluetooth, joystick, LCD y
+ * planificador) contra tools/simulador/LPC17xx.h y corre el mismo bucle
+ * que la placa: arcade_inicializar() y después arcade_ejecutar_ciclo()
+ * una y otra vez. Entre vuelta y vuelta el reloj virtual avanza --paso-us
+ * y ahí entran SysTick, TIMER1, los pedidos del DAC al GPDMA y lo que llega
+ * por UART0, cada uno con su ISR. Sin reloj de pared: con el mismo guion,
+ * la misma corrida, así que sirve en CI.
+ *
+ * Salidas:
+ * - Los bytes I2C pasan por el HD44780 virtual de decodificador_lcd.c;
+ *   cada vuelta que dibujó es un cuadro (bytes, tiempo de bus y costo en
+ *   el host de esa vuelta, para comparar caminos de dibujo).
+ * - Lo que sale por UART0 se guarda para las comprobaciones (--uart además
+ *   lo muestra en stdout).
+ * - Las muestras del DAC (20 kHz) se cuentan y, con --wav, se escriben.
+ *
+ * Guion (--guion archivo): una acción por línea, "<ms> <acción> [argumento]",
+ * en orden de tiempo. Las líneas vacías o con '#' se saltean.
+ *   x N, y N              ejes del joystick (0..4095)
+ *   arriba, abajo, izquierda, derecha, centro
+ *   boton 1|0             P0.4
+ *   bt TEXTO              bytes por UART0 (\r, \n, \\ y \xHH)
+ *   pantalla              imprime el LCD en ese momento
+ *   comprobar_lcd F TEXTO la fila F tiene que empezar con TEXTO
+ *   comprobar_uart TEXTO  TEXTO tiene que haber salido por UART0
+ *   fin                   termina
+ *
+ * --verificar corre un guion fijo (créditos, menú con joystick y con
+ * Bluetooth, una partida de Snake hasta el Game Over, la tabla 'I' y la
+ * vuelta al menú) y además controla el ritmo del DAC, el FIFO de UART0 y
+ * que nada se escriba fuera de la pantalla. Devuelve 1 si algo falla.
+ *
+ * Compilar: gcc -O2 -Wall -Wextra -no-pie -Itools/simulador -Iinclude -ICMSISv2p00_LPC17xx/inc \
+ *               -ICMSISv2p00_LPC17xx/Drivers/inc -Dmain=main_placa -o simulador \
+ *               tools/simulador/simulador.c tools/simulador/perifericos_sim.c src/[a-z]*.c
+ *           (-no-pie: el firmware guarda direcciones en uint32_t; -Dmain deja
+ *            libre el main() de la placa)
+ * Uso:      ./simulador --verificar
+ *           ./simulador --guion partida.txt [--ms 20000] [--paso-us 100] [--uart] [--wav audio.wav]
+ *
+ * @date Noviembre 2025
+ */
+
+#undef main     // -Dmain=main_placa es para src/main.c
+
+#include "perifericos_sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define DECODIFICADOR_LCD_SIN_MAIN
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include "../decodificador_lcd.c"
+#pragma GCC diagnostic pop
+
+/* === BUCLE DE main.c === */
+extern void arcade_inicializar(void);
+extern void arcade_ejecutar_ciclo(void);
+
+/* === CONFIGURACIÓN === */
+#define MS_POR_DEFECTO      20000
+#define PASO_US_POR_DEFECTO 100         // Una vuelta del bucle principal
+#define SALIDA_UART         65536       // Lo último que salió por UART0
+#define ACCIONES_MAXIMO     1024
+#define LARGO_TEXTO         128
+#define FRECUENCIA_DAC_HZ   20000
+
+typedef struct {
+    uint32_t ms;
+    char accion[24];
+    char texto[LARGO_TEXTO];
+    uint32_t largo;             // Bytes de texto (puede tener \x00)
+} Accion;
+
+/* === ESTADO === */
+static Accion acciones[ACCIONES_MAXIMO];
+static uint32_t cantidad_acciones = 0;
+static uint32_t fallas = 0;
+
+static char salida_uart[SALIDA_UART + 1];
+static uint32_t largo_uart = 0;
+static uint8_t mostrar_uart = 0;
+
+static FILE *wav = NULL;
+static uint32_t muestras_wav = 0;
+static uint16_t dac_minimo = 0x3FF, dac_maximo = 0;
+
+typedef struct {
+    uint32_t cuadros;
+    uint32_t bytes_peor;
+    double bus_us;
+    uint64_t host_ns;
+    uint64_t host_peor_ns;
+} Cuadros;
+static Cuadros cuadros;
+
+/* === SUMIDEROS === */
+
+static void recibir_i2c(uint8_t direccion, const uint8_t *bytes, uint32_t cantidad) {
+    (void)direccion;
+    for (uint32_t i = 0; i < cantidad; i++) {
+        pcf8574_escribir(bytes[i]);
+    }
+    frame.transacciones++;
+}
+
+static void recibir_uart(uint8_t byte) {
+    if (mostrar_uart) putchar(byte);
+    if (largo_uart == SALIDA_UART) {
+        memmove(salida_uart, salida_uart + SALIDA_UART / 2, SALIDA_UART / 2);
+        largo_uart = SALIDA_UART / 2;
+    }
+    salida_uart[largo_uart++] = (char)(byte ? byte : ' ');   // strstr() no corta en los ceros
+    salida_uart[largo_uart] = '\0';
+}
+
+static void escribir_16(FILE *f, uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); }
+static void escribir_32(FILE *f, uint32_t v) { escribir_16(f, v & 0xFFFF); escribir_16(f, v >> 16); }
+
+static void escribir_cabecera_wav(FILE *f, uint32_t muestras) {
+    fseek(f, 0, SEEK_SET);
+    fwrite("RIFF", 1, 4, f);
+    escribir_32(f, 36 + muestras * 2);
+    fwrite("WAVEfmt ", 1, 8, f);
+    escribir_32(f, 16);
+    escribir_16(f, 1);                      // PCM
+    escribir_16(f, 1);                      // Mono
+    escribir_32(f, FRECUENCIA_DAC_HZ);
+    escribir_32(f, FRECUENCIA_DAC_HZ * 2);
+    escribir_16(f, 2);
+    escribir_16(f, 16);
+    fwrite("data", 1, 4, f);
+    escribir_32(f, muestras * 2);
+}
+
+static void recibir_dac(uint16_t valor) {
+    if (valor < dac_minimo) dac_minimo = valor;
+    if (valor > dac_maximo) dac_maximo = valor;
+    if (wav) {
+        escribir_16(wav, (uint16_t)(((int32_t)valor - 512) * 64));
+        muestras_wav++;
+    }
+}
+
+/* === GUION === */
+
+/**
+ * @brief Copia el texto con escapes (\r, \n, \\, \xHH)
+ * @return Bytes copiados
+ */
+static uint32_t copiar_texto(char *destino, const char *origen) {
+    uint32_t n = 0;
+    while (*origen && *origen != '\n' && *origen != '\r' && n < LARGO_TEXTO - 1) {
+        char c = *origen++;
+        if (c == '\\' && *origen) {
+            char e = *origen++;
+            if (e == 'n') c = '\n';
+            else if (e == 'r') c = '\r';
+            else if (e == 'x') {
+                unsigned valor = 0;
+                int leidos = 0;
+                sscanf(origen, "%2x%n", &valor, &leidos);
+                origen += leidos;
+                c = (char)valor;
+            } else c = e;
+        }
+        destino[n++] = c;
+    }
+    destino[n] = '\0';
+    return n;
+}
+
+static int agregar_accion(const char *linea, uint32_t numero) {
+    Accion *a = &acciones[cantidad_acciones];
+    unsigned ms;
+    int leidos = 0;
+    while (*linea == ' ' || *linea == '\t') linea++;
+    if (*linea == '\0' || *linea == '\n' || *linea == '\r' || *linea == '#') return 1;
+    if (cantidad_acciones == ACCIONES_MAXIMO ||
+        sscanf(linea, "%u %23s%n", &ms, a->accion, &leidos) != 2) {
+        fprintf(stderr, "Guion, línea %u: no se entiende\n", numero);
+        return 0;
+    }
+    linea += leidos;
+    if (*linea == ' ') linea++;
+    a->ms = ms;
+    a->largo = copiar_texto(a->texto, linea);
+    cantidad_acciones++;
+    return 1;
+}
+
+static int cargar_guion(const char *archivo) {
+    char linea[256];
+    uint32_t numero = 0;
+    FILE *f = fopen(archivo, "r");
+    if (!f) {
+        perror(archivo);
+        return 0;
+    }
+    while (fgets(linea, sizeof(linea), f)) {
+        if (!agregar_accion(linea, ++numero)) {
+            fclose(f);
+            return 0;
+        }
+    }
+    fclose(f);
+    return 1;
+}
+
+static void comprobar_lcd(const Accion *a) {
+    char *resto;
+    unsigned long fila = strtoul(a->texto, &resto, 10);
+    if (resto == a->texto || *resto != ' ' || fila >= LCD_FILAS) {
+        printf("[%6u ms] comprobar_lcd: fila inválida\n", a->ms);
+        fallas++;
+        return;
+    }
+    const char *esperado = resto + 1;   // Un solo espacio: los que siguen son parte del texto
+    size_t largo = strlen(esperado);
+    if (largo > LCD_COLUMNAS || memcmp(&lcd.ddram[inicio_fila[fila]], esperado, largo) != 0) {
+        printf("[%6u ms] FALLA: fila %lu no empieza con \"%s\"\n", a->ms, fila, esperado);
+        imprimir_pantalla();
+        fallas++;
+    }
+}
+
+static void comprobar_uart(const Accion *a) {
+    if (!strstr(salida_uart, a->texto)) {
+        printf("[%6u ms] FALLA: no salió \"%s\" por UART0\n", a->ms, a->texto);
+        fallas++;
+    }
+}
+
+/**
+ * @return 0 si el guion pidió terminar
+ */
+static int ejecutar_accion(const Accion *a) {
+    static uint16_t x = 2048, y = 2048;
+    const char *n = a->accion;
+
+    if (strcmp(n, "x") == 0) x = (uint16_t)atoi(a->texto);
+    else if (strcmp(n, "y") == 0) y = (uint16_t)atoi(a->texto);
+    else if (strcmp(n, "arriba") == 0) { x = 2048; y = 7; }
+    else if (strcmp(n, "abajo") == 0) { x = 2048; y = 4095; }
+    else if (strcmp(n, "izquierda") == 0) { x = 6; y = 2048; }
+    else if (strcmp(n, "derecha") == 0) { x = 4095; y = 2048; }
+    else if (strcmp(n, "centro") == 0) { x = 2048; y = 2048; }
+    else if (strcmp(n, "boton") == 0) sim_boton(a->largo == 0 || atoi(a->texto) != 0);
+    else if (strcmp(n, "bt") == 0) sim_uart_recibir((const uint8_t *)a->texto, a->largo);
+    else if (strcmp(n, "pantalla") == 0) { printf("[%6u ms]\n", a->ms); imprimir_pantalla(); }
+    else if (strcmp(n, "comprobar_lcd") == 0) comprobar_lcd(a);
+    else if (strcmp(n, "comprobar_uart") == 0) comprobar_uart(a);
+    else if (strcmp(n, "fin") == 0) return 0;
+    else {
+        printf("[%6u ms] acción desconocida: %s\n", a->ms, n);
+        fallas++;
+    }
+    sim_joystick(x, y);
+    return 1;
+}
+
+/* === GUION DE --verificar === */
+
+static const char *const guion_verificacion[] = {
+    "0     comprobar_lcd 3 Digital 3 --",
+    "300   comprobar_uart === DINOCHROME ARCADE ===",
+    "# Joystick: el puntero baja a SNAKE (el menú se redibuja entero)",
+    "500   abajo",
+    "520   comprobar_lcd 0   SELECCIONA JUEGO",
+    "520   comprobar_lcd 2 > 2. SNAKE",
+    "600   centro",
+    "# Bluetooth: W y S mueven el puntero como el joystick",
+    "800   bt W",
+    "900   comprobar_lcd 1 > 1. DINO CHROME",
+    "1200  bt S",
+    "1300  comprobar_lcd 2 > 2. SNAKE",
+    "1500  comprobar_uart hola",
+    "# Snake: el botón elige y la serpiente sube hasta chocar",
+    "# Pulsación corta: si sigue apretado en el primer tick, Snake arranca en pausa",
+    "1600  boton 1",
+    "1620  boton 0",
+    "1800  arriba",
+    "2000  bt I",
+    "3000  comprobar_uart ISR      entradas",
+    "3000  comprobar_uart Tarea periodo",
+    "30000 comprobar_lcd 0    GAME OVER!",
+    "30000 comprobar_lcd 3 Boton:Volver al menu",
+    "30000 centro",
+    "30100 boton 1",
+    "30200 boton 0",
+    "30300 comprobar_lcd 0   SELECCIONA JUEGO",
+    "30300 comprobar_lcd 1 > 1. DINO CHROME",
+    "30500 fin",
+};
+
+static void comprobar_corrida(uint64_t ms) {
+    SimEstadisticas e;
+    sim_obtener_estadisticas(&e);
+    uint64_t esperadas = ms * (FRECUENCIA_DAC_HZ / 1000);
+    if (e.muestras_dac + 1 < esperadas || e.muestras_dac > esperadas + 1) {
+        printf("FALLA: %u muestras del DAC en %llu ms (se esperaban %llu)\n",
+               e.muestras_dac, (unsigned long long)ms, (unsigned long long)esperadas);
+        fallas++;
+    }
+    if (dac_maximo <= dac_minimo) {
+        printf("FALLA: el DAC no se movió (la música no sonó)\n");
+        fallas++;
+    }
+    if (e.perdidos_rx) {
+        printf("FALLA: %u bytes perdidos en el FIFO de UART0\n", e.perdidos_rx);
+        fallas++;
+    }
+    if (total.fuera_de_pantalla) {
+        printf("FALLA: %u escrituras fuera de la pantalla\n", total.fuera_de_pantalla);
+        fallas++;
+    }
+}
+
+/* === REPORTE === */
+
+static uint64_t reloj_host_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+/**
+ * @brief Cierra el cuadro si la vuelta mandó bytes al LCD
+ */
+static void cerrar_cuadro(uint64_t host_ns) {
+    if (frame.bytes == 0) return;
+    cuadros.cuadros++;
+    cuadros.bus_us += tiempo_bus_us(&frame);
+    cuadros.host_ns += host_ns;
+    if (host_ns > cuadros.host_peor_ns) cuadros.host_peor_ns = host_ns;
+    if (frame.bytes > cuadros.bytes_peor) cuadros.bytes_peor = frame.bytes;
+    sumar(&total, &frame);
+    memset(&frame, 0, sizeof(frame));
+}
+
+static void imprimir_reporte(uint64_t ms, uint32_t vueltas) {
+    SimEstadisticas e;
+    sim_obtener_estadisticas(&e);
+    printf("Tiempo virtual: %llu ms, %u vueltas del bucle principal\n", (unsigned long long)ms, vueltas);
+    imprimir_contadores("LCD", &total);
+    if (cuadros.cuadros) {
+        printf("Cuadros: %u, %.1f bytes I2C por cuadro (peor %u), bus %.1f%% ocupado\n",
+               cuadros.cuadros, (double)total.bytes / cuadros.cuadros, cuadros.bytes_peor,
+               ms ? cuadros.bus_us / (ms * 10.0) : 0.0);
+        printf("Costo en el host de la vuelta que dibuja: prom %.1f us, peor %.1f us\n",
+               cuadros.host_ns / 1e3 / cuadros.cuadros, cuadros.host_peor_ns / 1e3);
+    }
+    printf("Audio: %u muestras del DAC, rango [%u, %u]\n", e.muestras_dac,
+           dac_minimo <= dac_maximo ? dac_minimo : 0, dac_maximo);
+    printf("UART0: %u bytes recibidos (%u perdidos), %u enviados\n", e.bytes_rx, e.perdidos_rx, e.bytes_tx);
+    printf("ISR: SysTick %u, TIMER1 %u, UART0 %u, I2C0 %u, GPDMA %u\n",
+           e.isr_systick, e.isr_timer1, e.isr_uart0, e.isr_i2c0, e.isr_gpdma);
+    imprimir_pantalla();
+}
+
+/* === PROGRAMA === */
+
+int main(int argc, char *argv[]) {
+    uint64_t ms_total = MS_POR_DEFECTO;
+    uint64_t paso_ns = PASO_US_POR_DEFECTO * 1000ULL;
+    uint8_t verificar = 0;
+    const char *archivo_wav = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--verificar") == 0) {
+            verificar = 1;
+        } else if (strcmp(argv[i], "--guion") == 0 && i + 1 < argc) {
+            if (!cargar_guion(argv[++i])) return 2;
+        } else if (strcmp(argv[i], "--ms") == 0 && i + 1 < argc) {
+            ms_total = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--paso-us") == 0 && i + 1 < argc) {
+            paso_ns = strtoull(argv[++i], NULL, 10) * 1000ULL;
+        } else if (strcmp(argv[i], "--uart") == 0) {
+            mostrar_uart = 1;
+        } else if (strcmp(argv[i], "--wav") == 0 && i + 1 < argc) {
+            archivo_wav = argv[++i];
+        } else {
+            fprintf(stderr, "Uso: %s [--verificar] [--guion archivo] [--ms N] [--paso-us N] [--uart] [--wav archivo]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+    if (paso_ns == 0 || paso_ns > 1000000) {
+        fprintf(stderr, "--paso-us tiene que estar entre 1 y 1000\n");
+        return 2;
+    }
+    if (verificar) {
+        cantidad_acciones = 0;
+        for (size_t i = 0; i < sizeof(guion_verificacion) / sizeof(guion_verificacion[0]); i++) {
+            agregar_accion(guion_verificacion[i], (uint32_t)i + 1);
+        }
+        ms_total = UINT64_MAX / 1000000ULL;    // Hasta el "fin" del guion
+    }
+    if (archivo_wav) {
+        wav = fopen(archivo_wav, "wb");
+        if (!wav) {
+            perror(archivo_wav);
+            return 2;
+        }
+        escribir_cabecera_wav(wav, 0);
+    }
+
+    lcd_reiniciar();
+    memset(&frame, 0, sizeof(frame));
+    memset(&total, 0, sizeof(total));
+    sim_inicializar();
+    sim_conectar(recibir_i2c, recibir_uart, recibir_dac);
+
+    uint64_t host_inicio = reloj_host_ns();
+    arcade_inicializar();
+    cerrar_cuadro(reloj_host_ns() - host_inicio);
+
+    uint32_t siguiente = 0, vueltas = 0;
+    uint64_t ahora_ms = 0;
+    int seguir = 1;
+    while (seguir && ahora_ms < ms_total) {
+        while (siguiente < cantidad_acciones && acciones[siguiente].ms <= ahora_ms) {
+            if (!ejecutar_accion(&acciones[siguiente++])) {
+                seguir = 0;
+                break;
+            }
+        }
+        if (!seguir) break;
+
+        uint64_t host_antes = reloj_host_ns();
+        arcade_ejecutar_ciclo();
+        cerrar_cuadro(reloj_host_ns() - host_antes);
+        vueltas++;
+
+        sim_avanzar_ns(paso_ns);
+        ahora_ms = sim_ahora_ns() / 1000000ULL;
+    }
+
+    if (wav) {
+        escribir_cabecera_wav(wav, muestras_wav);
+        fclose(wav);
+    }
+    if (mostrar_uart) printf("\n");
+    imprimir_reporte(ahora_ms, vueltas);
+    if (verificar) {
+        comprobar_corrida(sim_ahora_ns() / 1000000ULL);
+        printf("%s\n", fallas ? "FALLO" : "OK");
+    }
+    return fallas ? 1 : 0;
+}